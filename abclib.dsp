@@ -1975,6 +1975,10 @@ SOURCE=.\src\sat\bmc\bmcCexMin2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcCexTer.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcCexTools.c
 # End Source File
 # Begin Source File
@@ -2035,6 +2039,10 @@ SOURCE=.\src\sat\bmc\bmcMulti.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcPort.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcUnroll.c
 # End Source File
 # End Group
@@ -3851,6 +3859,18 @@ SOURCE=.\src\misc\util\utilColor.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilCut.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilDimacs.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilDimacs.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilDouble.h
 # End Source File
 # Begin Source File
@@ -3883,6 +3903,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSatStat.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSatStat.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -4903,6 +4931,14 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimBias.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSimTrace.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -4959,6 +4995,10 @@ SOURCE=.\src\aig\gia\giaTsim.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaTtCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaUnate.c
 # End Source File
 # Begin Source File
@@ -5595,6 +5635,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
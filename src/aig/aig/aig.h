@@ -673,6 +673,11 @@ extern Vec_Ptr_t *     Aig_ManMuxesCollect( Aig_Man_t * pAig );
 extern void            Aig_ManMuxesDeref( Aig_Man_t * pAig, Vec_Ptr_t * vMuxes );
 extern void            Aig_ManMuxesRef( Aig_Man_t * pAig, Vec_Ptr_t * vMuxes );
 extern void            Aig_ManInvertConstraints( Aig_Man_t * pAig );
+extern word            Aig_ManSignature( Aig_Man_t * p );
+extern Vec_Str_t *     Aig_ManCheckpointStart( Aig_Man_t * p, char Type );
+extern int             Aig_ManCheckpointWrite( Vec_Str_t * vOut, char * pFileName );
+extern int             Aig_ManCheckpointGetI( Vec_Str_t * vIn, int * pPos, int * pValue );
+extern Vec_Str_t *     Aig_ManCheckpointRead( Aig_Man_t * p, char * pFileName, char Type, int * pPos );
 
 /*=== aigWin.c =========================================================*/
 extern void            Aig_ManFindCut( Aig_Obj_t * pRoot, Vec_Ptr_t * vFront, Vec_Ptr_t * vVisited, int nSizeLimit, int nFanoutLimit );
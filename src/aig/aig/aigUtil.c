@@ -26,6 +26,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the version of the checkpoint format written by the verification engines
+#define AIG_CHECKPOINT_VER  1
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -1169,8 +1172,8 @@ void Aig_ManRandomTest1()
 ***********************************************************************/
 unsigned Aig_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
@@ -1566,6 +1569,185 @@ void Aig_ManInvertConstraints( Aig_Man_t * pAig )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural signature of the AIG.]
+
+  Description [The signature depends on the object IDs and the fanin
+  literals, so it identifies the same AIG derived from the same file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Aig_ManSignature( Aig_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    word Sign = ABC_CONST(0x9E3779B97F4A7C15);
+    int i;
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        Sign ^= (word)Aig_ObjType(pObj);
+        if ( Aig_ObjFanin0(pObj) )
+            Sign ^= (word)(2 * Aig_ObjFaninId0(pObj) + Aig_ObjFaninC0(pObj)) << 8;
+        if ( Aig_ObjFanin1(pObj) )
+            Sign ^= (word)(2 * Aig_ObjFaninId1(pObj) + Aig_ObjFaninC1(pObj)) << 36;
+        Sign *= ABC_CONST(0xFF51AFD7ED558CCD);
+        Sign ^= Sign >> 29;
+    }
+    return Sign;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the checkpoint of a verification engine.]
+
+  Description [The checkpoint begins with the engine type and the AIG
+  signature, which are compared when the checkpoint is read back.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Aig_ManCheckpointStart( Aig_Man_t * p, char Type )
+{
+    Vec_Str_t * vOut = Vec_StrAlloc( 1000 );
+    Vec_StrPutC( vOut, 'A' );
+    Vec_StrPutC( vOut, 'B' );
+    Vec_StrPutC( vOut, 'C' );
+    Vec_StrPutC( vOut, Type );
+    Vec_StrPutI( vOut, AIG_CHECKPOINT_VER );
+    Vec_StrPutI( vOut, Aig_ManCiNum(p) );
+    Vec_StrPutI( vOut, Aig_ManCoNum(p) );
+    Vec_StrPutI( vOut, Aig_ManRegNum(p) );
+    Vec_StrPutI( vOut, Aig_ManObjNumMax(p) );
+    Vec_StrPutW( vOut, Aig_ManSignature(p) );
+    return vOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the checkpoint into a file.]
+
+  Description [The checkpoint is written into a temporary file, which is
+  then renamed, so that a job killed while writing does not leave behind
+  a truncated checkpoint.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Aig_ManCheckpointWrite( Vec_Str_t * vOut, char * pFileName )
+{
+    char * pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    FILE * pFile;
+    int fSuccess;
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open checkpoint file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    fSuccess = ((int)fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile ) == Vec_StrSize(vOut));
+    fSuccess = (fclose( pFile ) == 0) && fSuccess;
+#ifdef _WIN32
+    remove( pFileName );
+#endif
+    fSuccess = fSuccess && (rename( pFileTemp, pFileName ) == 0);
+    if ( !fSuccess )
+        printf( "Cannot write checkpoint file \"%s\".\n", pFileName );
+    ABC_FREE( pFileTemp );
+    return fSuccess;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one number of the checkpoint.]
+
+  Description [Same as Vec_StrGetI() but checks the remaining length.
+  Returns 0 if the number does not fit into the contents or if it is not
+  a non-negative integer, which cannot be written by Vec_StrPutI().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Aig_ManCheckpointGetI( Vec_Str_t * vIn, int * pPos, int * pValue )
+{
+    unsigned Val = 0, ch;
+    int i;
+    for ( i = 0; i < 5; i++ )
+    {
+        if ( *pPos >= Vec_StrSize(vIn) )
+            return 0;
+        ch = (unsigned char)Vec_StrEntry( vIn, (*pPos)++ );
+        // the fifth byte holds the remaining 3 bits
+        if ( i == 4 && ch > 7 )
+            return 0;
+        Val |= (ch & 0x7f) << (7 * i);
+        if ( ch & 0x80 )
+            continue;
+        if ( Val > 0x7FFFFFFF )
+            return 0;
+        *pValue = (int)Val;
+        return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the checkpoint from a file.]
+
+  Description [Returns NULL if the file does not exist or if it was
+  written by another engine or for another AIG. Otherwise, returns the
+  contents and sets *pPos to the first byte after the header.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Aig_ManCheckpointRead( Aig_Man_t * p, char * pFileName, char Type, int * pPos )
+{
+    Vec_Str_t * vIn;
+    FILE * pFile;
+    int nFileSize, fMatch, Value;
+    if ( pFileName == NULL || (pFile = fopen( pFileName, "rb" )) == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    vIn = Vec_StrStart( Abc_MaxInt(nFileSize, 0) );
+    fMatch = ((int)fread( Vec_StrArray(vIn), 1, Vec_StrSize(vIn), pFile ) == nFileSize);
+    fclose( pFile );
+    *pPos = 0;
+    // the header takes at least 17 bytes
+    fMatch = fMatch && nFileSize >= 17 &&
+        Vec_StrGetC(vIn, pPos) == 'A' && Vec_StrGetC(vIn, pPos) == 'B' &&
+        Vec_StrGetC(vIn, pPos) == 'C' && Vec_StrGetC(vIn, pPos) == Type &&
+        Aig_ManCheckpointGetI(vIn, pPos, &Value) && Value == AIG_CHECKPOINT_VER;
+    fMatch = fMatch &&
+        Aig_ManCheckpointGetI(vIn, pPos, &Value) && Value == Aig_ManCiNum(p) &&
+        Aig_ManCheckpointGetI(vIn, pPos, &Value) && Value == Aig_ManCoNum(p) &&
+        Aig_ManCheckpointGetI(vIn, pPos, &Value) && Value == Aig_ManRegNum(p) &&
+        Aig_ManCheckpointGetI(vIn, pPos, &Value) && Value == Aig_ManObjNumMax(p) &&
+        Vec_StrSize(vIn) - *pPos >= 8 && Vec_StrGetW(vIn, pPos) == Aig_ManSignature(p);
+    if ( !fMatch )
+    {
+        printf( "Checkpoint file \"%s\" does not match the current design and is ignored.\n", pFileName );
+        Vec_StrFree( vIn );
+        return NULL;
+    }
+    return vIn;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -269,9 +269,13 @@ struct Gia_ParSim_t_
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
     int            fCheckMiter;   // check if miter outputs are non-zero
+    int            fBiased;       // uses biased and targeted patterns
+    char *         pFileTrace;    // file name to write the flop traces
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
 };
+
+typedef struct Gia_SimTrace_t_ Gia_SimTrace_t;
 
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
 struct Gia_ManSim_t_
@@ -285,6 +289,17 @@ struct Gia_ManSim_t_
     unsigned *     pDataSim;     // simulation data
     unsigned *     pDataSimCis;  // simulation data for CIs
     unsigned *     pDataSimCos;  // simulation data for COs
+    // biased pattern generation
+    Gia_Man_t *    pAigOrig;     // original AIG with the same object IDs
+    Vec_Int_t *    vProbs;       // signal probabilities of the objects
+    Vec_Int_t *    vBias;        // biases of the CIs
+    Vec_Int_t *    vVotes;       // CI value requests of the targets
+    Vec_Int_t *    vCube;        // justified CI assignment of one target
+    Vec_Int_t *    vCubes;       // justified CI assignments of this frame
+    Vec_Int_t *    vPiTrace;     // PI simulation data of the leading frames
+    int            iTarget;      // the next object to be targeted
+    int            nTargets;     // the number of targets in this frame
+    int            nBiased;      // the number of biased PIs in this frame
 };
 
 typedef struct Jf_Par_t_ Jf_Par_t; 
@@ -303,6 +318,7 @@ struct Jf_Par_t_
     int            nDelayLut1;
     int            nDelayLut2;
     int            nFastEdges;
+    int            nMemLimit;
     int            DelayTarget;
     int            fAreaOnly;
     int            fPinPerm;
@@ -322,6 +338,7 @@ struct Jf_Par_t_
     int            fDoAverage;
     int            fCutHashing;
     int            fCutSimple;
+    int            fCutStream;
     int            fVerbose;
     int            fVeryVerbose;
     int            nLutSizeMax;
@@ -1369,6 +1386,7 @@ extern void                Gia_ManTransferMapping( Gia_Man_t * p, Gia_Man_t * pG
 extern void                Gia_ManTransferPacking( Gia_Man_t * p, Gia_Man_t * pGia );
 extern void                Gia_ManTransferTiming( Gia_Man_t * p, Gia_Man_t * pGia );
 extern Gia_Man_t *         Gia_ManPerformMapping( Gia_Man_t * p, void * pIfPars );
+extern Gia_Man_t *         Gia_ManPerformMappingInc( Gia_Man_t * p, Gia_Man_t * pOld, void * pIfPars, int nBound );
 extern Gia_Man_t *         Gia_ManPerformSopBalance( Gia_Man_t * p, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalance( Gia_Man_t * p, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupHashMapping( Gia_Man_t * p );
@@ -1464,6 +1482,24 @@ extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
 extern void                Gia_ManSimInfoInit( Gia_ManSim_t * p );
 extern void                Gia_ManSimInfoTransfer( Gia_ManSim_t * p );
 extern void                Gia_ManSimulateRound( Gia_ManSim_t * p );
+/*=== giaSimBias.c ============================================================*/
+extern unsigned            Gia_ManRandomBiased( int Bias );
+extern void                Gia_ManSimBiasFillInfo( unsigned * pInfo, int nWords, int Bias );
+extern void                Gia_ManSimBiasRecord( Vec_Int_t * vProbs, int iObj, unsigned * pInfo, int nWords );
+extern void                Gia_ManSimBiasJustify( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Vec_Int_t * vProbs, Vec_Int_t * vCube );
+extern int                 Gia_ManSimBiasRareValue( Gia_Man_t * p, Vec_Int_t * vProbs, Gia_Obj_t * pObj );
+extern int                 Gia_ManSimBiasIsRare( Gia_Man_t * p, Vec_Int_t * vProbs, Gia_Obj_t * pObj, int Limit );
+extern void                Gia_ManSimBiasAddVotes( Vec_Int_t * vCube, Vec_Int_t * vVotes );
+extern int                 Gia_ManSimBiasDerive( Vec_Int_t * vVotes, Vec_Int_t * vBias );
+/*=== giaSimTrace.c ============================================================*/
+extern Gia_SimTrace_t *    Gia_SimTraceStart( char * pFileName, int nVars, int nWords, int nChunk );
+extern void                Gia_SimTraceAddFrame( Gia_SimTrace_t * p, unsigned * pValues );
+extern word                Gia_SimTraceStop( Gia_SimTrace_t * p );
+extern Gia_SimTrace_t *    Gia_SimTraceOpen( char * pFileName );
+extern int                 Gia_SimTraceFrameNum( Gia_SimTrace_t * p );
+extern int                 Gia_SimTraceVarNum( Gia_SimTrace_t * p );
+extern int                 Gia_SimTraceWordNum( Gia_SimTrace_t * p );
+extern int                 Gia_SimTraceReadFrame( Gia_SimTrace_t * p, int iFrame, unsigned * pValues );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -1550,6 +1586,13 @@ extern void                Gia_ObjComputeTruthTableStop( Gia_Man_t * p );
 extern word *              Gia_ObjComputeTruthTableCut( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vLeaves );
 /*=== giaTsim.c ============================================================*/
 extern Gia_Man_t *         Gia_ManReduceConst( Gia_Man_t * pAig, int fVerbose );
+/*=== giaTtCache.c ===========================================================*/
+extern int                 Gia_TtCacheIsOn();
+extern void                Gia_TtCacheStart();
+extern void                Gia_TtCacheStop();
+extern void                Gia_TtCachePrint();
+extern int                 Gia_TtCacheSave( char * pFileName, void * pManDsd );
+extern int                 Gia_TtCacheLoad( char * pFileName, void ** ppManDsd );
 /*=== giaUtil.c ===========================================================*/
 extern unsigned            Gia_ManRandom( int fReset );
 extern word                Gia_ManRandomW( int fReset );
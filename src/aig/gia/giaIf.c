@@ -2352,6 +2352,386 @@ Gia_Man_t * Gia_ManPerformMapping( Gia_Man_t * p, void * pp )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the delay of the mapped AIG.]
+
+  Description [Uses the same delay model as the incremental mapper:
+  the delay of a LUT depends on its size and is looked up in the LUT
+  library, if given. Otherwise, the unit delay is assumed.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+float Gia_ManMappingIncDelay( Gia_Man_t * p, If_LibLut_t * pLib )
+{
+    Gia_Obj_t * pObj;
+    float * pArrs = ABC_CALLOC( float, Gia_ManObjNum(p) );
+    float Delay = 0;
+    int i, k, iFan;
+    Gia_ManForEachLut( p, i )
+    {
+        Gia_LutForEachFanin( p, i, iFan, k )
+            pArrs[i] = Abc_MaxFloat( pArrs[i], pArrs[iFan] );
+        pArrs[i] += If_CutLutDelay( pLib, Gia_ObjLutSize(p, i), 0 );
+    }
+    Gia_ManForEachCo( p, pObj, i )
+        Delay = Abc_MaxFloat( Delay, pArrs[Gia_ObjFaninId0p(p, pObj)] );
+    ABC_FREE( pArrs );
+    return Delay;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the cut of the node reusing the old LUT.]
+
+  Description [The leaves of the old LUT are given by marking their
+  structural hashing variables. Returns 0 if the cone of the node is not
+  bounded by the marked nodes or if it has more than nLimit leaves.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+int Gia_ManMappingIncCut_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vObj2Hash, Vec_Int_t * vMarks, int Mark, Vec_Int_t * vLeaves, int nLimit )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return 1;
+    Gia_ObjSetTravIdCurrentId(p, iObj);
+    if ( Vec_IntEntry(vMarks, Abc_Lit2Var(Vec_IntEntry(vObj2Hash, iObj))) == Mark )
+    {
+        Vec_IntPush( vLeaves, iObj );
+        return Vec_IntSize(vLeaves) <= nLimit;
+    }
+    pObj = Gia_ManObj( p, iObj );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    if ( !Gia_ManMappingIncCut_rec( p, Gia_ObjFaninId0(pObj, iObj), vObj2Hash, vMarks, Mark, vLeaves, nLimit ) )
+        return 0;
+    return Gia_ManMappingIncCut_rec( p, Gia_ObjFaninId1(pObj, iObj), vObj2Hash, vMarks, Mark, vLeaves, nLimit );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the window to be remapped.]
+
+  Description [The window is bounded by the CIs and the nodes, whose
+  old LUTs are reused.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+void Gia_ManMappingIncWindow_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vCuts, Vec_Int_t * vBound, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj;
+    if ( iObj == 0 || Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId(p, iObj);
+    pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsCi(pObj) || Vec_IntEntry(vCuts, iObj) >= 0 )
+    {
+        Vec_IntPush( vBound, iObj );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_ManMappingIncWindow_rec( p, Gia_ObjFaninId0(pObj, iObj), vCuts, vBound, vNodes );
+    Gia_ManMappingIncWindow_rec( p, Gia_ObjFaninId1(pObj, iObj), vCuts, vBound, vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs incremental LUT mapping.]
+
+  Description [Maps AIG p, which was derived from the mapped AIG pOld by
+  a local change. The nodes of p are matched with the nodes of pOld by
+  structural hashing. If the node of p corresponds to the root of an old
+  LUT, whose leaves correspond to the CIs or to the nodes reusing their
+  old LUTs, the old LUT is reused. In other words, the old mapping is
+  reused outside of the transitive fanout of the change. The remaining
+  nodes form the window, which is mapped by the If mapper using the
+  arrival times of the reused LUTs on the window boundary and the old
+  delay as the required time at the window outputs, so that area recovery
+  is performed locally. If the resulting mapping has the LUT count or the
+  level exceeding those of the old mapping (scaled by the change in the
+  AIG size) by more than nBound percent, the AIG is mapped from scratch.]
+               
+  SideEffects []
+
+  SeeAlso     [] 
+
+***********************************************************************/
+Gia_Man_t * Gia_ManPerformMappingInc( Gia_Man_t * p, Gia_Man_t * pOld, void * pp, int nBound )
+{
+    If_Par_t * pPars = (If_Par_t *)pp, Pars, * pWinPars = &Pars;
+    Gia_Man_t * pHash, * pWin, * pNew, * pFull;
+    If_Man_t * pIfMan;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vObj2Hash, * vHash2Old, * vMarks, * vLeaves;
+    Vec_Int_t * vCuts, * vCutsNew, * vBound, * vNodes, * vRoots, * vWin2Obj, * vWinMap, * vUsed, * vStack;
+    float * pArrs, DelayOld, DelayNew, AreaRef;
+    int i, k, iObj, iOld, iFan, nLeaves, Mark = 0, nReused = 0;
+    int nLutsOld, nLutsNew, nLevelOld, nLevelNew, nAndsOld, nAndsNew = 0;
+    abctime clk = Abc_Clock(), clkInc, clkFull;
+    // check if the incremental mapping applies
+    if ( pPars->fTruth || pPars->fPower || pPars->pLutStruct || pPars->fUseBuffs || pPars->fLatchPaths )
+    {
+        Abc_Print( 0, "Incremental mapping is not supported for the selected options. Performing complete mapping.\n" );
+        return Gia_ManPerformMapping( p, pPars );
+    }
+    if ( Gia_ManHasChoices(p) || p->pManTime || p->vCiArrs || p->vCoReqs || Gia_ManBufNum(p) )
+    {
+        Abc_Print( 0, "Incremental mapping is not supported for AIGs with choices, boxes, or timing info. Performing complete mapping.\n" );
+        return Gia_ManPerformMapping( p, pPars );
+    }
+    if ( pOld == NULL || !Gia_ManHasMapping(pOld) || Gia_ManCiNum(p) != Gia_ManCiNum(pOld) || Gia_ManCoNum(p) != Gia_ManCoNum(pOld) )
+    {
+        Abc_Print( 0, "The saved AIG is not mapped or does not match the current AIG. Performing complete mapping.\n" );
+        return Gia_ManPerformMapping( p, pPars );
+    }
+    // match the nodes by structural hashing
+    pHash = Gia_ManStart( Gia_ManObjNum(p) + Gia_ManObjNum(pOld) );
+    Gia_ManHashAlloc( pHash );
+    for ( i = 0; i < Gia_ManCiNum(p); i++ )
+        Gia_ManAppendCi( pHash );
+    Gia_ManConst0(pOld)->Value = 0;
+    Gia_ManForEachCi( pOld, pObj, i )
+        pObj->Value = Gia_ManCiLit( pHash, i );
+    Gia_ManForEachAnd( pOld, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pHash, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    nAndsOld = Gia_ManAndNum( pHash );
+    vObj2Hash = Vec_IntStart( Gia_ManObjNum(p) );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManCiLit( pHash, i );
+    Gia_ManForEachAnd( p, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pHash, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachObj( p, pObj, i )
+        if ( !Gia_ObjIsCo(pObj) )
+            Vec_IntWriteEntry( vObj2Hash, i, pObj->Value );
+    // among the old nodes with the same structure, prefer the LUT roots
+    vHash2Old = Vec_IntStartFull( Gia_ManObjNum(pHash) );
+    Gia_ManForEachAnd( pOld, pObj, i )
+    {
+        iOld = Vec_IntEntry( vHash2Old, Abc_Lit2Var(pObj->Value) );
+        if ( iOld == -1 || (!Gia_ObjIsLut(pOld, iOld) && Gia_ObjIsLut(pOld, i)) )
+            Vec_IntWriteEntry( vHash2Old, Abc_Lit2Var(pObj->Value), i );
+    }
+    // find the nodes reusing their old LUTs in a topological order
+    vMarks   = Vec_IntStart( Gia_ManObjNum(pHash) );
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( !Vec_IntEntry(vMarks, Abc_Lit2Var(pObj->Value)) )
+        {
+            Vec_IntWriteEntry( vMarks, Abc_Lit2Var(pObj->Value), -1 );
+            nAndsNew++;
+        }
+    vLeaves  = Vec_IntAlloc( 16 );
+    vCuts    = Vec_IntStartFull( Gia_ManObjNum(p) );
+    vCutsNew = Vec_IntAlloc( 1000 );
+    pArrs    = ABC_CALLOC( float, Gia_ManObjNum(p) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        iOld = Vec_IntEntry( vHash2Old, Abc_Lit2Var(Vec_IntEntry(vObj2Hash, i)) );
+        if ( iOld == -1 || !Gia_ObjIsLut(pOld, iOld) )
+            continue;
+        Mark++;
+        Gia_LutForEachFanin( pOld, iOld, iFan, k )
+            Vec_IntWriteEntry( vMarks, Abc_Lit2Var(Gia_ManObj(pOld, iFan)->Value), Mark );
+        Vec_IntClear( vLeaves );
+        Gia_ManIncrementTravId( p );
+        Gia_ObjSetTravIdCurrentId( p, i );
+        if ( !Gia_ManMappingIncCut_rec( p, Gia_ObjFaninId0(pObj, i), vObj2Hash, vMarks, Mark, vLeaves, pPars->nLutSize ) ||
+             !Gia_ManMappingIncCut_rec( p, Gia_ObjFaninId1(pObj, i), vObj2Hash, vMarks, Mark, vLeaves, pPars->nLutSize ) )
+            continue;
+        Vec_IntForEachEntry( vLeaves, iFan, k )
+            if ( !Gia_ObjIsCi(Gia_ManObj(p, iFan)) && Vec_IntEntry(vCuts, iFan) == -1 )
+                break;
+        if ( k < Vec_IntSize(vLeaves) )
+            continue;
+        // save the cut and compute the arrival time
+        Vec_IntSort( vLeaves, 0 );
+        Vec_IntWriteEntry( vCuts, i, Vec_IntSize(vCutsNew) );
+        Vec_IntPush( vCutsNew, Vec_IntSize(vLeaves) );
+        Vec_IntForEachEntry( vLeaves, iFan, k )
+        {
+            Vec_IntPush( vCutsNew, iFan );
+            pArrs[i] = Abc_MaxFloat( pArrs[i], pArrs[iFan] );
+        }
+        pArrs[i] += If_CutLutDelay( pPars->pLutLib, Vec_IntSize(vLeaves), 0 );
+    }
+    Gia_ManStop( pHash );
+    Vec_IntFree( vHash2Old );
+    Vec_IntFree( vMarks );
+    // collect the window
+    vBound = Vec_IntAlloc( 100 );
+    vNodes = Vec_IntAlloc( 100 );
+    vRoots = Vec_IntAlloc( 100 );
+    Gia_ManIncrementTravId( p );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iObj = Gia_ObjFaninId0p( p, pObj );
+        if ( !Gia_ObjIsAnd(Gia_ManObj(p, iObj)) || Vec_IntEntry(vCuts, iObj) >= 0 || Gia_ObjIsTravIdCurrentId(p, iObj) )
+            continue;
+        Gia_ManMappingIncWindow_rec( p, iObj, vCuts, vBound, vNodes );
+        Vec_IntPush( vRoots, iObj );
+    }
+    // map the window
+    vWinMap  = NULL;
+    vWin2Obj = Vec_IntAlloc( 1 + Vec_IntSize(vBound) + Vec_IntSize(vNodes) + Vec_IntSize(vRoots) );
+    if ( Vec_IntSize(vRoots) > 0 )
+    {
+        DelayOld = pPars->DelayTarget != -1 ? pPars->DelayTarget : Gia_ManMappingIncDelay( pOld, pPars->pLutLib );
+        pWin = Gia_ManStart( 1 + Vec_IntSize(vBound) + Vec_IntSize(vNodes) + Vec_IntSize(vRoots) );
+        Gia_ManConst0(p)->Value = 0;
+        Vec_IntPush( vWin2Obj, 0 );
+        Gia_ManForEachObjVec( vBound, p, pObj, i )
+        {
+            pObj->Value = Gia_ManAppendCi( pWin );
+            Vec_IntPush( vWin2Obj, Gia_ObjId(p, pObj) );
+        }
+        Gia_ManForEachObjVec( vNodes, p, pObj, i )
+        {
+            pObj->Value = Gia_ManAppendAnd( pWin, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Vec_IntPush( vWin2Obj, Gia_ObjId(p, pObj) );
+        }
+        Gia_ManForEachObjVec( vRoots, p, pObj, i )
+            Gia_ManAppendCo( pWin, pObj->Value );
+        // set the timing constraints
+        *pWinPars = *pPars;
+        pWinPars->fCutMin = 0;
+        pWinPars->pTimesArr = ABC_ALLOC( float, Vec_IntSize(vBound) );
+        Vec_IntForEachEntry( vBound, iObj, i )
+            pWinPars->pTimesArr[i] = pArrs[iObj];
+        pWinPars->pTimesReq = ABC_ALLOC( float, Vec_IntSize(vRoots) );
+        for ( i = 0; i < Vec_IntSize(vRoots); i++ )
+            pWinPars->pTimesReq[i] = DelayOld;
+        pIfMan = Gia_ManToIf( pWin, pWinPars );
+        if ( If_ManPerformMapping( pIfMan ) )
+            vWinMap = If_ManCollectMappingInt( pIfMan );
+        If_ManStop( pIfMan );
+        Gia_ManStop( pWin );
+        if ( vWinMap == NULL )
+        {
+            pNew = NULL;
+            goto finish;
+        }
+    }
+    // translate the window mapping (vUsed is -2 for the reused LUTs)
+    vUsed = Vec_IntStartFull( Gia_ManObjNum(p) );
+    if ( vWinMap )
+    {
+        for ( i = 0; i < Vec_IntSize(vWinMap); i += nLeaves + 2 )
+        {
+            nLeaves = Vec_IntEntry( vWinMap, i );
+            iObj = Vec_IntEntry( vWin2Obj, Vec_IntEntry(vWinMap, i + nLeaves + 1) );
+            Vec_IntWriteEntry( vUsed, iObj, Vec_IntSize(vCutsNew) );
+            Vec_IntPush( vCutsNew, nLeaves );
+            for ( k = 1; k <= nLeaves; k++ )
+                Vec_IntPush( vCutsNew, Vec_IntEntry(vWin2Obj, Vec_IntEntry(vWinMap, i + k)) );
+        }
+        Vec_IntFree( vWinMap );
+    }
+    // collect the reused LUTs needed by the COs and by the window LUTs
+    vStack = Vec_IntAlloc( 100 );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntPush( vStack, Gia_ObjFaninId0p(p, pObj) );
+    Gia_ManIncrementTravId( p );
+    while ( Vec_IntSize(vStack) > 0 )
+    {
+        iObj = Vec_IntPop( vStack );
+        if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
+            continue;
+        Gia_ObjSetTravIdCurrentId( p, iObj );
+        if ( Vec_IntEntry(vUsed, iObj) >= 0 ) // window LUT
+            iFan = Vec_IntEntry( vUsed, iObj );
+        else if ( Vec_IntEntry(vCuts, iObj) >= 0 ) // reused LUT
+        {
+            iFan = Vec_IntEntry( vCuts, iObj );
+            Vec_IntWriteEntry( vUsed, iObj, -2 );
+            nReused++;
+        }
+        else
+            continue;
+        nLeaves = Vec_IntEntry( vCutsNew, iFan );
+        for ( k = 1; k <= nLeaves; k++ )
+            Vec_IntPush( vStack, Vec_IntEntry(vCutsNew, iFan + k) );
+    }
+    Vec_IntFree( vStack );
+    // create the mapped AIG
+    pNew = Gia_ManDup( p );
+    assert( Gia_ManObjNum(pNew) == Gia_ManObjNum(p) );
+    pNew->vMapping = Vec_IntStart( Gia_ManObjNum(pNew) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( Vec_IntEntry(vUsed, i) == -1 )
+            continue;
+        iObj = Vec_IntEntry(vUsed, i) == -2 ? Vec_IntEntry(vCuts, i) : Vec_IntEntry(vUsed, i);
+        nLeaves = Vec_IntEntry( vCutsNew, iObj );
+        Vec_IntWriteEntry( pNew->vMapping, i, Vec_IntSize(pNew->vMapping) );
+        for ( k = 0; k <= nLeaves; k++ )
+            Vec_IntPush( pNew->vMapping, Vec_IntEntry(vCutsNew, iObj + k) );
+        Vec_IntPush( pNew->vMapping, i );
+    }
+    Gia_ManMappingVerify( pNew );
+    clkInc = Abc_Clock() - clk;
+    // report the results
+    nLutsOld  = Gia_ManLutNum( pOld );
+    nLutsNew  = Gia_ManLutNum( pNew );
+    nLevelOld = Gia_ManLutLevel( pOld, NULL );
+    nLevelNew = Gia_ManLutLevel( pNew, NULL );
+    DelayNew  = Gia_ManMappingIncDelay( pNew, pPars->pLutLib );
+    printf( "Incremental mapping:  Reused LUTs = %d (%.2f %% of %d).  Remapped nodes = %d (%.2f %% of %d).  ", 
+        nReused, 100.0 * nReused / Abc_MaxInt(nLutsOld, 1), nLutsOld, 
+        Vec_IntSize(vNodes), 100.0 * Vec_IntSize(vNodes) / Abc_MaxInt(Gia_ManAndNum(p), 1), Gia_ManAndNum(p) );
+    Abc_PrintTime( 1, "Time", clkInc );
+    printf( "Incremental mapping:  LUT = %d (old = %d).  Level = %d (old = %d).\n", nLutsNew, nLutsOld, nLevelNew, nLevelOld );
+    if ( pPars->fVerbose )
+    {
+        If_Par_t ParsFull = *pPars;
+        clk = Abc_Clock();
+        pFull = Gia_ManPerformMapping( p, &ParsFull );
+        clkFull = Abc_Clock() - clk;
+        if ( pFull )
+        {
+            printf( "Complete mapping:     LUT = %d.  Level = %d.  ", Gia_ManLutNum(pFull), Gia_ManLutLevel(pFull, NULL) );
+            Abc_PrintTime( 1, "Time", clkFull );
+            printf( "Runtime saved = %.2f %%.\n", 100.0 * (clkFull - clkInc) / Abc_MaxInt((int)clkFull, 1) );
+            Gia_ManStop( pFull );
+        }
+    }
+    // check the quality bound (the LUT count is scaled by the change in the size of the strashed AIG)
+    AreaRef = (float)nLutsOld * nAndsNew / Abc_MaxInt(nAndsOld, 1);
+    if ( 100.0 * nLutsNew > (100.0 + nBound) * AreaRef || 100.0 * nLevelNew > (100.0 + nBound) * nLevelOld )
+    {
+        Abc_Print( 0, "Incremental mapping exceeds the quality bound (%d %%). Performing complete mapping.\n", nBound );
+        Gia_ManStop( pNew );
+        pNew = Gia_ManPerformMapping( p, pPars );
+    }
+    else
+    {
+        pNew->MappedDelay = (int)DelayNew;
+        pNew->MappedArea  = nLutsNew;
+    }
+    Vec_IntFree( vUsed );
+finish:
+    Vec_IntFree( vWin2Obj );
+    Vec_IntFree( vBound );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vRoots );
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vCuts );
+    Vec_IntFree( vCutsNew );
+    Vec_IntFree( vObj2Hash );
+    ABC_FREE( pArrs );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Interface of other mapping-based procedures.]
@@ -20,6 +20,7 @@
 
 #include "gia.h"
 #include "misc/vec/vecSet.h"
+#include "misc/util/utilCut.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -319,20 +320,7 @@ static inline void Kf_SetSelectBest( Kf_Set_t * p, int fArea, int fSort )
 ***********************************************************************/
 static inline int Kf_CheckCut( Kf_Cut_t * pBase, Kf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int nSizeB = pBase->nLeaves;
-    int nSizeC = pCut->nLeaves;
-    int * pB = pBase->pLeaves;
-    int * pC = pCut->pLeaves;
-    int i, k;
-    for ( i = 0; i < nSizeC; i++ )
-    {
-        for ( k = 0; k < nSizeB; k++ )
-            if ( pC[i] == pB[k] )
-                break;
-        if ( k == nSizeB )
-            return 0;
-    }
-    return 1;
+    return Abc_CutIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Kf_CheckCuts( Kf_Set_t * p )
 {
@@ -536,21 +524,8 @@ static inline void Kf_SetMerge( Kf_Set_t * p, int * pCuts0, int * pCuts1, int fA
 ***********************************************************************/
 static inline int Kf_SetCutIsContainedSimple( Kf_Cut_t * pBase, Kf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int nSizeB = pBase->nLeaves;
-    int nSizeC = pCut->nLeaves;
-    int * pB = pBase->pLeaves;
-    int * pC = pCut->pLeaves;
-    int i, k;
-    assert( nSizeB >= nSizeC ); 
-    for ( i = 0; i < nSizeC; i++ )
-    {
-        for ( k = 0; k < nSizeB; k++ )
-            if ( pC[i] == pB[k] )
-                break;
-        if ( k == nSizeB )
-            return 0;
-    }
-    return 1;
+    assert( pBase->nLeaves >= pCut->nLeaves );
+    return Abc_CutIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Kf_SetMergeSimpleOne( Kf_Cut_t * pCut0, Kf_Cut_t * pCut1, Kf_Cut_t * pCut, int nLutSize )
 { 
@@ -560,6 +535,9 @@ static inline int Kf_SetMergeSimpleOne( Kf_Cut_t * pCut0, Kf_Cut_t * pCut1, Kf_C
     int * pC1 = pCut1->pLeaves;
     int * pC = pCut->pLeaves;
     int i, k, c;
+    // skip the pairs whose union is too large
+    if ( nSize0 + nSize1 > nLutSize && nSize0 + nSize1 - Abc_CutCountShared(pC0, nSize0, pC1, nSize1) > nLutSize )
+        return 0;
     // compare two cuts with different numbers
     c = nSize0;
     for ( i = 0; i < nSize1; i++ )
@@ -23,6 +23,7 @@
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilCut.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -87,6 +88,7 @@ struct Lf_Man_t_
     Vec_Ptr_t       vMemSets;        // memory for cutsets
     Vec_Int_t       vFreeSets;       // free cutsets
     Vec_Mem_t *     vTtMem;          // truth tables
+    int             fTtCache;        // the truth tables belong to the cache
     Vec_Ptr_t       vFreePages;      // free memory pages
     Lf_Mem_t        vStoreOld;       // previous cuts
     Lf_Mem_t        vStoreNew;       // current cuts
@@ -135,6 +137,7 @@ static inline int         Lf_BestCutIndex( Lf_Bst_t * p )                 { if (
 #define Lf_CutForEachVar( pCut, Var, i )                        for ( i = 0; i < (int)pCut->nLeaves && (Var = pCut->pLeaves[i]); i++ ) if ( Lf_ObjOff(p, Var) < 0 ) {} else
 
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
+extern Vec_Mem_t * Gia_TtCacheTable( int nVars, int fMux7 );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -684,64 +687,10 @@ static inline int Lf_SetCheckArray( Lf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Lf_CutMergeOrder( Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, Lf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = -1;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = -1;
-    pCut->fMux7 = 0;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Abc_CutMergeOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = -1;
     pCut->fMux7 = 0;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
@@ -797,29 +746,7 @@ static inline int Lf_CutMergeOrderMux( Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, Lf_Cu
 
 static inline int Lf_SetCutIsContainedOrder( Lf_Cut_t * pBase, Lf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Abc_CutIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Lf_SetLastCutIsContained( Lf_Cut_t ** pCuts, int nCuts )
 {
@@ -1919,8 +1846,9 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pPars     = pPars;
     p->nCutWords = (sizeof(Lf_Cut_t)/sizeof(int) + pPars->nLutSize + 1) >> 1;
     p->nSetWords = p->nCutWords * pPars->nCutNum;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
-    if ( pPars->fCutMin && pPars->fUseMux7 )
+    p->fTtCache  = pPars->fCutMin && Gia_TtCacheIsOn();
+    p->vTtMem    = pPars->fCutMin ? (p->fTtCache ? Gia_TtCacheTable( pPars->nLutSize, pPars->fUseMux7 ) : Vec_MemAllocForTT( pPars->nLutSize, 0 )) : NULL;
+    if ( pPars->fCutMin && pPars->fUseMux7 && !p->fTtCache )
         Vec_MemAddMuxTT( p->vTtMem, pPars->nLutSize );
     p->pObjBests = ABC_CALLOC( Lf_Bst_t, Gia_ManAndNotBufNum(pGia) );
     Vec_IntGrow( &p->vFreeSets, (1<<14) );
@@ -1947,9 +1875,9 @@ void Lf_ManFree( Lf_Man_t * p )
 {
     ABC_FREE( p->pPars->pTimesArr );
     ABC_FREE( p->pPars->pTimesReq );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && !p->fTtCache )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && !p->fTtCache )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vMemSets );
     Vec_PtrFreeData( &p->vFreePages );
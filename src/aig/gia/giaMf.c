@@ -21,6 +21,8 @@
 #include "gia.h"
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilCut.h"
+#include "misc/mem/mem.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
@@ -69,12 +71,22 @@ struct Mf_Man_t_
     Mf_Obj_t *      pLfObjs;        // best cuts
     Vec_Ptr_t       vPages;         // cut memory
     Vec_Mem_t *     vTtMem;         // truth tables
-    Vec_Int_t       vCnfSizes;      // handles to CNF
+    Vec_Int_t *     vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    int             fTtCache;       // the truth tables belong to the cache
+    // streaming mode
+    Mem_Step_t *    pMemSets;       // memory for compressed cut sets
+    char **         ppSets;         // compressed cut sets of the nodes
+    Vec_Int_t       vSetRefs;       // the number of remaining readers
+    word            nMemSets;       // memory used by compressed cut sets
+    // memory limit
+    int             nCutNumCur;     // the current cut limit
+    int             nCapped;        // nodes with the reduced cut limit
+    word            nMemPeak;       // the peak memory used by cuts
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -95,10 +107,18 @@ static inline int        Mf_CutFunc( int * pCut )                    { return ((
 static inline int        Mf_CutSetBoth( int n, int f )               { return n | (f << 5);                                            }
 static inline int        Mf_CutIsTriv( int * pCut, int i )           { return Mf_CutSize(pCut) == 1 && pCut[1] == i;                   } 
 
+static inline int        Mf_ManCnfSizeIsKnown( Mf_Man_t * p, int i ) { return i < Vec_IntSize(p->vCnfSizes) && Vec_IntEntry(p->vCnfSizes, i) >= 0; }
+static inline word       Mf_ManCutMemory( Mf_Man_t * p )             { return (word)sizeof(int) * p->iCur + p->nMemSets;               }
+
 #define Mf_SetForEachCut( pList, pCut, i )      for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += Mf_CutSize(pCut) + 1 )
 #define Mf_ObjForEachCut( pCuts, i, nCuts )     for ( i = 0, i < nCuts; i++ )
 
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
+extern Vec_Mem_t * Gia_TtCacheTable( int nVars, int fMux7 );
+extern Vec_Int_t * Gia_TtCacheCnfSizes( int nVars );
+
+static void Mf_ManSetSetRefs( Mf_Man_t * p );
+static void Mf_ObjSaveCutsStream( Mf_Man_t * p, int iObj, Mf_Cut_t ** pCuts, int nCuts );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -217,7 +237,7 @@ void Mf_ManProfileTruths( Mf_Man_t * p )
 {
     Vec_Int_t * vCounts;
     int i, Entry, * pCut, Counter = 0;
-    vCounts = Vec_IntStart( Vec_IntSize(&p->vCnfSizes) );
+    vCounts = Vec_IntStart( Vec_IntSize(p->vCnfSizes) );
     Gia_ManForEachAndId( p->pGia, i )
     {
         if ( !Mf_ObjMapRefNum(p, i) )
@@ -232,7 +252,7 @@ void Mf_ManProfileTruths( Mf_Man_t * p )
         printf( "%6d : ", Counter++ );
         printf( "%6d : ", i );
         printf( "Occur = %4d  ", Entry ); 
-        printf( "CNF size = %2d  ", Vec_IntEntry(&p->vCnfSizes, i) );
+        printf( "CNF size = %2d  ", Vec_IntEntry(p->vCnfSizes, i) );
         Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, i), p->pPars->nLutSize );
     }
     Vec_IntFree( vCounts );
@@ -270,9 +290,9 @@ static inline int Mf_ManCountLits( int * pCnf, int nCubes, int nVars )
 Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pnLits )
 {
     int i, k, iFunc, nCubes, nLits, * pCut, pCnf[512];
-    Vec_Int_t * vLits = Vec_IntStart( Vec_IntSize(&p->vCnfSizes) );
-    Vec_Int_t * vCnfs = Vec_IntAlloc( 3 * Vec_IntSize(&p->vCnfSizes) );
-    Vec_IntFill( vCnfs, Vec_IntSize(&p->vCnfSizes), -1 );
+    Vec_Int_t * vLits = Vec_IntStart( Vec_IntSize(p->vCnfSizes) );
+    Vec_Int_t * vCnfs = Vec_IntAlloc( 3 * Vec_IntSize(p->vCnfSizes) );
+    Vec_IntFill( vCnfs, Vec_IntSize(p->vCnfSizes), -1 );
     assert( p->pPars->nLutSize <= 8 );
     // constant/buffer
     for ( iFunc = 0; iFunc < 2; iFunc++ )
@@ -305,7 +325,7 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
                 nCubes = Abc_Tt6Cnf( *Vec_MemReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
             else
                 nCubes = Abc_Tt8Cnf( Vec_MemReadEntry(p->vTtMem, iFunc), Mf_CutSize(pCut), pCnf );
-            assert( nCubes == Vec_IntEntry(&p->vCnfSizes, iFunc) );
+            assert( nCubes == Vec_IntEntry(p->vCnfSizes, iFunc) );
             nLits = Mf_ManCountLits( pCnf, nCubes, Mf_CutSize(pCut) );
             // save CNF
             Vec_IntWriteEntry( vLits, iFunc, nLits );
@@ -315,7 +335,7 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
                 Vec_IntPush( vCnfs, pCnf[k] );
         }
         *pnVars += 1;
-        *pnClas += Vec_IntEntry(&p->vCnfSizes, iFunc);
+        *pnClas += Vec_IntEntry(p->vCnfSizes, iFunc);
         *pnLits += Vec_IntEntry(vLits, iFunc);
     }
     Vec_IntFree( vLits );
@@ -551,8 +571,8 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     assert( (int)(t & 1) == 0 );
     truthId        = Vec_MemHashInsert(p->vTtMem, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
+    if ( p->pPars->fGenCnf && !Mf_ManCnfSizeIsKnown(p, truthId) )
+        Vec_IntSetEntryFull( p->vCnfSizes, truthId, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
 //    p->nCutMux += Mf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
 //    Mf_ManTruthCanonicize( &t, pCutR->nLeaves );
@@ -582,8 +602,8 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
     truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
+    if ( p->pPars->fGenCnf && !Mf_ManCnfSizeIsKnown(p, truthId) && LutSize <= 8 )
+        Vec_IntSetEntryFull( p->vCnfSizes, truthId, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
@@ -606,8 +626,8 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     assert( (int)(t & 1) == 0 );
     truthId        = Vec_MemHashInsert(p->vTtMem, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
+    if ( p->pPars->fGenCnf && !Mf_ManCnfSizeIsKnown(p, truthId) )
+        Vec_IntSetEntryFull( p->vCnfSizes, truthId, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
 }
@@ -636,8 +656,8 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     assert( (uTruth[0] & 1) == 0 );
     truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
+    if ( p->pPars->fGenCnf && !Mf_ManCnfSizeIsKnown(p, truthId) && LutSize <= 8 )
+        Vec_IntSetEntryFull( p->vCnfSizes, truthId, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
@@ -692,14 +712,53 @@ static inline void Mf_CutPrint( Mf_Man_t * p, Mf_Cut_t * pCut )
     if ( p->vTtMem )
     {
         if ( p->pPars->fGenCnf )
-            printf( "CNF = %2d  ", Vec_IntEntry(&p->vCnfSizes, Abc_Lit2Var(pCut->iFunc)) );
+            printf( "CNF = %2d  ", Vec_IntEntry(p->vCnfSizes, Abc_Lit2Var(pCut->iFunc)) );
         Dau_DsdPrintFromTruth( Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc)), pCut->nLeaves );
     }
     else
         printf( "\n" );
 }
+static inline void Mf_ManReleaseCuts( Mf_Man_t * p, int iObj )
+{
+    unsigned char * pSet = (unsigned char *)p->ppSets[iObj];
+    int nBytes = pSet[0] | (pSet[1] << 8);
+    if ( --*Vec_IntEntryP(&p->vSetRefs, iObj) > 0 )
+        return;
+    Mem_StepEntryRecycle( p->pMemSets, (char *)pSet, nBytes );
+    p->nMemSets -= nBytes;
+    p->ppSets[iObj] = NULL;
+}
+static inline int Mf_ManPrepareCutsStream( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, int fAddUnit )
+{
+    Mf_Cut_t * pMfCut = pCuts;
+    unsigned char * pPos = (unsigned char *)p->ppSets[iObj] + 2;
+    int i, k, Prev, nCuts = Gia_AigerReadUnsigned( &pPos );
+    unsigned Entry;
+    for ( i = 0; i < nCuts; i++, pMfCut++ )
+    {
+        Entry = Gia_AigerReadUnsigned( &pPos );
+        pMfCut->Delay   = 0;
+        pMfCut->Flow    = 0;
+        pMfCut->iFunc   = ((Entry >> 5) - 1) & MF_NO_FUNC;
+        pMfCut->nLeaves = Entry & MF_NO_LEAF;
+        for ( Prev = iObj, k = pMfCut->nLeaves - 1; k >= 0; k-- )
+        {
+            Entry = Gia_AigerReadUnsigned( &pPos );
+            Prev -= Abc_LitIsCompl(Entry) ? -Abc_Lit2Var(Entry) : Abc_Lit2Var(Entry);
+            pMfCut->pLeaves[k] = Prev;
+        }
+        pMfCut->Sign    = Mf_CutGetSign( pMfCut->pLeaves, pMfCut->nLeaves );
+    }
+    Mf_ManReleaseCuts( p, iObj );
+    if ( fAddUnit && pCuts->nLeaves > 1 )
+        return nCuts + Mf_CutCreateUnit( pMfCut, iObj );
+    return nCuts;
+}
 static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, int fAddUnit )
 {
+    if ( p->ppSets && p->ppSets[iObj] )
+        return Mf_ManPrepareCutsStream( pCuts, p, iObj, fAddUnit );
+    assert( p->ppSets == NULL || !Mf_ManObj(p, iObj)->iCutSet );
     if ( Mf_ManObj(p, iObj)->iCutSet )
     {
         Mf_Cut_t * pMfCut = pCuts;
@@ -720,17 +779,19 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocCuts( Mf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1;
-    for ( i = 0; i < nCuts; i++ )
-        nInts += pCuts[i]->nLeaves + 1;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
-    pPlace = Mf_ManCutSet( p, iCur );
+    return iCur;
+}
+static inline int * Mf_ManWriteCuts( int * pPlace, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i;
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
     {
@@ -738,8 +799,40 @@ static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
         memcpy( pPlace, pCuts[i]->pLeaves, sizeof(int) * pCuts[i]->nLeaves );
         pPlace += pCuts[i]->nLeaves;
     }
+    return pPlace;
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, iCur, nInts = 1;
+    for ( i = 0; i < nCuts; i++ )
+        nInts += pCuts[i]->nLeaves + 1;
+    iCur = Mf_ManAllocCuts( p, nInts );
+    Mf_ManWriteCuts( Mf_ManCutSet(p, iCur), pCuts, nCuts );
     return iCur;
 }
+// the compressed cut set stores the number of bytes, the number of cuts, and, for each cut,
+// the size/function followed by the leaves in the reverse order, each as the distance from the previous one
+static inline char * Mf_ManSaveCutsStream( Mf_Man_t * p, int iObj, Mf_Cut_t ** pCuts, int nCuts )
+{
+    unsigned char pBuffer[MF_CUT_MAX * (MF_LEAF_MAX + 1) * 5 + 8];
+    int i, k, Prev, Diff, nBytes = Gia_AigerWriteUnsignedBuffer( pBuffer, 2, nCuts );
+    char * pSet;
+    for ( i = 0; i < nCuts; i++ )
+    {
+        nBytes = Gia_AigerWriteUnsignedBuffer( pBuffer, nBytes, pCuts[i]->nLeaves | ((unsigned)((pCuts[i]->iFunc + 1) & MF_NO_FUNC) << 5) );
+        for ( Prev = iObj, k = pCuts[i]->nLeaves - 1; k >= 0; Prev = pCuts[i]->pLeaves[k--] )
+        {
+            Diff = Prev - pCuts[i]->pLeaves[k];
+            nBytes = Gia_AigerWriteUnsignedBuffer( pBuffer, nBytes, Abc_Var2Lit(Abc_AbsInt(Diff), Diff < 0) );
+        }
+    }
+    pBuffer[0] = (unsigned char)(nBytes & 0xFF);
+    pBuffer[1] = (unsigned char)(nBytes >> 8);
+    pSet = Mem_StepEntryFetch( p->pMemSets, nBytes );
+    memcpy( pSet, pBuffer, nBytes );
+    p->nMemSets += nBytes;
+    return pSet;
+}
 static inline void Mf_ObjSetBestCut( int * pCuts, int * pCut )
 {
     assert( pCuts < pCut );
@@ -823,63 +916,10 @@ static inline int Mf_SetCheckArray( Mf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Mf_CutMergeOrder( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = MF_NO_FUNC;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = MF_NO_FUNC;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Abc_CutMergeOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize == -1 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = MF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
     return 1;
@@ -910,29 +950,7 @@ static inline int Mf_CutMergeOrderMux( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cu
 }
 static inline int Mf_SetCutIsContainedOrder( Mf_Cut_t * pBase, Mf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Abc_CutIsContained( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Mf_SetLastCutIsContained( Mf_Cut_t ** pCuts, int nCuts )
 {
@@ -993,7 +1011,7 @@ static inline int Mf_CutArea( Mf_Man_t * p, int nLeaves, int iFunc )
     if ( nLeaves < 2 )
         return 0;
     if ( p->pPars->fGenCnf )
-        return Vec_IntEntry(&p->vCnfSizes, Abc_Lit2Var(iFunc));
+        return Vec_IntEntry(p->vCnfSizes, Abc_Lit2Var(iFunc));
     if ( p->pPars->fOptEdge )
         return nLeaves + p->pPars->nAreaTuner;
     return 1;
@@ -1014,13 +1032,27 @@ static inline void Mf_CutParams( Mf_Man_t * p, Mf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Mf_CutArea(p, nLeaves, pCut->iFunc)) / FlowRefs;
 }
+static inline int Mf_ManUpdateCutNum( Mf_Man_t * p, int iObj )
+{
+    word nMemCuts = Mf_ManCutMemory( p );
+    double MemLimit = (double)p->pPars->nMemLimit * (1 << 20);
+    // without streaming, the cut memory only grows, so the limit is distributed among the nodes
+    if ( p->pMemSets == NULL )
+        MemLimit *= (double)iObj / Gia_ManObjNum(p->pGia);
+    if ( nMemCuts > MemLimit && p->nCutNumCur > 2 )
+        p->nCutNumCur--;
+    else if ( nMemCuts < 0.75 * MemLimit && p->nCutNumCur < p->pPars->nCutNum )
+        p->nCutNumCur++;
+    p->nCapped += (p->nCutNumCur < p->pPars->nCutNum);
+    return p->nCutNumCur;
+}
 void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
 {
     Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX], pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
     Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
     int nLutSize = p->pPars->nLutSize;
-    int nCutNum  = p->pPars->nCutNum;
+    int nCutNum  = p->pPars->nMemLimit ? Mf_ManUpdateCutNum(p, iObj) : p->pPars->nCutNum;
     int nCuts0   = Mf_ManPrepareCuts(pCuts0, p, Gia_ObjFaninId0(pObj, iObj), 1);
     int nCuts1   = Mf_ManPrepareCuts(pCuts1, p, Gia_ObjFaninId1(pObj, iObj), 1);
     int fComp0   = Gia_ObjFaninC0(pObj);
@@ -1105,7 +1137,11 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     // store the cutset
     pBest->Flow = pCutsR[0]->Flow;
     pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    if ( p->pMemSets )
+        Mf_ObjSaveCutsStream( p, iObj, pCutsR, nCutsR );
+    else
+        pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    p->nMemPeak = Abc_MaxWord( p->nMemPeak, Mf_ManCutMemory(p) );
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
@@ -1384,15 +1420,27 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->clkStart  = Abc_Clock();
     p->pGia      = pGia;
     p->pPars     = pPars;
-    p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
+    p->fTtCache  = pPars->fCutMin && Gia_TtCacheIsOn();
+    p->vTtMem    = pPars->fCutMin ? (p->fTtCache ? Gia_TtCacheTable( pPars->nLutSize, 0 ) : Vec_MemAllocForTT( pPars->nLutSize, 0 )) : NULL;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
+    p->nCutNumCur = pPars->nCutNum;
+    if ( pPars->fCutStream )
+    {
+        p->pMemSets = Mem_StepStart( 8 );
+        p->ppSets   = ABC_CALLOC( char *, Gia_ManObjNum(pGia) );
+    }
     if ( pPars->fGenCnf )
     {
-        Vec_IntGrow( &p->vCnfSizes, 10000 );
-        Vec_IntPush( &p->vCnfSizes, 1 );
-        Vec_IntPush( &p->vCnfSizes, 2 );
+        if ( p->fTtCache )
+            p->vCnfSizes = Gia_TtCacheCnfSizes( pPars->nLutSize );
+        else
+        {
+            p->vCnfSizes = Vec_IntAlloc( 10000 );
+            Vec_IntPush( p->vCnfSizes, 1 );
+            Vec_IntPush( p->vCnfSizes, 2 );
+        }
         Vec_IntGrow( &p->vCnfMem, 10000 );
     }
     vFlowRefs = Vec_IntAlloc(0);
@@ -1404,13 +1452,18 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 }
 void Mf_ManFree( Mf_Man_t * p )
 {
-    assert( !p->pPars->fGenCnf || Vec_IntSize(&p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
-    if ( p->pPars->fCutMin )
+    assert( !p->pPars->fGenCnf || p->fTtCache || Vec_IntSize(p->vCnfSizes) == Vec_MemEntryNum(p->vTtMem) );
+    if ( p->pPars->fCutMin && !p->fTtCache )
         Vec_MemHashFree( p->vTtMem );
-    if ( p->pPars->fCutMin )
+    if ( p->pPars->fCutMin && !p->fTtCache )
         Vec_MemFree( p->vTtMem );
+    if ( !p->fTtCache )
+        Vec_IntFreeP( &p->vCnfSizes );
     Vec_PtrFreeData( &p->vPages );
-    ABC_FREE( p->vCnfSizes.pArray );
+    if ( p->pMemSets )
+        Mem_StepStop( p->pMemSets, 0 );
+    ABC_FREE( p->ppSets );
+    ABC_FREE( p->vSetRefs.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vTemp.pArray );
@@ -1441,6 +1494,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->nCoarseLimit =  3;
     pPars->nAreaTuner   =  1;
     pPars->nVerbLimit   =  5;
+    pPars->nMemLimit    =  0;
     pPars->DelayTarget  = -1;
     pPars->fAreaOnly    =  0;
     pPars->fOptEdge     =  1; 
@@ -1448,6 +1502,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fCutMin      =  0;
     pPars->fGenCnf      =  0;
     pPars->fPureAig     =  0;
+    pPars->fCutStream   =  0;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
@@ -1477,6 +1532,9 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "CutMin = %d  ",  p->pPars->fCutMin );
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
+    printf( "Stream = %d  ",  p->pPars->fCutStream );
+    if ( p->pPars->nMemLimit )
+    printf( "MemLimit = %d MB  ", p->pPars->nMemLimit );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -1486,6 +1544,8 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
     float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
+    float MemSets  = p->pMemSets ? 1.0 * Mem_StepReadMemUsage(p->pMemSets) / (1<<20) : 0;
+    float MemPeak  = 1.0 * p->nMemPeak / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
@@ -1496,13 +1556,16 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     printf( "Merge = %.0f (%.2f %%)  ", p->CutCount[1], 100.0*p->CutCount[1]/p->CutCount[0] );
     printf( "Eval = %.0f (%.2f %%)  ",  p->CutCount[2], 100.0*p->CutCount[2]/p->CutCount[0] );
     printf( "Cut = %.0f (%.2f %%)  ",   p->CutCount[3], 100.0*p->CutCount[3]/p->CutCount[0] );
+    if ( p->pPars->nMemLimit )
+    printf( "Capped = %d  ",            p->nCapped );
     printf( "\n" );
     printf( "Gia = %.2f MB  ",          MemGia );
     printf( "Man = %.2f MB  ",          MemMan ); 
-    printf( "Cut = %.2f MB   ",         MemCuts );
+    printf( "Cut = %.2f MB   ",         MemCuts + MemSets );
+    printf( "Peak = %.2f MB   ",        MemPeak );
     printf( "Map = %.2f MB  ",          MemMap ); 
     printf( "TT = %.2f MB  ",           MemTt ); 
-    printf( "Total = %.2f MB",          MemGia + MemMan + MemCuts + MemMap + MemTt ); 
+    printf( "Total = %.2f MB",          MemGia + MemMan + MemCuts + MemSets + MemMap + MemTt ); 
     printf( "\n" );
     if ( 1 )
     {
@@ -1518,8 +1581,11 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
 void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
+    if ( p->pMemSets )
+        Mf_ManSetSetRefs( p );
     Gia_ManForEachAndId( p->pGia, i )
         Mf_ObjMergeOrder( p, i );
+    assert( p->nMemSets == 0 );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1594,10 +1660,9 @@ static inline float Mf_CutFlow( Mf_Man_t * p, int * pCut, int * pTime )
     *pTime = Time + 1;
     return Flow + Mf_CutArea(p, Mf_CutSize(pCut), Mf_CutFunc(pCut));
 }
-static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
+static inline int * Mf_ObjFindBestCut( Mf_Man_t * p, int iObj, int * pCutSet )
 {
     Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
-    int * pCutSet = Mf_ObjCutSet( p, iObj );
     int * pCut, * pCutBest = NULL;
     int Value1 = -1, Value2 = -1;
     int i, Time = 0, TimeBest = ABC_INFINITY; 
@@ -1622,10 +1687,66 @@ static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
         Mf_CutFlow( p, pCutBest, &TimeBest );
     pBest->Delay = TimeBest;
     pBest->Flow  = FlowBest / Mf_ManObj(p, iObj)->nFlowRefs;
-    Mf_ObjSetBestCut( pCutSet, pCutBest );
+    return pCutBest;
+}
+static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
+{
+    int * pCutSet = Mf_ObjCutSet( p, iObj );
+    Mf_ObjSetBestCut( pCutSet, Mf_ObjFindBestCut(p, iObj, pCutSet) );
 //    Mf_CutPrint( Mf_ObjCutBest(p, iObj) ); printf( "\n" );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Cut computation with the bounded memory.]
+
+  Description [In the streaming mode, the cuts are recomputed in each 
+  round. The cut set of a node is kept in the compressed form until it
+  is read by all fanouts. Only the best cut of a node is stored permanently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Mf_ManSetSetRefs( Mf_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    Vec_IntFill( &p->vSetRefs, Gia_ManObjNum(p->pGia), 0 );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+    {
+        Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId0(pObj, i), 1 );
+        Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId1(pObj, i), 1 );
+        if ( Gia_ObjIsMuxId(p->pGia, i) )
+            Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjFaninId2(p->pGia, i), 1 );
+        if ( Gia_ObjSibl(p->pGia, i) )
+            Vec_IntAddToEntry( &p->vSetRefs, Gia_ObjSibl(p->pGia, i), 1 );
+    }
+}
+static void Mf_ObjSaveCutsStream( Mf_Man_t * p, int iObj, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int pCutSet[MF_CUT_MAX * (MF_LEAF_MAX + 1) + 1];
+    Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
+    int * pPlace, * pCutBest;
+    if ( Vec_IntEntry(&p->vSetRefs, iObj) > 0 )
+        p->ppSets[iObj] = Mf_ManSaveCutsStream( p, iObj, pCuts, nCuts );
+    // the best cut of the previous round remains a candidate
+    pPlace = Mf_ManWriteCuts( pCutSet, pCuts, nCuts );
+    if ( pBest->iCutSet )
+    {
+        pCutBest = Mf_ObjCutBest( p, iObj );
+        memcpy( pPlace, pCutBest, sizeof(int) * (Mf_CutSize(pCutBest) + 1) );
+        pCutSet[0]++;
+    }
+    else
+    {
+        pBest->iCutSet = Mf_ManAllocCuts( p, p->pPars->nLutSize + 2 );
+        Mf_ObjCutSet(p, iObj)[0] = 1;
+    }
+    pCutBest = Mf_ObjFindBestCut( p, iObj, pCutSet );
+    memcpy( Mf_ObjCutBest(p, iObj), pCutBest, sizeof(int) * (Mf_CutSize(pCutBest) + 1) );
+}
+
 
 /**Function*************************************************************
 
@@ -1641,6 +1762,11 @@ static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
 void Mf_ManComputeMapping( Mf_Man_t * p )
 {
     int i;
+    if ( p->pMemSets )
+    {
+        Mf_ManComputeCuts( p );
+        return;
+    }
     Gia_ManForEachAndId( p->pGia, i )
         Mf_ObjComputeBestCut( p, i );
     Mf_ManSetMapRefs( p );
@@ -101,6 +101,8 @@ struct Nf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    int             nCutNumCur;     // the current cut limit
+    int             nCapped;        // nodes with the reduced cut limit
     int             nInvs;          // the inverter count
     int             InvDelayI;      // inverter delay
     word            InvAreaW;       // inverter delay
@@ -381,6 +383,7 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pPars    = pPars;
     p->pNfObjs  = ABC_CALLOC( Nf_Obj_t, Gia_ManObjNum(pGia) );
     p->iCur     = 2;
+    p->nCutNumCur = pPars->nCutNum;
     // other
     Vec_PtrGrow( &p->vPages, 256 );                                    // cut memory
     Vec_IntFill( &p->vMapRefs,  2*Gia_ManObjNum(pGia), 0 );            // mapping refs   (2x)
@@ -849,6 +852,18 @@ static inline void Nf_CutParams( Nf_Man_t * p, Nf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Nf_CutArea(p, nLeaves)) / FlowRefs;
 }
+static inline int Nf_ManUpdateCutNum( Nf_Man_t * p, int iObj )
+{
+    // the cut memory only grows, so the limit is distributed among the nodes
+    double MemCuts  = (double)sizeof(int) * p->iCur;
+    double MemLimit = (double)p->pPars->nMemLimit * (1 << 20) * iObj / Gia_ManObjNum(p->pGia);
+    if ( MemCuts > MemLimit && p->nCutNumCur > 2 )
+        p->nCutNumCur--;
+    else if ( MemCuts < 0.75 * MemLimit && p->nCutNumCur < p->pPars->nCutNum )
+        p->nCutNumCur++;
+    p->nCapped += (p->nCutNumCur < p->pPars->nCutNum);
+    return p->nCutNumCur;
+}
 void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
 {
     Nf_Cut_t pCuts0[NF_CUT_MAX], pCuts1[NF_CUT_MAX], pCuts[NF_CUT_MAX], * pCutsR[NF_CUT_MAX];
@@ -856,7 +871,7 @@ void Nf_ObjMergeOrder( Nf_Man_t * p, int iObj )
     //Nf_Obj_t * pBest = Nf_ManObj(p, iObj);
     float dFlowRefs  = Nf_ObjFlowRefs(p, iObj, 0) + Nf_ObjFlowRefs(p, iObj, 1);
     int nLutSize = p->pPars->nLutSize;
-    int nCutNum  = p->pPars->nCutNum;
+    int nCutNum  = p->pPars->nMemLimit ? Nf_ManUpdateCutNum(p, iObj) : p->pPars->nCutNum;
     int nCuts0   = Nf_ManPrepareCuts(pCuts0, p, Gia_ObjFaninId0(pObj, iObj), 1);
     int nCuts1   = Nf_ManPrepareCuts(pCuts1, p, Gia_ObjFaninId1(pObj, iObj), 1);
     int fComp0   = Gia_ObjFaninC0(pObj);
@@ -1028,6 +1043,8 @@ void Nf_ManPrintQuit( Nf_Man_t * p )
     printf( "Cut = %.0f (%.1f)  ",      p->CutCount[3], 1.0*p->CutCount[3]/Gia_ManAndNum(p->pGia) );
     printf( "Use = %.0f (%.1f)  ",      p->CutCount[4], 1.0*p->CutCount[4]/Gia_ManAndNum(p->pGia) );
     printf( "Mat = %.0f (%.1f)  ",      p->CutCount[5], 1.0*p->CutCount[5]/Gia_ManAndNum(p->pGia) );
+    if ( p->pPars->nMemLimit )
+    printf( "Capped = %d  ",            p->nCapped );
 //    printf( "Equ = %d (%.2f %%)  ",     p->nCutUseAll,  100.0*p->nCutUseAll /p->CutCount[0] );
     printf( "\n" );
     printf( "Gia = %.2f MB  ",          MemGia );
@@ -2341,6 +2358,7 @@ void Nf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->nAreaTuner   =  0;
     pPars->nReqTimeFlex =  0;
     pPars->nVerbLimit   =  5;
+    pPars->nMemLimit    =  0;
     pPars->DelayTarget  = -1;
     pPars->fAreaOnly    =  0;
     pPars->fPinPerm     =  0;
@@ -21,6 +21,7 @@
 #include "gia.h"
 #include "sat/cnf/cnf.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilDimacs.h"
 #include "sat/satoko/satoko.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -96,60 +97,51 @@ void Gia_ManSatokoReport( int iOutput, int status, abctime clk )
 
     Abc_PrintTime( 1, "Time", clk );
 }
-satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
+// returns 1 if the solver is loaded, 0 upon immediate conflict, and -1 if the file cannot be read
+int Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts, satoko_t ** ppSat )
 {
-	satoko_t * pSat = satoko_create();
-    char * pBuffer = Extra_FileReadContents( pFileName );
-    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
-    char * pTemp; int fComp, Var, VarMax = 0;
-    for ( pTemp = pBuffer; *pTemp; pTemp++ )
+    satoko_t * pSat;
+    Abc_Dim_t * pDim = Abc_DimStart( pFileName );
+    Vec_Int_t * vLits;
+    int RetValue = 1;
+    *ppSat = NULL;
+    if ( pDim == NULL )
+        return -1;
+    pSat  = satoko_create();
+    vLits = Vec_IntAlloc( 100 );
+    Abc_DimForEachClause( pDim, vLits )
     {
-        if ( *pTemp == 'c' || *pTemp == 'p' ) 
-        {
-            while ( *pTemp != '\n' )
-                pTemp++;
-            continue;
-        }
-        while ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
-            pTemp++;
-        fComp = 0;
-        if ( *pTemp == '-' )
-            fComp = 1, pTemp++;
-        if ( *pTemp == '+' )
-            pTemp++;
-        Var = atoi( pTemp );
-        if ( Var == 0 ) {
-            if ( Vec_IntSize(vLits) > 0 ) 
-            {
-                satoko_setnvars( pSat, VarMax+1 );
-                if ( !satoko_add_clause( pSat, Vec_IntArray(vLits), Vec_IntSize(vLits) ) )
-                {
-                    satoko_destroy(pSat);
-                    Vec_IntFree( vLits );
-                    ABC_FREE( pBuffer );
-                    return NULL;
-                }
-                Vec_IntClear( vLits );
-            }
-        }
-        else 
+        satoko_setnvars( pSat, pDim->nVarsMax );
+        if ( Vec_IntSize(vLits) == 0 || !satoko_add_clause( pSat, Vec_IntArray(vLits), Vec_IntSize(vLits) ) )
         {
-            Var--;
-            VarMax = Abc_MaxInt( VarMax, Var );
-            Vec_IntPush( vLits, Abc_Var2Lit(Var, fComp) );
+            RetValue = 0;
+            break;
         }
-        while ( *pTemp >= '0' && *pTemp <= '9' )
-            pTemp++;
     }
-    ABC_FREE( pBuffer );
+    if ( pDim->fError )
+        RetValue = -1;
+    Abc_DimStop( pDim );
     Vec_IntFree( vLits );
-    return pSat;
+    if ( RetValue != 1 )
+    {
+        satoko_destroy( pSat );
+        return RetValue;
+    }
+    satoko_configure( pSat, opts );
+    *ppSat = pSat;
+    return 1;
 }
 void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
 {
     abctime clk = Abc_Clock();  
+    satoko_t * pSat;
     int status = SATOKO_UNSAT;
-    satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts );
+    int RetValue = Gia_ManSatokoFromDimacs( pFileName, opts, &pSat );
+    if ( RetValue == -1 )
+    {
+        Abc_Print( -1, "Gia_ManSatokoDimacs(): Cannot read DIMACS file \"%s\".\n", pFileName );
+        return;
+    }
     if ( pSat )
     {
         status = satoko_solve( pSat );
@@ -31,6 +31,9 @@ static inline unsigned * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->p
 static inline unsigned * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
 static inline unsigned * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
 
+// the largest number of words in the PI trace of the biased simulation
+#define GIA_SIM_TRACE_MAX  (1 << 22)
+
 unsigned * Gia_SimDataExt( Gia_ManSim_t * p, int i )    { return Gia_SimData(p, i);    }
 unsigned * Gia_SimDataCiExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCi(p, i);  }
 unsigned * Gia_SimDataCoExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCo(p, i);  }
@@ -170,6 +173,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
+    p->fBiased      =   0;    // uses biased and targeted patterns
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
 }
@@ -189,6 +193,12 @@ void Gia_ManSimDelete( Gia_ManSim_t * p )
 {
     Vec_IntFreeP( &p->vConsts );
     Vec_IntFreeP( &p->vCis2Ids );
+    Vec_IntFreeP( &p->vProbs );
+    Vec_IntFreeP( &p->vBias );
+    Vec_IntFreeP( &p->vVotes );
+    Vec_IntFreeP( &p->vCube );
+    Vec_IntFreeP( &p->vCubes );
+    Vec_IntFreeP( &p->vPiTrace );
     Gia_ManStopP( &p->pAig );
     ABC_FREE( p->pDataSim );
     ABC_FREE( p->pDataSimCis );
@@ -233,6 +243,16 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     p->vCis2Ids = Vec_IntAlloc( Gia_ManCiNum(p->pAig) );
     Vec_IntForEachEntry( pAig->vCis, Entry, i )
         Vec_IntPush( p->vCis2Ids, i );  //  do we need p->vCis2Ids?
+    if ( pPars->fBiased )
+    {
+        p->pAigOrig = pAig;
+        p->vProbs   = Vec_IntStartFull( Gia_ManObjNum(p->pAig) );
+        p->vBias    = Vec_IntAlloc( Gia_ManCiNum(p->pAig) );
+        p->vVotes   = Vec_IntAlloc( 2 * Gia_ManCiNum(p->pAig) );
+        p->vCube    = Vec_IntAlloc( 100 );
+        p->vCubes   = Vec_IntAlloc( 1000 );
+        p->vPiTrace = Vec_IntAlloc( (int)Abc_MinWord( (word)p->nWords * Gia_ManPiNum(p->pAig) * pPars->nIters, GIA_SIM_TRACE_MAX ) );
+    }
     if ( pPars->fVerbose )
     Abc_Print( 1, "AIG = %7.2f MB.   Front mem = %7.2f MB.  Other mem = %7.2f MB.\n", 
         12.0*Gia_ManObjNum(p->pAig)/(1<<20), 
@@ -415,6 +435,91 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Generates biased and targeted PI patterns of this frame.]
+
+  Description [Targets are the miter outputs (to be asserted) and the 
+  nodes and flop inputs whose values rarely change (to be set to the 
+  rare value).
+  Each target is justified to the CIs using the signal probabilities of
+  the previous frames. The resulting PI assignments are written into the
+  leading patterns, while the PI biases derived from them are used to
+  generate the remaining patterns. The PI data of the leading frames is 
+  recorded to derive the counter-example.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimInfoBiased( Gia_ManSim_t * p )
+{
+    Gia_Man_t * pAig = p->pAigOrig; // the frontier AIG cannot be traversed
+    Gia_Obj_t * pObj;
+    unsigned * pInfo;
+    int * pCube;
+    int i, k, w, iObj, Value, iPat = 0;
+    int nTargetsMax = 32 * p->nWords / 4;
+    Vec_IntFill( p->vVotes, 2 * Gia_ManCiNum(p->pAig), 0 );
+    Vec_IntFill( p->vBias, Gia_ManCiNum(p->pAig), 8 );
+    Vec_IntClear( p->vCubes );
+    // justify the targets
+    p->nTargets = 0;
+    for ( k = 0; k < Gia_ManObjNum(pAig) && p->nTargets < nTargetsMax; k++ )
+    {
+        iObj = (p->iTarget + k) % Gia_ManObjNum(pAig);
+        pObj = Gia_ManObj( pAig, iObj );
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+                continue;
+            if ( Gia_ObjIsPo(pAig, pObj) )
+            {
+                if ( !p->pPars->fCheckMiter )
+                    continue;
+                Value = 1;
+            }
+            else
+            {
+                if ( !Gia_ManSimBiasIsRare(pAig, p->vProbs, pObj, 1) )
+                    continue;
+                Value = Gia_ManSimBiasRareValue( pAig, p->vProbs, pObj );
+            }
+            Gia_ManSimBiasJustify( pAig, Gia_ObjFanin0(pObj), Value ^ Gia_ObjFaninC0(pObj), p->vProbs, p->vCube );
+        }
+        else if ( Gia_ObjIsAnd(pObj) && Gia_ManSimBiasIsRare(pAig, p->vProbs, pObj, 1) )
+            Gia_ManSimBiasJustify( pAig, pObj, Gia_ManSimBiasRareValue(pAig, p->vProbs, pObj), p->vProbs, p->vCube );
+        else
+            continue;
+        Gia_ManSimBiasAddVotes( p->vCube, p->vVotes );
+        Vec_IntPush( p->vCubes, Vec_IntSize(p->vCube) );
+        Vec_IntAppend( p->vCubes, p->vCube );
+        p->nTargets++;
+    }
+    p->iTarget = (p->iTarget + k) % Gia_ManObjNum(pAig);
+    // generate the patterns
+    p->nBiased = Gia_ManSimBiasDerive( p->vVotes, p->vBias );
+    for ( i = 0; i < Gia_ManPiNum(p->pAig); i++ )
+        Gia_ManSimBiasFillInfo( Gia_SimDataCi(p, i), p->nWords, Vec_IntEntry(p->vBias, i) );
+    // write the justified assignments into the leading patterns
+    for ( pCube = Vec_IntArray(p->vCubes); pCube < Vec_IntLimit(p->vCubes); pCube += 1 + pCube[0], iPat++ )
+        for ( k = 1; k <= pCube[0]; k++ )
+        {
+            if ( Abc_Lit2Var(pCube[k]) >= Gia_ManPiNum(p->pAig) )
+                continue;
+            pInfo = Gia_SimDataCi( p, Abc_Lit2Var(pCube[k]) );
+            if ( Abc_InfoHasBit(pInfo, iPat) == Abc_LitIsCompl(pCube[k]) )
+                Abc_InfoXorBit( pInfo, iPat );
+        }
+    // record the PI data of the leading frames
+    if ( p->vPiTrace == NULL || Vec_IntSize(p->vPiTrace) + Gia_ManPiNum(p->pAig) * p->nWords > GIA_SIM_TRACE_MAX )
+        return;
+    for ( i = 0; i < Gia_ManPiNum(p->pAig); i++ )
+        for ( w = 0; w < p->nWords; w++ )
+            Vec_IntPush( p->vPiTrace, (int)Gia_SimDataCi(p, i)[w] );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -431,11 +536,13 @@ void Gia_ManSimInfoInit( Gia_ManSim_t * p )
     int iPioNum, i;
     Vec_IntForEachEntry( p->vCis2Ids, iPioNum, i )
     {
-        if ( iPioNum < Gia_ManPiNum(p->pAig) )
-            Gia_ManSimInfoRandom( p, Gia_SimDataCi(p, i) );
-        else
+        if ( iPioNum >= Gia_ManPiNum(p->pAig) )
             Gia_ManSimInfoZero( p, Gia_SimDataCi(p, i) );
+        else if ( p->vProbs == NULL )
+            Gia_ManSimInfoRandom( p, Gia_SimDataCi(p, i) );
     }
+    if ( p->vProbs )
+        Gia_ManSimInfoBiased( p );
 }
 
 /**Function*************************************************************
@@ -454,11 +561,13 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
     int iPioNum, i;
     Vec_IntForEachEntry( p->vCis2Ids, iPioNum, i )
     {
-        if ( iPioNum < Gia_ManPiNum(p->pAig) )
-            Gia_ManSimInfoRandom( p, Gia_SimDataCi(p, i) );
-        else
+        if ( iPioNum >= Gia_ManPiNum(p->pAig) )
             Gia_ManSimInfoCopy( p, Gia_SimDataCi(p, i), Gia_SimDataCo(p, Gia_ManPoNum(p->pAig)+iPioNum-Gia_ManPiNum(p->pAig)) );
+        else if ( p->vProbs == NULL )
+            Gia_ManSimInfoRandom( p, Gia_SimDataCi(p, i) );
     }
+    if ( p->vProbs )
+        Gia_ManSimInfoBiased( p );
 }
 
 /**Function*************************************************************
@@ -485,16 +594,23 @@ void Gia_ManSimulateRound( Gia_ManSim_t * p )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
             Gia_ManSimulateNode( p, pObj );
+            if ( p->vProbs )
+                Gia_ManSimBiasRecord( p->vProbs, i, Gia_SimData(p, Gia_ObjValue(pObj)), p->nWords );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos, pObj );
+            if ( p->vProbs )
+                Gia_ManSimBiasRecord( p->vProbs, i, Gia_SimDataCo(p, iCos), p->nWords );
+            iCos++;
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
             Gia_ManSimulateCi( p, pObj, iCis++ );
+            if ( p->vProbs )
+                Gia_ManSimBiasRecord( p->vProbs, i, Gia_SimData(p, Gia_ObjValue(pObj)), p->nWords );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
@@ -584,6 +700,100 @@ void Gia_ManResetRandom( Gia_ParSim_t * pPars )
         Gia_ManRandom( 0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the counter-example of the biased simulation.]
+
+  Description [Biased patterns cannot be derived from the random seed
+  alone, because they depend on the signal probabilities. The PI data
+  is taken from the trace if the frame is recorded there. Otherwise,
+  simulation is repeated from the same seed, which reproduces the same
+  probabilities and patterns, and the PI values of the failed pattern
+  are collected frame by frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Gia_ManGenerateCounterTrace( Gia_ManSim_t * p, int iFrame, int iOut, int iPat )
+{
+    Gia_ManSim_t * pNew;
+    Abc_Cex_t * pCex;
+    unsigned * pData;
+    int f, i, nPis = Gia_ManPiNum(p->pAig), fVerbose = p->pPars->fVerbose;
+    pCex = Abc_CexAlloc( Gia_ManRegNum(p->pAig), nPis, iFrame+1 );
+    pCex->iFrame = iFrame;
+    pCex->iPo    = iOut;
+    if ( (word)Vec_IntSize(p->vPiTrace) >= (word)(iFrame + 1) * nPis * p->nWords )
+    {
+        for ( f = 0; f <= iFrame; f++ )
+        for ( i = 0; i < nPis; i++ )
+        {
+            pData = (unsigned *)Vec_IntEntryP( p->vPiTrace, (f * nPis + i) * p->nWords );
+            if ( Abc_InfoHasBit( pData, iPat ) )
+                Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * nPis + i );
+        }
+        return pCex;
+    }
+    p->pPars->fVerbose = 0;
+    pNew = Gia_ManSimCreate( p->pAigOrig, p->pPars );
+    p->pPars->fVerbose = fVerbose;
+    if ( pNew == NULL )
+    {
+        Abc_CexFree( pCex );
+        return NULL;
+    }
+    Vec_IntFreeP( &pNew->vPiTrace );
+    Gia_ManResetRandom( p->pPars );
+    Gia_ManSimInfoInit( pNew );
+    for ( f = 0; f <= iFrame; f++ )
+    {
+        for ( i = 0; i < nPis; i++ )
+            if ( Abc_InfoHasBit( Gia_SimDataCi(pNew, i), iPat ) )
+                Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * nPis + i );
+        if ( f == iFrame )
+            break;
+        Gia_ManSimulateRound( pNew );
+        Gia_ManSimInfoTransfer( pNew );
+    }
+    Gia_ManSimDelete( pNew );
+    Gia_ManResetRandom( p->pPars );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Closes the flop trace and reports its size.]
+
+  Description [In the verbose mode, reads back the last frame of the
+  trace and compares it with the current flop values.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimTraceFinish( Gia_ManSim_t * p, Gia_SimTrace_t * pTrace )
+{
+    int nFrames = Gia_SimTraceFrameNum( pTrace );
+    int nWordsAll = Gia_ManRegNum(p->pAig) * p->nWords;
+    word nBytes = Gia_SimTraceStop( pTrace );
+    Abc_Print( 1, "Flop trace of %d frames is written into file \"%s\" (%.2f MB, compression %.2f).\n", 
+        nFrames, p->pPars->pFileTrace, 1.0*nBytes/(1<<20), nBytes ? 4.0*nWordsAll*nFrames/nBytes : 0.0 );
+    if ( p->pPars->fVerbose && nFrames > 0 )
+    {
+        unsigned * pValues = ABC_ALLOC( unsigned, nWordsAll + 1 );
+        pTrace = Gia_SimTraceOpen( p->pPars->pFileTrace );
+        if ( pTrace == NULL || !Gia_SimTraceReadFrame( pTrace, nFrames-1, pValues ) ||
+             memcmp( pValues, Gia_SimDataCi(p, Gia_ManPiNum(p->pAig)), sizeof(unsigned) * nWordsAll ) )
+            Abc_Print( 1, "The last frame of the trace cannot be read back correctly.\n" );
+        if ( pTrace )
+            Gia_SimTraceStop( pTrace );
+        ABC_FREE( pValues );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -599,6 +809,7 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
 {
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
+    Gia_SimTrace_t * pTrace = NULL;
     abctime clkTotal = Abc_Clock();
     int i, iOut, iPat, RetValue = 0;
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
@@ -606,21 +817,30 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_ManSimCreate( pAig, pPars );
+    if ( pPars->pFileTrace )
+        pTrace = Gia_SimTraceStart( pPars->pFileTrace, Gia_ManRegNum(pAig), p->nWords, 0 );
     Gia_ManResetRandom( pPars );
     Gia_ManSimInfoInit( p );
     for ( i = 0; i < pPars->nIters; i++ )
     {
         Gia_ManSimulateRound( p );
+        if ( pTrace )
+            Gia_SimTraceAddFrame( pTrace, Gia_SimDataCi(p, Gia_ManPiNum(pAig)) );
         if ( pPars->fVerbose )
         {
             Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
+            if ( p->vProbs )
+                Abc_Print( 1, "Targets = %5d. Biased PIs = %5d. ", p->nTargets, p->nBiased );
             Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
         }
         if ( pPars->fCheckMiter && Gia_ManCheckPos( p, &iOut, &iPat ) )
         {
             Gia_ManResetRandom( pPars );
             pPars->iOutFail = iOut;
-            pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, p->nWords, iPat, p->vCis2Ids );
+            if ( p->vPiTrace )
+                pAig->pCexSeq = Gia_ManGenerateCounterTrace( p, i, iOut, iPat );
+            else
+                pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, p->nWords, iPat, p->vCis2Ids );
             Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", iOut, pAig->pName, i );
             if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
             {
@@ -646,6 +866,8 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         if ( i < pPars->nIters - 1 )
             Gia_ManSimInfoTransfer( p );
     }
+    if ( pTrace )
+        Gia_ManSimTraceFinish( p, pTrace );
     Gia_ManSimDelete( p );
     if ( pAig->pCexSeq == NULL )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
@@ -0,0 +1,273 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimBias.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Biased and targeted random pattern generation.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaSimBias.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// signal probabilities are measured in units of 1/GIA_PROB_ONE
+#define GIA_PROB_ONE  1024
+// CI biases are measured in units of 1/16 and kept in this range
+#define GIA_BIAS_MIN     2
+#define GIA_BIAS_MAX    14
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns a random word with the given density of ones.]
+
+  Description [Each bit is 1 with probability Bias/16. The bits are
+  produced by comparing a 4-bit random number with Bias bit-parallel.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Gia_ManRandomBiased( int Bias )
+{
+    unsigned uLess = 0;
+    int b;
+    assert( Bias >= 0 && Bias <= 16 );
+    if ( Bias == 16 )
+        return ~0;
+    for ( b = 0; b < 4; b++ )
+        if ( (Bias >> b) & 1 )
+            uLess |= ~Gia_ManRandom(0);
+        else
+            uLess &= ~Gia_ManRandom(0);
+    return uLess;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Fills simulation info of one CI.]
+
+  Description [Even words are biased, odd words are uniformly random,
+  so that the uniform distribution is never lost completely.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBiasFillInfo( unsigned * pInfo, int nWords, int Bias )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pInfo[w] = (w & 1) ? Gia_ManRandom(0) : Gia_ManRandomBiased(Bias);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates signal probabilities of the object.]
+
+  Description [Should be called after the object is simulated.
+  The probability is smoothed over consecutive rounds.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBiasRecord( Vec_Int_t * vProbs, int iObj, unsigned * pInfo, int nWords )
+{
+    int w, nOnes = 0, Prob, ProbOld;
+    for ( w = 0; w < nWords; w++ )
+        nOnes += Gia_WordCountOnes( pInfo[w] );
+    Prob = (int)(((word)nOnes * GIA_PROB_ONE) / (32 * nWords));
+    ProbOld = Vec_IntEntry( vProbs, iObj );
+    Vec_IntWriteEntry( vProbs, iObj, ProbOld < 0 ? Prob : (ProbOld + Prob) / 2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the probability that the literal is 1.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManSimBiasProb( Gia_Man_t * p, Vec_Int_t * vProbs, Gia_Obj_t * pObj, int Value )
+{
+    int Prob = Vec_IntEntry( vProbs, Gia_ObjId(p, pObj) );
+    if ( Prob < 0 )
+        Prob = GIA_PROB_ONE / 2;
+    return Value ? Prob : GIA_PROB_ONE - Prob;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Backtraces the objective to the CIs.]
+
+  Description [Similar to the backtrace in PODEM: if all fanins should be
+  set to the non-controlling value, the hardest fanin is justified first,
+  otherwise only the easiest fanin is set to the controlling value.
+  Controllability is estimated using signal probabilities.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBiasJustify_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Vec_Int_t * vProbs, Vec_Int_t * vCube )
+{
+    Gia_Obj_t * pFan0, * pFan1;
+    int Value0, Value1, Prob0, Prob1;
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p, pObj);
+    if ( Gia_ObjIsConst0(pObj) )
+        return;
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( vCube, Abc_Var2Lit(Gia_ObjCioId(pObj), Value == 0) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    pFan0  = Gia_ObjFanin0(pObj);
+    pFan1  = Gia_ObjFanin1(pObj);
+    // the fanin values are both non-controlling (Value == 1) or both controlling (Value == 0)
+    Value0 = Value ^ Gia_ObjFaninC0(pObj);
+    Value1 = Value ^ Gia_ObjFaninC1(pObj);
+    Prob0 = Gia_ManSimBiasProb( p, vProbs, pFan0, Value0 );
+    Prob1 = Gia_ManSimBiasProb( p, vProbs, pFan1, Value1 );
+    if ( Value == 1 )
+    {
+        if ( Prob0 <= Prob1 )
+        {
+            Gia_ManSimBiasJustify_rec( p, pFan0, Value0, vProbs, vCube );
+            Gia_ManSimBiasJustify_rec( p, pFan1, Value1, vProbs, vCube );
+        }
+        else
+        {
+            Gia_ManSimBiasJustify_rec( p, pFan1, Value1, vProbs, vCube );
+            Gia_ManSimBiasJustify_rec( p, pFan0, Value0, vProbs, vCube );
+        }
+    }
+    else if ( Prob0 >= Prob1 )
+        Gia_ManSimBiasJustify_rec( p, pFan0, Value0, vProbs, vCube );
+    else
+        Gia_ManSimBiasJustify_rec( p, pFan1, Value1, vProbs, vCube );
+}
+void Gia_ManSimBiasJustify( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Vec_Int_t * vProbs, Vec_Int_t * vCube )
+{
+    Vec_IntClear( vCube );
+    Gia_ManIncrementTravId( p );
+    Gia_ManSimBiasJustify_rec( p, pObj, Value, vProbs, vCube );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the rare value of the object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimBiasRareValue( Gia_Man_t * p, Vec_Int_t * vProbs, Gia_Obj_t * pObj )
+{
+    return Gia_ManSimBiasProb( p, vProbs, pObj, 1 ) < GIA_PROB_ONE / 2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the object rarely changes its value.]
+
+  Description [The threshold is given in units of 1/16.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimBiasIsRare( Gia_Man_t * p, Vec_Int_t * vProbs, Gia_Obj_t * pObj, int Limit )
+{
+    int Prob = Gia_ManSimBiasProb( p, vProbs, pObj, 1 );
+    return Prob * 16 < Limit * GIA_PROB_ONE || (GIA_PROB_ONE - Prob) * 16 < Limit * GIA_PROB_ONE;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Accumulates the CI votes of the cube.]
+
+  Description [vVotes has two entries for each CI, the number of
+  requests for value 0 and value 1, respectively.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBiasAddVotes( Vec_Int_t * vCube, Vec_Int_t * vVotes )
+{
+    int i, Lit;
+    Vec_IntForEachEntry( vCube, Lit, i )
+        Vec_IntAddToEntry( vVotes, Abc_Var2Lit(Abc_Lit2Var(Lit), !Abc_LitIsCompl(Lit)), 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CI biases from the votes.]
+
+  Description [Returns the number of CIs whose bias differs from 1/2.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimBiasDerive( Vec_Int_t * vVotes, Vec_Int_t * vBias )
+{
+    int i, n0, n1, Bias, Counter = 0;
+    assert( Vec_IntSize(vVotes) == 2 * Vec_IntSize(vBias) );
+    for ( i = 0; i < Vec_IntSize(vBias); i++ )
+    {
+        n0 = Vec_IntEntry( vVotes, 2*i+0 );
+        n1 = Vec_IntEntry( vVotes, 2*i+1 );
+        Bias = (n0 + n1) ? 8 + (6 * (n1 - n0)) / (n0 + n1) : 8;
+        Bias = Abc_MinInt( Abc_MaxInt(Bias, GIA_BIAS_MIN), GIA_BIAS_MAX );
+        Vec_IntWriteEntry( vBias, i, Bias );
+        Counter += (Bias != 8);
+    }
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,433 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimTrace.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed storage of sequential simulation traces.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaSimTrace.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The trace file stores the values of nVars signals (for example, flops)
+    under nWords*32 simulation patterns in each frame. The number of
+    signals can be zero (a design without flops); such a frame is stored
+    as a single varint zero.
+
+    header : magic, version, nVars, nWords, nChunk (five 32-bit numbers)
+    chunks : each chunk stores up to nChunk consecutive frames;
+             the first frame is XOR-ed with zero, other frames with the
+             previous frame; the resulting words are written as a sequence
+             of (number of zero words, non-zero word) pairs encoded as
+             7-bit varints, ending with the number of trailing zero words
+    index  : the file offset of each chunk (8 bytes each)
+    footer : nChunks, nFrames, offset of the index (8 bytes), magic
+
+    Since chunks are self-contained, any frame can be restored by decoding
+    at most nChunk frames. The writer keeps in memory only one chunk.
+*/
+
+#define GIA_TRACE_MAGIC    0x52545347  // "GSTR"
+#define GIA_TRACE_VERSION  1
+
+struct Gia_SimTrace_t_
+{
+    FILE *        pFile;        // the trace file
+    int           fWrite;       // the trace is being written
+    int           nVars;        // the number of signals
+    int           nWords;       // the number of words per signal
+    int           nChunk;       // the number of frames in one chunk
+    int           nFrames;      // the number of frames
+    Vec_Wrd_t *   vIndex;       // chunk offsets
+    unsigned *    pPrev;        // values in the previous frame
+    // writing
+    Vec_Str_t *   vChunk;       // the current chunk
+    int           nChunkFrames; // the number of frames in the current chunk
+    // reading
+    int           iFrameCur;    // the frame currently in pPrev (or -1)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Binary I/O helpers.]
+
+  Description [The reading helpers return 0 if the file ends early or
+  the number does not fit into 32 bits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_SimTraceWriteInt( FILE * pFile, unsigned Num )
+{
+    unsigned char pBuffer[4];
+    int i;
+    for ( i = 0; i < 4; i++ )
+        pBuffer[i] = (unsigned char)(Num >> (8*i));
+    fwrite( pBuffer, 1, 4, pFile );
+}
+static inline int Gia_SimTraceReadInt( FILE * pFile, unsigned * pNum )
+{
+    unsigned char pBuffer[4];
+    int i;
+    *pNum = 0;
+    if ( fread( pBuffer, 1, 4, pFile ) != 4 )
+        return 0;
+    for ( i = 0; i < 4; i++ )
+        *pNum |= (unsigned)pBuffer[i] << (8*i);
+    return 1;
+}
+static inline int Gia_SimTraceReadWord( FILE * pFile, word * pNum )
+{
+    unsigned Lo, Hi;
+    if ( !Gia_SimTraceReadInt(pFile, &Lo) || !Gia_SimTraceReadInt(pFile, &Hi) )
+        return 0;
+    *pNum = (word)Lo | ((word)Hi << 32);
+    return 1;
+}
+static inline void Gia_SimTracePushVarint( Vec_Str_t * vStr, unsigned Num )
+{
+    while ( Num & ~0x7F )
+    {
+        Vec_StrPush( vStr, (char)((Num & 0x7F) | 0x80) );
+        Num >>= 7;
+    }
+    Vec_StrPush( vStr, (char)Num );
+}
+static inline int Gia_SimTraceGetVarint( FILE * pFile, unsigned * pNum )
+{
+    int c, i;
+    *pNum = 0;
+    for ( i = 0; i < 32 && (c = fgetc(pFile)) != EOF; i += 7 )
+    {
+        if ( i == 28 && (c & 0x70) )
+            return 0;
+        *pNum |= (unsigned)(c & 0x7F) << i;
+        if ( (c & 0x80) == 0 )
+            return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts writing the trace.]
+
+  Description [nChunk is the number of frames in one chunk.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SimTrace_t * Gia_SimTraceStart( char * pFileName, int nVars, int nWords, int nChunk )
+{
+    Gia_SimTrace_t * p;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open trace file \"%s\" for writing.\n", pFileName );
+        return NULL;
+    }
+    p = ABC_CALLOC( Gia_SimTrace_t, 1 );
+    p->pFile   = pFile;
+    p->fWrite  = 1;
+    p->nVars   = nVars;
+    p->nWords  = nWords;
+    p->nChunk  = nChunk > 0 ? nChunk : 1024;
+    p->vIndex  = Vec_WrdAlloc( 100 );
+    p->vChunk  = Vec_StrAlloc( 1 << 16 );
+    p->pPrev   = ABC_CALLOC( unsigned, nVars * nWords );
+    Gia_SimTraceWriteInt( pFile, GIA_TRACE_MAGIC );
+    Gia_SimTraceWriteInt( pFile, GIA_TRACE_VERSION );
+    Gia_SimTraceWriteInt( pFile, nVars );
+    Gia_SimTraceWriteInt( pFile, nWords );
+    Gia_SimTraceWriteInt( pFile, p->nChunk );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the current chunk into the file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimTraceFlushChunk( Gia_SimTrace_t * p )
+{
+    if ( p->nChunkFrames == 0 )
+        return;
+    Vec_WrdPush( p->vIndex, (word)ftell(p->pFile) );
+    fwrite( Vec_StrArray(p->vChunk), 1, Vec_StrSize(p->vChunk), p->pFile );
+    Vec_StrClear( p->vChunk );
+    p->nChunkFrames = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one frame to the trace.]
+
+  Description [pValues contains nWords words for each of nVars signals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimTraceAddFrame( Gia_SimTrace_t * p, unsigned * pValues )
+{
+    int i, nTotal = p->nVars * p->nWords, nZeros = 0;
+    unsigned Delta;
+    assert( p->fWrite );
+    if ( p->nChunkFrames == 0 )
+        memset( p->pPrev, 0, sizeof(unsigned) * nTotal );
+    for ( i = 0; i < nTotal; i++ )
+    {
+        Delta = pValues[i] ^ p->pPrev[i];
+        p->pPrev[i] = pValues[i];
+        if ( Delta == 0 )
+        {
+            nZeros++;
+            continue;
+        }
+        Gia_SimTracePushVarint( p->vChunk, nZeros );
+        Gia_SimTracePushVarint( p->vChunk, Delta );
+        nZeros = 0;
+    }
+    Gia_SimTracePushVarint( p->vChunk, nZeros );
+    p->nFrames++;
+    if ( ++p->nChunkFrames == p->nChunk )
+        Gia_SimTraceFlushChunk( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finishes writing the trace.]
+
+  Description [Returns the size of the file in bytes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Gia_SimTraceStop( Gia_SimTrace_t * p )
+{
+    word Offset, Entry, nBytes = 0;
+    int i;
+    if ( p->fWrite )
+    {
+        Gia_SimTraceFlushChunk( p );
+        Offset = (word)ftell( p->pFile );
+        Vec_WrdForEachEntry( p->vIndex, Entry, i )
+        {
+            Gia_SimTraceWriteInt( p->pFile, (unsigned)(Entry & 0xFFFFFFFF) );
+            Gia_SimTraceWriteInt( p->pFile, (unsigned)(Entry >> 32) );
+        }
+        Gia_SimTraceWriteInt( p->pFile, Vec_WrdSize(p->vIndex) );
+        Gia_SimTraceWriteInt( p->pFile, p->nFrames );
+        Gia_SimTraceWriteInt( p->pFile, (unsigned)(Offset & 0xFFFFFFFF) );
+        Gia_SimTraceWriteInt( p->pFile, (unsigned)(Offset >> 32) );
+        Gia_SimTraceWriteInt( p->pFile, GIA_TRACE_MAGIC );
+        nBytes = (word)ftell( p->pFile );
+    }
+    fclose( p->pFile );
+    Vec_WrdFreeP( &p->vIndex );
+    Vec_StrFreeP( &p->vChunk );
+    ABC_FREE( p->pPrev );
+    ABC_FREE( p );
+    return nBytes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the trace for reading.]
+
+  Description [Checks the header, the footer and the index for
+  consistency with each other and with the size of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SimTrace_t * Gia_SimTraceOpen( char * pFileName )
+{
+    Gia_SimTrace_t * p;
+    word Offset, Entry, nBytes;
+    unsigned Magic, Version, nVars, nWords, nChunk, nChunks, nFrames;
+    int i;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open trace file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    if ( !Gia_SimTraceReadInt(pFile, &Magic) || Magic != GIA_TRACE_MAGIC || 
+         !Gia_SimTraceReadInt(pFile, &Version) || Version != GIA_TRACE_VERSION )
+    {
+        printf( "File \"%s\" is not a simulation trace.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    if ( !Gia_SimTraceReadInt(pFile, &nVars) || !Gia_SimTraceReadInt(pFile, &nWords) || !Gia_SimTraceReadInt(pFile, &nChunk) ||
+         nWords == 0 || nChunk == 0 || (word)nVars * nWords > 0x7FFFFFFF / sizeof(unsigned) )
+    {
+        printf( "Trace file \"%s\" has an invalid header.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    // read the footer
+    fseek( pFile, 0, SEEK_END );
+    nBytes = (word)ftell( pFile );
+    if ( nBytes < 40 || fseek( pFile, -20, SEEK_END ) ||
+         !Gia_SimTraceReadInt(pFile, &nChunks) || !Gia_SimTraceReadInt(pFile, &nFrames) || 
+         !Gia_SimTraceReadWord(pFile, &Offset) || !Gia_SimTraceReadInt(pFile, &Magic) || Magic != GIA_TRACE_MAGIC || 
+         nFrames > 0x7FFFFFFF || nChunks != (nFrames + nChunk - 1) / nChunk || 
+         Offset < 20 || Offset + 8 * (word)nChunks + 20 != nBytes )
+    {
+        printf( "Trace file \"%s\" is incomplete.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    p = ABC_CALLOC( Gia_SimTrace_t, 1 );
+    p->pFile     = pFile;
+    p->nVars     = (int)nVars;
+    p->nWords    = (int)nWords;
+    p->nChunk    = (int)nChunk;
+    p->nFrames   = (int)nFrames;
+    p->pPrev     = ABC_CALLOC( unsigned, p->nVars * p->nWords );
+    p->iFrameCur = -1;
+    // read the index
+    p->vIndex = Vec_WrdAlloc( nChunks );
+    fseek( pFile, (long)Offset, SEEK_SET );
+    for ( i = 0; i < (int)nChunks; i++ )
+    {
+        if ( !Gia_SimTraceReadWord(pFile, &Entry) || Entry < 20 || Entry >= Offset )
+        {
+            printf( "Trace file \"%s\" has an invalid index.\n", pFileName );
+            Gia_SimTraceStop( p );
+            return NULL;
+        }
+        Vec_WrdPush( p->vIndex, Entry );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the parameters of the trace.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimTraceFrameNum( Gia_SimTrace_t * p ) { return p->nFrames; }
+int Gia_SimTraceVarNum( Gia_SimTrace_t * p )   { return p->nVars;   }
+int Gia_SimTraceWordNum( Gia_SimTrace_t * p )  { return p->nWords;  }
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the next frame of the current chunk.]
+
+  Description [Returns 0 if the data is truncated or if the number of
+  zero words points beyond the end of the frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_SimTraceDecodeFrame( Gia_SimTrace_t * p )
+{
+    unsigned nZeros, Delta, i = 0, nTotal = (unsigned)(p->nVars * p->nWords);
+    while ( 1 )
+    {
+        if ( !Gia_SimTraceGetVarint(p->pFile, &nZeros) || nZeros > nTotal - i )
+            return 0;
+        i += nZeros;
+        if ( i == nTotal )
+            return 1;
+        if ( !Gia_SimTraceGetVarint(p->pFile, &Delta) )
+            return 0;
+        p->pPrev[i++] ^= Delta;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one frame of the trace.]
+
+  Description [Copies nVars*nWords words into pValues. Frames can be
+  accessed in any order; sequential access decodes each frame once.
+  Returns 0 if the frame does not exist or cannot be decoded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimTraceReadFrame( Gia_SimTrace_t * p, int iFrame, unsigned * pValues )
+{
+    int iChunk = iFrame / p->nChunk;
+    assert( !p->fWrite );
+    if ( iFrame < 0 || iFrame >= p->nFrames )
+        return 0;
+    // restart if the frame is not reachable from the current one
+    if ( p->iFrameCur < 0 || p->iFrameCur > iFrame || p->iFrameCur / p->nChunk != iChunk )
+    {
+        fseek( p->pFile, (long)Vec_WrdEntry(p->vIndex, iChunk), SEEK_SET );
+        memset( p->pPrev, 0, sizeof(unsigned) * p->nVars * p->nWords );
+        p->iFrameCur = iChunk * p->nChunk - 1;
+    }
+    while ( p->iFrameCur < iFrame )
+    {
+        if ( !Gia_SimTraceDecodeFrame( p ) )
+        {
+            p->iFrameCur = -1;
+            return 0;
+        }
+        p->iFrameCur++;
+    }
+    memcpy( pValues, p->pPrev, sizeof(unsigned) * p->nVars * p->nWords );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,373 @@
+/**CFile****************************************************************
+
+  FileName    [giaTtCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Persistent cache of the functions of the LUT mappers.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaTtCache.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/vec/vecMem.h"
+#include "map/if/if.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the cache keeps the truth tables computed by &mf and &lf across the runs,
+// so that the mappers do not rebuild the tables and the CNF sizes each time;
+// the cache file can also include the DSD manager used by "if -n" and "&if -n"
+
+#define GIA_TT_CACHE_MAX   16
+#define GIA_TT_CACHE_VER   "ttc1"
+
+typedef struct Gia_TtCache_t_ Gia_TtCache_t;
+struct Gia_TtCache_t_
+{
+    Vec_Mem_t *      vTtMems[2][GIA_TT_CACHE_MAX+1]; // truth tables (the second set has MUX as entry 2)
+    Vec_Int_t *      vCnfSizes[GIA_TT_CACHE_MAX+1];  // CNF sizes of the first set (-1 if unknown)
+};
+
+static Gia_TtCache_t * s_pTtCache = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_TtCacheIsOn()
+{
+    return s_pTtCache != NULL;
+}
+void Gia_TtCacheStart()
+{
+    if ( s_pTtCache == NULL )
+        s_pTtCache = ABC_CALLOC( Gia_TtCache_t, 1 );
+}
+void Gia_TtCacheStop()
+{
+    int i, v;
+    if ( s_pTtCache == NULL )
+        return;
+    for ( v = 0; v <= GIA_TT_CACHE_MAX; v++ )
+    {
+        for ( i = 0; i < 2; i++ )
+            if ( s_pTtCache->vTtMems[i][v] )
+            {
+                Vec_MemHashFree( s_pTtCache->vTtMems[i][v] );
+                Vec_MemFree( s_pTtCache->vTtMems[i][v] );
+            }
+        Vec_IntFreeP( &s_pTtCache->vCnfSizes[v] );
+    }
+    ABC_FREE( s_pTtCache );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the table of functions for the given LUT size.]
+
+  Description [The tables are created on demand. The table with the
+  MUX function is used by &lf with MUX7 mapping, which expects the MUX
+  to be entry 2. The caller should not free the table.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Mem_t * Gia_TtCacheTable( int nVars, int fMux7 )
+{
+    assert( s_pTtCache != NULL );
+    assert( nVars >= 0 && nVars <= GIA_TT_CACHE_MAX );
+    if ( s_pTtCache->vTtMems[fMux7][nVars] == NULL )
+    {
+        s_pTtCache->vTtMems[fMux7][nVars] = Vec_MemAllocForTT( nVars, 0 );
+        if ( fMux7 )
+            Vec_MemAddMuxTT( s_pTtCache->vTtMems[fMux7][nVars], nVars );
+    }
+    return s_pTtCache->vTtMems[fMux7][nVars];
+}
+Vec_Int_t * Gia_TtCacheCnfSizes( int nVars )
+{
+    assert( s_pTtCache != NULL );
+    assert( nVars >= 0 && nVars <= GIA_TT_CACHE_MAX );
+    if ( s_pTtCache->vCnfSizes[nVars] == NULL )
+    {
+        s_pTtCache->vCnfSizes[nVars] = Vec_IntAlloc( 10000 );
+        Vec_IntPush( s_pTtCache->vCnfSizes[nVars], 1 );
+        Vec_IntPush( s_pTtCache->vCnfSizes[nVars], 2 );
+    }
+    return s_pTtCache->vCnfSizes[nVars];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_TtCachePrint()
+{
+    int i, v, nTables = 0;
+    if ( s_pTtCache == NULL )
+    {
+        printf( "The function cache is not started.\n" );
+        return;
+    }
+    for ( v = 0; v <= GIA_TT_CACHE_MAX; v++ )
+    for ( i = 0; i < 2; i++ )
+    {
+        Vec_Mem_t * vTtMem = s_pTtCache->vTtMems[i][v];
+        if ( vTtMem == NULL )
+            continue;
+        printf( "%2d inputs%s :  Functions = %8d.  ", v, i ? " (MUX7)" : "       ", Vec_MemEntryNum(vTtMem) );
+        if ( i == 0 && s_pTtCache->vCnfSizes[v] )
+            printf( "CNF sizes = %8d.  ", Vec_IntSize(s_pTtCache->vCnfSizes[v]) - Vec_IntCountEntry(s_pTtCache->vCnfSizes[v], -1) );
+        else
+            printf( "                     " );
+        printf( "Memory = %8.2f MB\n", 1.0 * Vec_MemMemory(vTtMem) / (1<<20) );
+        nTables++;
+    }
+    if ( nTables == 0 )
+        printf( "The function cache is empty.\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache into a file.]
+
+  Description [The file contains the version, the number of tables, and
+  for each table, the number of inputs, the MUX flag, the truth tables,
+  and the CNF sizes. If the DSD manager is given, it is appended in the
+  format of "dsd_save".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_TtCacheSave( char * pFileName, void * pManDsd )
+{
+    FILE * pFile;
+    word * pTruth;
+    int i, k, v, Num;
+    if ( s_pTtCache == NULL )
+    {
+        printf( "The function cache is not started.\n" );
+        return 0;
+    }
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    fwrite( GIA_TT_CACHE_VER, 4, 1, pFile );
+    for ( Num = v = 0; v <= GIA_TT_CACHE_MAX; v++ )
+        Num += (s_pTtCache->vTtMems[0][v] != NULL) + (s_pTtCache->vTtMems[1][v] != NULL);
+    fwrite( &Num, 4, 1, pFile );
+    for ( v = 0; v <= GIA_TT_CACHE_MAX; v++ )
+    for ( i = 0; i < 2; i++ )
+    {
+        Vec_Mem_t * vTtMem = s_pTtCache->vTtMems[i][v];
+        Vec_Int_t * vCnfSizes = i ? NULL : s_pTtCache->vCnfSizes[v];
+        if ( vTtMem == NULL )
+            continue;
+        fwrite( &v, 4, 1, pFile );
+        fwrite( &i, 4, 1, pFile );
+        Num = Vec_MemEntryNum(vTtMem);
+        fwrite( &Num, 4, 1, pFile );
+        Vec_MemForEachEntry( vTtMem, pTruth, k )
+            fwrite( pTruth, sizeof(word) * Vec_MemEntrySize(vTtMem), 1, pFile );
+        Num = vCnfSizes ? Vec_IntSize(vCnfSizes) : 0;
+        fwrite( &Num, 4, 1, pFile );
+        if ( Num )
+            fwrite( Vec_IntArray(vCnfSizes), sizeof(int) * Num, 1, pFile );
+    }
+    Num = (pManDsd != NULL);
+    fwrite( &Num, 4, 1, pFile );
+    if ( pManDsd )
+        If_DsdManSaveFile( (If_DsdMan_t *)pManDsd, pFile );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cache from a file.]
+
+  Description [The file is mapped into memory when possible. The tables
+  are added to the current contents of the cache, which is started if
+  needed. If the file contains the DSD manager and ppManDsd is not NULL,
+  the manager is returned; otherwise, the manager is skipped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_TtCacheReadInt( char ** ppCur, char * pLimit, int * pValue )
+{
+    if ( pLimit - *ppCur < 4 )
+        return 0;
+    memcpy( pValue, *ppCur, 4 );
+    *ppCur += 4;
+    return 1;
+}
+int Gia_TtCacheLoad( char * pFileName, void ** ppManDsd )
+{
+    FILE * pFile;
+    char * pBuffer = NULL, * pCur, * pLimit;
+    word * pTruth = NULL;
+    size_t nSize = 0;
+    int i, k, v, nWords, nTables, Num, fMapped = 0, RetValue = 0;
+    if ( ppManDsd )
+        *ppManDsd = NULL;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return 0;
+    }
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        if ( fstat( fileno(pFile), &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fileno(pFile), 0 );
+            if ( pMap != MAP_FAILED )
+            {
+                pBuffer = (char *)pMap;
+                nSize   = (size_t)Stat.st_size;
+                fMapped = 1;
+            }
+        }
+    }
+#endif
+    if ( !fMapped )
+    {
+        long nFileSize;
+        fseek( pFile, 0, SEEK_END );
+        nFileSize = ftell( pFile );
+        rewind( pFile );
+        pBuffer = ABC_ALLOC( char, Abc_MaxInt(nFileSize, 0) + 1 );
+        nSize   = nFileSize > 0 ? fread( pBuffer, 1, (size_t)nFileSize, pFile ) : 0;
+    }
+    pCur   = pBuffer;
+    pLimit = pBuffer + nSize;
+    if ( nSize < 4 || strncmp(pBuffer, GIA_TT_CACHE_VER, 4) )
+    {
+        printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        goto finish;
+    }
+    pCur += 4;
+    Gia_TtCacheStart();
+    if ( !Gia_TtCacheReadInt(&pCur, pLimit, &nTables) )
+        goto corrupted;
+    pTruth = ABC_ALLOC( word, Abc_Truth6WordNum(GIA_TT_CACHE_MAX) );
+    for ( k = 0; k < nTables; k++ )
+    {
+        Vec_Mem_t * vTtMem;
+        Vec_Int_t * vCnfSizes;
+        int fMux7, nEntries, * pMap;
+        if ( !Gia_TtCacheReadInt(&pCur, pLimit, &v) || v < 0 || v > GIA_TT_CACHE_MAX )
+            goto corrupted;
+        if ( !Gia_TtCacheReadInt(&pCur, pLimit, &fMux7) || (fMux7 != 0 && fMux7 != 1) )
+            goto corrupted;
+        if ( !Gia_TtCacheReadInt(&pCur, pLimit, &nEntries) || nEntries < 0 )
+            goto corrupted;
+        nWords = Abc_Truth6WordNum( v );
+        if ( (size_t)(pLimit - pCur) / (sizeof(word) * nWords) < (size_t)nEntries )
+            goto corrupted;
+        // the IDs of the functions may change when the cache is not empty
+        vTtMem = Gia_TtCacheTable( v, fMux7 );
+        pMap = ABC_ALLOC( int, nEntries );
+        for ( i = 0; i < nEntries; i++, pCur += sizeof(word) * nWords )
+        {
+            memcpy( pTruth, pCur, sizeof(word) * nWords );
+            pMap[i] = Vec_MemHashInsert( vTtMem, pTruth );
+        }
+        if ( !Gia_TtCacheReadInt(&pCur, pLimit, &Num) || Num < 0 || Num > nEntries || (fMux7 && Num > 0) || (pLimit - pCur) / 4 < Num )
+        {
+            ABC_FREE( pMap );
+            goto corrupted;
+        }
+        vCnfSizes = Num ? Gia_TtCacheCnfSizes( v ) : NULL;
+        for ( i = 0; i < Num; i++, pCur += 4 )
+        {
+            int Size;
+            memcpy( &Size, pCur, 4 );
+            if ( Size >= 0 && (pMap[i] >= Vec_IntSize(vCnfSizes) || Vec_IntEntry(vCnfSizes, pMap[i]) < 0) )
+                Vec_IntSetEntryFull( vCnfSizes, pMap[i], Size );
+        }
+        ABC_FREE( pMap );
+    }
+    if ( !Gia_TtCacheReadInt(&pCur, pLimit, &Num) )
+        goto corrupted;
+    if ( Num && ppManDsd )
+    {
+        // the DSD manager is read by its own reader
+        fseek( pFile, (long)(pCur - pBuffer), SEEK_SET );
+        *ppManDsd = If_DsdManLoadFile( pFile, pFileName );
+        if ( *ppManDsd == NULL )
+            goto finish;
+    }
+    RetValue = 1;
+    goto finish;
+corrupted:
+    printf( "File \"%s\" is corrupted.\n", pFileName );
+finish:
+    ABC_FREE( pTruth );
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pBuffer, nSize );
+    else
+#endif
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -63,6 +63,7 @@
 #include "opt/fret/fretime.h"
 #include "opt/nwk/nwkMerge.h"
 #include "base/acb/acbPar.h"
+#include "misc/util/utilSatStat.h"
 
 
 #ifndef _WIN32
@@ -276,6 +277,7 @@ static int Abc_CommandDsdPs                  ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandDsdMatch               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandDsdMerge               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandDsdFilter              ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandTtCache                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
 static int Abc_CommandScut                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandInit                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -328,6 +330,8 @@ static int Abc_CommandBmc                    ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandBmc2                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandBmc3                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandBmcInter               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandSatPort                ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandSatStats               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandIndcut                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandEnlarge                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandTempor                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -939,6 +943,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "DSD manager",  "dsd_match",     Abc_CommandDsdMatch,         0 );
     Cmd_CommandAdd( pAbc, "DSD manager",  "dsd_merge",     Abc_CommandDsdMerge,         0 );
     Cmd_CommandAdd( pAbc, "DSD manager",  "dsd_filter",    Abc_CommandDsdFilter,        0 );
+    Cmd_CommandAdd( pAbc, "DSD manager",  "tt_cache",      Abc_CommandTtCache,          0 );
 
 //    Cmd_CommandAdd( pAbc, "Sequential",   "scut",          Abc_CommandScut,             0 );
     Cmd_CommandAdd( pAbc, "Sequential",   "init",          Abc_CommandInit,             1 );
@@ -993,6 +998,8 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Verification", "bmc2",          Abc_CommandBmc2,             0 );
     Cmd_CommandAdd( pAbc, "Verification", "bmc3",          Abc_CommandBmc3,             1 );
     Cmd_CommandAdd( pAbc, "Verification", "int",           Abc_CommandBmcInter,         1 );
+    Cmd_CommandAdd( pAbc, "Verification", "satport",       Abc_CommandSatPort,          0 );
+    Cmd_CommandAdd( pAbc, "Verification", "sat_stats",     Abc_CommandSatStats,         0 );
     Cmd_CommandAdd( pAbc, "Verification", "indcut",        Abc_CommandIndcut,           0 );
     Cmd_CommandAdd( pAbc, "Verification", "enlarge",       Abc_CommandEnlarge,          1 );
     Cmd_CommandAdd( pAbc, "Verification", "tempor",        Abc_CommandTempor,           1 );
@@ -14229,7 +14236,7 @@ int Abc_CommandIProve( Abc_Frame_t * pAbc, int argc, char ** argv )
     pParams->fUseRewriting = 1;
     pParams->fVerbose      = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "NCFGLIrfbvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NCFGLIPrfbvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -14299,6 +14306,17 @@ int Abc_CommandIProve( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pParams->nTotalInspectLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pParams->nCubeProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pParams->nCubeProcs < 0 || pParams->nCubeProcs > 100 )
+                goto usage;
+            break;
         case 'r':
             pParams->fUseRewriting ^= 1;
             break;
@@ -14375,7 +14393,7 @@ int Abc_CommandIProve( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: iprove [-NCFGLI num] [-rfbvh]\n" );
+    Abc_Print( -2, "usage: iprove [-NCFGLIP num] [-rfbvh]\n" );
     Abc_Print( -2, "\t         performs CEC using a new method\n" );
     Abc_Print( -2, "\t-N num : max number of iterations [default = %d]\n", pParams->nItersMax );
     Abc_Print( -2, "\t-C num : max starting number of conflicts in mitering [default = %d]\n", pParams->nMiteringLimitStart );
@@ -14383,6 +14401,7 @@ usage:
     Abc_Print( -2, "\t-G num : multiplicative coefficient for fraiging [default = %d]\n", (int)pParams->nFraigingLimitMulti );
     Abc_Print( -2, "\t-L num : max last-gasp number of conflicts in mitering [default = %d]\n", pParams->nMiteringLimitLast );
     Abc_Print( -2, "\t-I num : max number of clause inspections in all SAT calls [default = %d]\n", (int)pParams->nTotalInspectLimit );
+    Abc_Print( -2, "\t-P num : the number of cube-and-conquer threads for last-gasp mitering (0 = not used) [default = %d]\n", pParams->nCubeProcs );
     Abc_Print( -2, "\t-r     : toggle the use of rewriting [default = %s]\n", pParams->fUseRewriting? "yes": "no" );
     Abc_Print( -2, "\t-f     : toggle the use of FRAIGing [default = %s]\n", pParams->fUseFraiging? "yes": "no" );
     Abc_Print( -2, "\t-b     : toggle the use of BDDs [default = %s]\n", pParams->fUseBdds? "yes": "no" );
@@ -17163,7 +17182,7 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
     If_ManSetDefaultPars( pPars );
     pPars->pLutLib = (If_LibLut_t *)Abc_FrameReadLibLut();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYDEWSqaflepmrsdbgxyuojiktncvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYPDEWSqaflepmrsdbgxyuojiktncvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -17279,6 +17298,17 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nAndDelay < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -17669,7 +17699,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: if [-KCFAGRNTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyuojiktncvh]\n" );
+    Abc_Print( -2, "usage: if [-KCFAGRNTXYP num] [-DEW float] [-S str] [-qarlepmsdbgxyuojiktncvh]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -17681,6 +17711,7 @@ usage:
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n" );
     Abc_Print( -2, "\t-X num   : delay of AND-gate in LUT library units [default = %d]\n", pPars->nAndDelay );
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
+    Abc_Print( -2, "\t-P num   : the number of threads computing cuts level by level [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-D float : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
@@ -18421,6 +18452,97 @@ usage:
     Abc_Print( -2, "\t         A. Neutzling, J. M. Matos, A. Mishchenko, R. Ribas, and A. Reis,\n" );
     Abc_Print( -2, "\t         \"Threshold logic synthesis based on cut pruning\". Proc. ICCAD 2015.\n" );
 //    Abc_Print( -2, "\t        http://www.eecs.berkeley.edu/~alanmi/publications/2015/iccad15_thresh.pdf\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandTtCache( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    char * FileName = NULL;
+    void * pDsdMan = NULL;
+    int c, fStart = 0, fRead = 0, fWrite = 0, fFree = 0, fUseDsd = 1, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "srwfdvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 's':
+            fStart ^= 1;
+            break;
+        case 'r':
+            fRead ^= 1;
+            break;
+        case 'w':
+            fWrite ^= 1;
+            break;
+        case 'f':
+            fFree ^= 1;
+            break;
+        case 'd':
+            fUseDsd ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( fRead || fWrite )
+    {
+        if ( argc != globalUtilOptind + 1 )
+        {
+            Abc_Print( -1, "File name is not given on the command line.\n" );
+            return 1;
+        }
+        FileName = argv[globalUtilOptind];
+    }
+    else if ( argc != globalUtilOptind )
+        goto usage;
+    if ( fFree )
+    {
+        Gia_TtCacheStop();
+        return 0;
+    }
+    if ( fStart )
+        Gia_TtCacheStart();
+    if ( fRead )
+    {
+        if ( !Gia_TtCacheLoad( FileName, fUseDsd ? &pDsdMan : NULL ) )
+            return 1;
+        if ( pDsdMan )
+            Abc_FrameSetManDsd( pDsdMan );
+    }
+    if ( fWrite && !Gia_TtCacheSave( FileName, fUseDsd ? Abc_FrameReadManDsd() : NULL ) )
+        return 1;
+    if ( fVerbose || (!fStart && !fRead && !fWrite) )
+        Gia_TtCachePrint();
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: tt_cache [-srwfdvh] <file>\n" );
+    Abc_Print( -2, "\t         manages the cache of functions shared by the runs of &mf and &lf\n");
+    Abc_Print( -2, "\t         (when the cache is started, the mappers reuse its truth tables and CNF sizes)\n");
+    Abc_Print( -2, "\t-s     : toggles starting the cache [default = %s]\n", fStart? "yes": "no" );
+    Abc_Print( -2, "\t-r     : toggles adding the cache contents from file [default = %s]\n", fRead? "yes": "no" );
+    Abc_Print( -2, "\t-w     : toggles writing the cache contents into file [default = %s]\n", fWrite? "yes": "no" );
+    Abc_Print( -2, "\t-f     : toggles freeing the cache [default = %s]\n", fFree? "yes": "no" );
+    Abc_Print( -2, "\t-d     : toggles reading/writing the DSD manager with the cache [default = %s]\n", fUseDsd? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggles printing the cache statistics [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : the file name to read or write\n");
     return 1;
 }
 
@@ -22163,11 +22285,13 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nInsLimit;
     int fPartition;
     int fIgnoreNames;
+    int nProcs;
 
     extern void Abc_NtkCecSat( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int nInsLimit );
     extern void Abc_NtkCecFraig( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int fVerbose );
     extern void Abc_NtkCecFraigPart( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nPartSize, int fVerbose );
     extern void Abc_NtkCecFraigPartAuto( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int fVerbose );
+    extern void Abc_NtkCecFraigPartPar( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nPartSize, int nProcs, int nConfLimit, int fVerbose );
 
     pNtk = Abc_FrameReadNtk(pAbc);
     // set defaults
@@ -22179,8 +22303,9 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     nInsLimit  = 0;
     fPartition = 0;
     fIgnoreNames = 0;
+    nProcs     = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "TCIPpsnvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TCIPJpsnvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -22228,6 +22353,17 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nPartSize < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 || nProcs > 100 )
+                goto usage;
+            break;
         case 'p':
             fPartition ^= 1;
             break;
@@ -22273,7 +22409,9 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // perform equivalence checking
-    if ( fPartition )
+    if ( nProcs > 1 && (fPartition || nPartSize) )
+        Abc_NtkCecFraigPartPar( pNtk1, pNtk2, nSeconds, nPartSize, nProcs, nConfLimit, fVerbose );
+    else if ( fPartition )
         Abc_NtkCecFraigPartAuto( pNtk1, pNtk2, nSeconds, fVerbose );
     else if ( nPartSize )
         Abc_NtkCecFraigPart( pNtk1, pNtk2, nSeconds, nPartSize, fVerbose );
@@ -22291,12 +22429,14 @@ usage:
         strcpy( Buffer, "unused" );
     else
         sprintf(Buffer, "%d", nPartSize );
-    Abc_Print( -2, "usage: cec [-T num] [-C num] [-I num] [-P num] [-psnvh] <file1> <file2>\n" );
+    Abc_Print( -2, "usage: cec [-T num] [-C num] [-I num] [-P num] [-J num] [-psnvh] <file1> <file2>\n" );
     Abc_Print( -2, "\t         performs combinational equivalence checking\n" );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", nSeconds );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
     Abc_Print( -2, "\t-I num : limit on the number of clause inspections [default = %d]\n", nInsLimit );
     Abc_Print( -2, "\t-P num : partition size for multi-output networks [default = %s]\n", Buffer );
+    Abc_Print( -2, "\t-J num : the number of threads for partitioned checking [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t         (with -J > 1, parts exceeding -C conflicts are split by cofactoring)\n" );
     Abc_Print( -2, "\t-p     : toggle automatic partitioning [default = %s]\n", fPartition? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle \"SAT only\" and \"FRAIG + SAT\" [default = %s]\n", fSat? "SAT only": "FRAIG + SAT" );
     Abc_Print( -2, "\t-n     : toggle how CIs/COs are matched (by name or by order) [default = %s]\n", fIgnoreNames? "by order": "by name" );
@@ -22633,7 +22773,7 @@ int Abc_CommandDProve( Abc_Frame_t * pAbc, int argc, char ** argv )
     Fra_SecSetDefaultParams( pSecPar );
 //    pSecPar->TimeLimit = 300;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "cbAEFCGDVBRTLarmfijkoupwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "cbAEFCGDVBRTPLarmfijkoupwvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -22753,6 +22893,17 @@ int Abc_CommandDProve( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pSecPar->nPdrTimeout < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pSecPar->nCubeProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pSecPar->nCubeProcs < 0 || pSecPar->nCubeProcs > 100 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -22834,7 +22985,7 @@ int Abc_CommandDProve( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dprove [-AEFCGDVBRT num] [-L file] [-cbarmfijoupvwh]\n" );
+    Abc_Print( -2, "usage: dprove [-AEFCGDVBRTP num] [-L file] [-cbarmfijoupvwh]\n" );
     Abc_Print( -2, "\t         performs SEC on the sequential miter\n" );
     Abc_Print( -2, "\t-A num : the limit on the depth of BMC [default = %d]\n", nBmcFramesMax );
     Abc_Print( -2, "\t-E num : the conflict limit during BMC [default = %d]\n", nBmcConfMax );
@@ -22846,6 +22997,7 @@ usage:
     Abc_Print( -2, "\t-B num : the BDD size limit in BDD-based reachablity [default = %d]\n", pSecPar->nBddMax );
     Abc_Print( -2, "\t-R num : the max number of reachability iterations [default = %d]\n", pSecPar->nBddIterMax );
     Abc_Print( -2, "\t-T num : the timeout for property directed reachability [default = %d]\n", pSecPar->nPdrTimeout );
+    Abc_Print( -2, "\t-P num : the number of cube-and-conquer threads in CEC (0 = not used) [default = %d]\n", pSecPar->nCubeProcs );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-c     : toggles using CEC before attempting SEC [default = %s]\n", pSecPar->fTryComb? "yes": "no" );
     Abc_Print( -2, "\t-b     : toggles using BMC before attempting SEC [default = %s]\n", pSecPar->fTryBmc? "yes": "no" );
@@ -23646,23 +23798,54 @@ int Abc_CommandXSat( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
     }
 
-    if ( argc == globalUtilOptind + 1 )
+    if ( argc == globalUtilOptind + 1 || argc == globalUtilOptind )
     {
-        char * pFileName = argv[globalUtilOptind];
+        extern int Abc_NtkDarToXsat( Abc_Ntk_t * pNtk, xSAT_Solver_t ** ppSat, int fVerbose );
+        Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
         xSAT_Solver_t * p;
         int status;
 
-        FILE * pFile = fopen( pFileName, "rb" );
-        if ( pFile == NULL )
+        if ( argc == globalUtilOptind + 1 )
         {
-            printf( "Cannot open file \"%s\" for writing.\n", pFileName );
-            return 0;
+            char * pFileName = argv[globalUtilOptind];
+            FILE * pFile = fopen( pFileName, "rb" );
+            if ( pFile == NULL )
+            {
+                printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+                return 0;
+            }
+            status = xSAT_SolverParseDimacs( pFile, &p );
+            fclose( pFile );
+            if ( status == -1 )
+            {
+                xSAT_SolverDestroy( p );
+                return 0;
+            }
+        }
+        else
+        {
+            // load the current network without going through DIMACS
+            if ( pNtk == NULL )
+            {
+                Abc_Print( -1, "Empty network.\n" );
+                return 1;
+            }
+            if ( !Abc_NtkIsStrash(pNtk) || Abc_NtkLatchNum(pNtk) > 0 )
+            {
+                Abc_Print( -1, "The current network should be a combinational AIG (run \"strash\").\n" );
+                return 1;
+            }
+            status = Abc_NtkDarToXsat( pNtk, &p, fVerbose );
+            if ( status == -1 )
+            {
+                Abc_Print( -1, "Deriving CNF of the miter has failed.\n" );
+                return 1;
+            }
         }
-        xSAT_SolverParseDimacs( pFile, &p );
 
         clk = Abc_Clock();
-        status = xSAT_SolverSolve( p );
-        fclose( pFile );
+        // the problem is UNSAT if a conflict was found while loading
+        status = status ? xSAT_SolverSolve( p ) : -1;
 
         xSAT_SolverPrintStats( p );
         if ( status == 0 )
@@ -23679,9 +23862,9 @@ int Abc_CommandXSat( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
 usage:
-    Abc_Print( -2, "usage: xsat [-CILDE num] [-hv]<file>.cnf\n" );
-    Abc_Print( -2, "\t         solves the combinational miter using SAT solver MiniSat-1.14\n" );
-    Abc_Print( -2, "\t         derives CNF from the current network and leaves it unchanged\n" );
+    Abc_Print( -2, "usage: xsat [-CILDE num] [-hv] [<file>.cnf]\n" );
+    Abc_Print( -2, "\t         solves the CNF file or, if no file is given, the combinational miter\n" );
+    Abc_Print( -2, "\t         whose CNF is loaded into the solver directly (without DIMACS)\n" );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
     Abc_Print( -2, "\t-I num : limit on the number of inspections [default = %d]\n", nInsLimit );
     Abc_Print( -2, "\t-L num : starting value for learned clause removal [default = %d]\n", nLearnedStart );
@@ -23718,19 +23901,49 @@ int Abc_CommandSatoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     memcpy( &opts, popts, sizeof(satoko_opts_t) );
     ABC_FREE( popts );
 
-    if ( argc == globalUtilOptind + 1 )
+    if ( argc == globalUtilOptind + 1 || argc == globalUtilOptind )
     {
+        extern int Abc_NtkDarToSatoko( Abc_Ntk_t * pNtk, satoko_opts_t * opts, satoko_t ** ppSat, int fVerbose );
+        Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
         abctime clk;
-        char * pFileName = argv[globalUtilOptind];
-        satoko_t * p;
+        satoko_t * p = NULL;
         int status;
 
-        status = satoko_parse_dimacs( pFileName, &p );
-        satoko_configure(p, &opts);
+        if ( argc == globalUtilOptind + 1 )
+        {
+            // read the CNF file
+            status = satoko_parse_dimacs( argv[globalUtilOptind], &p );
+            if ( status == -1 )
+                return 0;
+            satoko_configure(p, &opts);
+        }
+        else
+        {
+            // load the current network without going through DIMACS
+            if ( pNtk == NULL )
+            {
+                Abc_Print( -1, "Empty network.\n" );
+                return 1;
+            }
+            if ( !Abc_NtkIsStrash(pNtk) || Abc_NtkLatchNum(pNtk) > 0 )
+            {
+                Abc_Print( -1, "The current network should be a combinational AIG (run \"strash\").\n" );
+                return 1;
+            }
+            status = Abc_NtkDarToSatoko( pNtk, &opts, &p, opts.verbose );
+            if ( status == -1 )
+            {
+                Abc_Print( -1, "Deriving CNF of the miter has failed.\n" );
+                return 1;
+            }
+            status = status ? SATOKO_OK : SATOKO_ERR;
+        }
 
         clk = Abc_Clock();
         if ( status == SATOKO_OK )
             status = satoko_solve( p );
+        else
+            status = SATOKO_UNSAT;
 
         if ( status == SATOKO_UNDEC )
             Abc_Print( 1, "UNDECIDED      " );
@@ -23741,16 +23954,19 @@ int Abc_CommandSatoko( Abc_Frame_t * pAbc, int argc, char ** argv )
 
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
 
-        satoko_destroy( p );
+        if ( p )
+            satoko_destroy( p );
         return 0;
     }
 
 usage:
 #ifdef SATOKO_ACT_VAR_FIXED
-    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRSTU num] [-hv]<file>.cnf\n" );
+    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRSTU num] [-hv] [<file>.cnf]\n" );
 #else
-    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRS num] [-hv]<file>.cnf\n" );
+    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRS num] [-hv] [<file>.cnf]\n" );
 #endif
+    Abc_Print( -2, "\t         solves the CNF file or, if no file is given, the combinational miter\n" );
+    Abc_Print( -2, "\t         whose CNF is loaded into the solver directly (without DIMACS)\n" );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
     Abc_Print( -2, "\t-P num : limit on the number of propagations [default = %d]\n", opts.conf_limit );
     Abc_Print( -2, "\n\tConstants used for restart heuristic:\n");
@@ -24753,7 +24969,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRELWKpaxdursgvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -24889,6 +25105,28 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'E':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-E\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nInproConfs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nInproConfs < 0 )
+                goto usage;
+            break;
+        case 'p':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-p\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -24907,6 +25145,15 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             pPars->pLogFileName = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pCheckFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -24994,7 +25241,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRE num] [-p num] [-LWK file] [-axdursgvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -25008,8 +25255,11 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",          pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-E num : conflicts between solver inprocessing rounds (0 = unused) [default = %d]\n", pPars->nInproConfs );
+    Abc_Print( -2, "\t-p num : the number of threads solving groups of outputs (0 = unused) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
+    Abc_Print( -2, "\t-K file: the checkpoint file to resume from and to update on exit [default = %s]\n", pPars->pCheckFile ? pPars->pCheckFile : "not used" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",   pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dropping (replacing by 0) SAT outputs [default = %s]\n",    pPars->fDropSatOuts? "yes": "no" );
@@ -25023,6 +25273,187 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandSatPort( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Bmc_PortPar_t Pars, * pPars = &Pars;
+    int c, fStats = 0, fReset = 0;
+    Pars = *Bmc_PortReadParams();
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PCTsrvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nConfLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nConfLimit < 0 )
+                goto usage;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimeOut = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimeOut < 0 )
+                goto usage;
+            break;
+        case 's':
+            fStats ^= 1;
+            break;
+        case 'r':
+            fReset ^= 1;
+            break;
+        case 'v':
+            pPars->fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+#ifndef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 0 )
+    {
+        Abc_Print( -1, "The portfolio requires ABC to be compiled with pthreads.\n" );
+        return 0;
+    }
+#endif
+    Bmc_PortSetParams( pPars );
+    if ( fStats )
+        Bmc_PortPrintStats();
+    if ( fReset )
+        Bmc_PortResetStats();
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: satport [-PCT num] [-srvh]\n" );
+    Abc_Print( -2, "\t         configures the portfolio of SAT solvers (bsat, satoko, glucose)\n" );
+    Abc_Print( -2, "\t         used for the queries that exceed their conflict limit in\n" );
+    Abc_Print( -2, "\t         \"cec\", \"iprove\", \"bmc3\", \"&cec\", \"&fraig\", etc\n" );
+    Abc_Print( -2, "\t-P num : the number of concurrent solvers (0 = disable portfolio) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-C num : the conflict limit of each solver (0 = no limit) [default = %d]\n", pPars->nConfLimit );
+    Abc_Print( -2, "\t-T num : the runtime limit of each solver in seconds (0 = no limit) [default = %d]\n", pPars->TimeOut );
+    Abc_Print( -2, "\t-s     : toggle printing portfolio statistics [default = %s]\n", fStats? "yes": "no" );
+    Abc_Print( -2, "\t-r     : toggle resetting portfolio statistics [default = %s]\n", fReset? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandSatStats( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nCallsMax = Abc_SatStatIsOn() ? Abc_SatStatCallsMax() : 100000;
+    int fToggle = 0, fReset = 0, fHisto = 0, fResize = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Nergh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCallsMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCallsMax <= 0 )
+                goto usage;
+            fResize = 1;
+            break;
+        case 'e':
+            fToggle ^= 1;
+            break;
+        case 'r':
+            fReset ^= 1;
+            break;
+        case 'g':
+            fHisto ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc > globalUtilOptind + 1 )
+        goto usage;
+    if ( fToggle && Abc_SatStatIsOn() )
+    {
+        Abc_SatStatStop();
+        return 0;
+    }
+    if ( fToggle || (fResize && Abc_SatStatIsOn()) )
+    {
+        Abc_SatStatStart( nCallsMax );
+        return 0;
+    }
+    if ( fReset )
+    {
+        Abc_SatStatReset();
+        return 0;
+    }
+    if ( argc == globalUtilOptind + 1 )
+        Abc_SatStatDumpCsv( argv[globalUtilOptind] );
+    else
+        Abc_SatStatPrint( fHisto );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: sat_stats [-N num] [-ergh] <file>\n" );
+    Abc_Print( -2, "\t         reports the calls to the SAT solvers (bsat, bsat2, bsat3, satoko, glucose)\n" );
+    Abc_Print( -2, "\t         made by the commands since the collection was enabled\n" );
+    Abc_Print( -2, "\t-N num : the number of the most recent calls to keep [default = %d]\n", nCallsMax );
+    Abc_Print( -2, "\t-e     : toggle enabling the collection [default = %s]\n", Abc_SatStatIsOn()? "yes": "no" );
+    Abc_Print( -2, "\t-r     : toggle resetting the recorded calls [default = %s]\n", fReset? "yes": "no" );
+    Abc_Print( -2, "\t-g     : toggle printing histograms [default = %s]\n", fHisto? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : the CSV file to write the recorded calls (one line per call)\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -26696,7 +27127,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Pdr_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSNEKaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -26799,6 +27230,37 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nRandomSeed < 0 )
                 goto usage;
             break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 0 )
+                goto usage;
+            break;
+        case 'E':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-E\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nInproConfs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nInproConfs < 0 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pCheckFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -26897,7 +27359,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: pdr [-MFCDQTHGS <num>] [-axrmuyfqipdegjonctkvwzh]\n" );
+    Abc_Print( -2, "usage: pdr [-MFCDQTHGSNE <num>] [-K <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
     Abc_Print( -2, "\t         model checking using property directed reachability (aka IC3)\n" );
     Abc_Print( -2, "\t         pioneered by Aaron R. Bradley (http://theory.stanford.edu/~arbrad/)\n" );
     Abc_Print( -2, "\t         with improvements by Niklas Een (http://een.se/niklas/)\n" );
@@ -26910,6 +27372,9 @@ usage:
     Abc_Print( -2, "\t-H num : runtime limit per output, in miliseconds (with \"-a\") [default = %d]\n",     pPars->nTimeOutOne );
     Abc_Print( -2, "\t-G num : runtime gap since the last CEX (0 = no limit) [default = %d]\n",              pPars->nTimeOutGap );
     Abc_Print( -2, "\t-S num : * value to seed the SAT solver with [default = %d]\n",                          pPars->nRandomSeed );
+    Abc_Print( -2, "\t-N num : the number of threads sharing clauses (without \"-a\") [default = %d]\n",      pPars->nThreads );
+    Abc_Print( -2, "\t-E num : conflicts between solver inprocessing rounds (0 = unused) [default = %d]\n",  pPars->nInproConfs );
+    Abc_Print( -2, "\t-K file: the checkpoint file to resume from and to update on exit [default = %s]\n",  pPars->pCheckFile ? pPars->pCheckFile : "not used" );
     Abc_Print( -2, "\t-a     : toggle solving all outputs even if one of them is SAT [default = %s]\n",      pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",              pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle using more effort in generalization [default = %s]\n",                 pPars->fTwoRounds? "yes": "no" );
@@ -30167,7 +30632,7 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTIOmbvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30226,9 +30691,21 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pFileName == NULL )
                 goto usage;
             break;
+        case 'O':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-O\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pFileTrace = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'm':
             pPars->fCheckMiter ^= 1;
             break;
+        case 'b':
+            pPars->fBiased ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -30271,7 +30748,7 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNT num] [-mbvh] -I <file> -O <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
@@ -30279,9 +30756,11 @@ usage:
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
+    Abc_Print( -2, "\t-b     : toggle using biased and targeted patterns [default = %s]\n", pPars->fBiased? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t-I file: (optional) file with input patterns (one line per frame, as many as PIs)\n");
+    Abc_Print( -2, "\t-O file: (optional) binary file to write compressed flop values in each frame\n");
     return 1;
 }
 
@@ -30605,7 +31084,7 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Cec_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WFRSTsmdvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WFRSTsmdbvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30673,6 +31152,9 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'd':
             pPars->fDualOut ^= 1;
             break;
+        case 'b':
+            pPars->fBiasSim ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -30691,7 +31173,7 @@ int Abc_CommandAbc9Equiv( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &equiv [-WFRST num] [-smdvh]\n" );
+    Abc_Print( -2, "usage: &equiv [-WFRST num] [-smdbvh]\n" );
     Abc_Print( -2, "\t         computes candidate equivalence classes\n" );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nFrames );
@@ -30701,6 +31183,7 @@ usage:
     Abc_Print( -2, "\t-s     : toggle seq vs. comb simulation [default = %s]\n", pPars->fSeqSimulate? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using two POs intead of XOR [default = %s]\n", pPars->fDualOut? "yes": "no" );
+    Abc_Print( -2, "\t-b     : toggle using biased and targeted patterns [default = %s]\n", pPars->fBiasSim? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -33932,7 +34415,7 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, nArgcNew, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTPnmdasvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -33958,6 +34441,17 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nCubeProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nCubeProcs < 0 || pPars->nCubeProcs > 100 )
+                goto usage;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -34107,10 +34601,11 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasvh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTP num] [-nmdasvh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of cube-and-conquer threads used after (or with -n, instead of) SAT sweeping [default = %d]\n", pPars->nCubeProcs );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -34966,7 +35461,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     char LutSize[200];
     Gia_Man_t * pNew;
     If_Par_t Pars, * pPars = &Pars;
-    int c;
+    int c, fIncremental = 0, nIncBound = 5;
     // set defaults
     Gia_ManSetIfParsDefault( pPars );
     if ( pAbc->pLibLut == NULL )
@@ -34976,7 +35471,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     pPars->pLutLib = (If_LibLut_t *)pAbc->pLibLut;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSTXYqalepmrsdbgxyofuijkztncvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRBDEWSTXYqalepmrsdbgxyofuijkztnwcvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35048,6 +35543,17 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nRelaxRatio < 0 )
                 goto usage;
             break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nIncBound = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nIncBound < 0 )
+                goto usage;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -35197,6 +35703,9 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'n':
             pPars->fUseDsd ^= 1;
             break;
+        case 'w':
+            fIncremental ^= 1;
+            break;
         case 'c':
             pPars->fUseTtPerm ^= 1;
             break;
@@ -35459,7 +35968,15 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
 
     // perform mapping
-    pNew = Gia_ManPerformMapping( pAbc->pGia, pPars );
+    if ( fIncremental && pAbc->pGiaSaved == NULL )
+    {
+        Abc_Print( -1, "Incremental mapping requires the mapped AIG saved by \"&saveaig\".\n" );
+        return 1;
+    }
+    if ( fIncremental )
+        pNew = Gia_ManPerformMappingInc( pAbc->pGia, pAbc->pGiaSaved, pPars, nIncBound );
+    else
+        pNew = Gia_ManPerformMapping( pAbc->pGia, pPars );
     if ( pNew == NULL )
     {
         Abc_Print( -1, "Abc_CommandAbc9If(): Mapping of GIA has failed.\n" );
@@ -35477,7 +35994,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: &if [-KCFAGRTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyofuijkztnchv]\n" );
+    Abc_Print( -2, "usage: &if [-KCFAGRBTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyofuijkztnwchv]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -35485,6 +36002,7 @@ usage:
     Abc_Print( -2, "\t-A num   : the number of exact area recovery iterations (num >= 0) [default = %d]\n", pPars->nAreaIters );
     Abc_Print( -2, "\t-G num   : the max AND/OR gate size for mapping (0 = unused) [default = %d]\n", pPars->nGateSize );
     Abc_Print( -2, "\t-R num   : the delay relaxation ratio (num >= 0) [default = %d]\n", pPars->nRelaxRatio );
+    Abc_Print( -2, "\t-B num   : the quality bound of incremental mapping, in percent [default = %d]\n", nIncBound );
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n", pPars->nStructType );
     Abc_Print( -2, "\t-X num   : delay of AND-gate in LUT library units [default = %d]\n", pPars->nAndDelay );
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
@@ -35515,6 +36033,7 @@ usage:
     Abc_Print( -2, "\t-z       : toggles deriving LUTs when mapping into LUT structures [default = %s]\n", pPars->fDeriveLuts? "yes": "no" );
     Abc_Print( -2, "\t-t       : toggles optimizing average rather than maximum level [default = %s]\n", pPars->fDoAverage? "yes": "no" );
     Abc_Print( -2, "\t-n       : toggles computing DSDs of the cut functions [default = %s]\n", pPars->fUseDsd? "yes": "no" );
+    Abc_Print( -2, "\t-w       : toggles incremental mapping w.r.t. the AIG saved by \"&saveaig\" [default = %s]\n", fIncremental? "yes": "no" );
     Abc_Print( -2, "\t-c       : toggles computing truth tables in a new way [default = %s]\n", pPars->fUseTtPerm? "yes": "no" );
     Abc_Print( -2, "\t-h       : toggles rehashing AIG after mapping [default = %s]\n", pPars->fHashMapping? "yes": "no" );
     Abc_Print( -2, "\t-v       : toggles verbose output [default = %s]\n", pPars->fVerbose? "yes": "no" );
@@ -36410,7 +36929,7 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Mf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWaekmcgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDMWaekmcgsvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36508,6 +37027,17 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->DelayTarget <= 0.0 )
                 goto usage;
             break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nMemLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nMemLimit < 0 )
+                goto usage;
+            break;
         case 'W':
             if ( globalUtilOptind >= argc )
             {
@@ -36537,6 +37067,9 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'g':
             pPars->fPureAig ^= 1;
             break;
+        case 's':
+            pPars->fCutStream ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -36571,7 +37104,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &mf [-KCFARLED num] [-akmcgvwh]\n" );
+    Abc_Print( -2, "usage: &mf [-KCFARLEDM num] [-akmcgsvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
@@ -36581,12 +37114,14 @@ usage:
     Abc_Print( -2, "\t-L num   : the fanout limit for coarsening XOR/MUX (num >= 2) [default = %d]\n", pPars->nCoarseLimit );
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n", pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
+    Abc_Print( -2, "\t-M num   : the memory limit for the cuts in MB (0 = no limit) [default = %d]\n", pPars->nMemLimit );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-e       : toggles edge vs node minimization [default = %s]\n", pPars->fOptEdge? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n", pPars->fCoarsen? "yes": "no" );
     Abc_Print( -2, "\t-m       : toggles cut minimization [default = %s]\n", pPars->fCutMin? "yes": "no" );
     Abc_Print( -2, "\t-c       : toggles mapping for CNF generation [default = %s]\n", pPars->fGenCnf? "yes": "no" );
     Abc_Print( -2, "\t-g       : toggles generating AIG without mapping [default = %s]\n", pPars->fPureAig? "yes": "no" );
+    Abc_Print( -2, "\t-s       : toggles recomputing the cuts in each round to save memory [default = %s]\n", pPars->fCutStream? "yes": "no" );
     Abc_Print( -2, "\t-v       : toggles verbose output [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w       : toggles very verbose output [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h       : prints the command usage\n");
@@ -36614,7 +37149,7 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Nf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQWakpqfvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQMWakpqfvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36723,6 +37258,17 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nReqTimeFlex < 0 )
                 goto usage;
             break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by an integer number.\n" );
+                goto usage;
+            }
+            pPars->nMemLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nMemLimit < 0 )
+                goto usage;
+            break;
         case 'W':
             if ( globalUtilOptind >= argc )
             {
@@ -36787,7 +37333,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &nf [-KCFARLEDQ num] [-akpqfvwh]\n" );
+    Abc_Print( -2, "usage: &nf [-KCFARLEDQM num] [-akpqfvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n",                  pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n",           pPars->nCutNumMax, pPars->nCutNum );
@@ -36798,6 +37344,7 @@ usage:
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n",       pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n",                Buffer );
     Abc_Print( -2, "\t-Q num   : internal parameter impacting area of the mapping [default = %d]\n",         pPars->nReqTimeFlex );
+    Abc_Print( -2, "\t-M num   : the memory limit for the cuts in MB (0 = no limit) [default = %d]\n",       pPars->nMemLimit );
     Abc_Print( -2, "\t-a       : toggles SAT-based area-oriented mapping (experimental) [default = %s]\n",   pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n",                     pPars->fCoarsen? "yes": "no" );
     Abc_Print( -2, "\t-p       : toggles pin permutation (more matches - better quality) [default = %s]\n",  pPars->fPinPerm? "yes": "no" );
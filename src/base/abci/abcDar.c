@@ -36,6 +36,8 @@
 #include "proof/pdr/pdr.h"
 #include "sat/bmc/bmc.h"
 #include "map/mio/mio.h"
+#include "sat/xsat/xsat.h"
+#include "sat/satoko/satoko.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1739,7 +1741,7 @@ Abc_Ntk_t * Abc_NtkConstructFromCnf( Abc_Ntk_t * pNtk, Cnf_Man_t * p, Vec_Ptr_t
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose )
+Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nProcs, int fBench, int fVerbose )
 {
 //    Vec_Ptr_t * vMapped = NULL;
     Aig_Man_t * pMan;
@@ -1763,11 +1765,23 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // compare the sequential and parallel CNF generation
+    if ( fBench && !fFastAlgo )
+        Cnf_DeriveParTest( pMan, 0, Abc_MaxInt(nProcs, 2), fVerbose );
+
     // derive CNF
     if ( fFastAlgo )
         pCnf = Cnf_DeriveFast( pMan, 0 );
+    else if ( nProcs > 1 )
+        pCnf = Cnf_DerivePar( pMan, 0, nProcs );
     else
         pCnf = Cnf_Derive( pMan, 0 );
+    if ( pCnf == NULL )
+    {
+        Abc_Print( 1, "Abc_NtkDarToCnf: Deriving CNF has failed.\n" );
+        Aig_ManStop( pMan );
+        return NULL;
+    }
 
     // adjust polarity
     if ( fChangePol )
@@ -1795,6 +1809,133 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     return pNtkNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF of the combinational miter.]
+
+  Description [Returns the CNF and the output literals in vOuts. 
+  The miter is satisfiable if at least one output can be 1.
+  Returns NULL if the CNF cannot be derived.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Abc_NtkDarToCnfMiter( Abc_Ntk_t * pNtk, Vec_Int_t * vOuts, int fVerbose )
+{
+    Aig_Man_t * pMan;
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    abctime clk = Abc_Clock();
+    int i;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( Abc_NtkLatchNum(pNtk) == 0 );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    if ( pMan == NULL )
+        return NULL;
+    pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+    if ( pCnf == NULL )
+    {
+        Aig_ManStop( pMan );
+        return NULL;
+    }
+    Vec_IntClear( vOuts );
+    Aig_ManForEachCo( pMan, pObj, i )
+        Vec_IntPush( vOuts, Abc_Var2Lit(pCnf->pVarNums[pObj->Id], 0) );
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    pCnf->pMan = NULL;
+    Aig_ManStop( pMan );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the miter directly into satoko.]
+
+  Description [Skips DIMACS: the clauses are passed to the solver straight
+  from the literal array of the CNF. Returns 1 if the clauses are loaded, 
+  0 if the problem is found UNSAT while loading, and -1 if the CNF cannot 
+  be derived. The solver is returned in ppSat unless the result is -1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarToSatoko( Abc_Ntk_t * pNtk, satoko_opts_t * opts, satoko_t ** ppSat, int fVerbose )
+{
+    Vec_Int_t * vOuts = Vec_IntAlloc( Abc_NtkPoNum(pNtk) );
+    Cnf_Dat_t * pCnf = Abc_NtkDarToCnfMiter( pNtk, vOuts, fVerbose );
+    satoko_t * pSat;
+    int i, RetValue = 1;
+    *ppSat = NULL;
+    if ( pCnf == NULL )
+    {
+        Vec_IntFree( vOuts );
+        return -1;
+    }
+    pSat = satoko_create();
+    satoko_configure( pSat, opts );
+    satoko_setnvars( pSat, pCnf->nVars );
+    for ( i = 0; RetValue && i < pCnf->nClauses; i++ )
+        RetValue = satoko_add_clause( pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] );
+    if ( RetValue )
+        RetValue = Vec_IntSize(vOuts) > 0 && satoko_add_clause( pSat, Vec_IntArray(vOuts), Vec_IntSize(vOuts) );
+    Cnf_DataFree( pCnf );
+    Vec_IntFree( vOuts );
+    *ppSat = pSat;
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the miter directly into xSAT.]
+
+  Description [Skips DIMACS: each clause is passed to the solver as a vector
+  pointing into the literal array of the CNF. Returns 1 if the clauses are 
+  loaded, 0 if the problem is found UNSAT while loading, and -1 if the CNF 
+  cannot be derived. The solver is returned in ppSat unless the result is -1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarToXsat( Abc_Ntk_t * pNtk, xSAT_Solver_t ** ppSat, int fVerbose )
+{
+    Vec_Int_t * vOuts = Vec_IntAlloc( Abc_NtkPoNum(pNtk) );
+    Cnf_Dat_t * pCnf = Abc_NtkDarToCnfMiter( pNtk, vOuts, fVerbose );
+    xSAT_Solver_t * pSat;
+    Vec_Int_t vClause;
+    int i, RetValue = 1;
+    *ppSat = NULL;
+    if ( pCnf == NULL )
+    {
+        Vec_IntFree( vOuts );
+        return -1;
+    }
+    pSat = xSAT_SolverCreate();
+    for ( i = 0; RetValue && i < pCnf->nClauses; i++ )
+    {
+        vClause.nCap = vClause.nSize = pCnf->pClauses[i+1]-pCnf->pClauses[i];
+        vClause.pArray = pCnf->pClauses[i];
+        RetValue = vClause.nSize > 0 && xSAT_SolverAddClause( pSat, &vClause );
+    }
+    if ( RetValue )
+        RetValue = Vec_IntSize(vOuts) > 0 && xSAT_SolverAddClause( pSat, vOuts );
+    if ( RetValue )
+        RetValue = xSAT_SolverSimplify( pSat );
+    Cnf_DataFree( pCnf );
+    Vec_IntFree( vOuts );
+    *ppSat = pSat;
+    return RetValue;
+}
+
 
 /**Function*************************************************************
 
@@ -2789,6 +2930,7 @@ int Abc_NtkDarProve( Abc_Ntk_t * pNtk, Fra_Sec_t * pSecPar, int nBmcFramesMax, i
         // solve it using combinational equivalence checking
         Prove_ParamsSetDefault( pParams );
         pParams->fVerbose = 1;
+        pParams->nCubeProcs = pSecPar->nCubeProcs;
         RetValue = Abc_NtkIvyProve( &pNtkComb, pParams );
         // transfer model if given
 //        pNtk->pModel = pNtkComb->pModel; pNtkComb->pModel = NULL;
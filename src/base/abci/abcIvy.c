@@ -25,6 +25,8 @@
 #include "proof/fraig/fraig.h"
 #include "map/mio/mio.h"
 #include "aig/aig/aig.h"
+#include "aig/gia/giaAig.h"
+#include "proof/cec/cec.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -586,8 +588,24 @@ int Abc_NtkIvyProve( Abc_Ntk_t ** ppNtk, void * pPars )
             Ioa_WriteAiger( pMan2, pFileName, 0, 0 );
             printf( "Intermediate reduced miter is written into file \"%s\".\n", pFileName );
         }
-        RetValue = Fra_FraigSat( pMan2, pParams->nMiteringLimitLast, 0, 0, 0, 0, 0, 0, 0, pParams->fVerbose ); 
-        pNtk->pModel = (int *)pMan2->pData, pMan2->pData = NULL;
+        if ( pParams->nCubeProcs > 0 )
+        {
+            Gia_Man_t * pGia = Gia_ManFromAigSimple( pMan2 );
+            int i;
+            RetValue = Cec_GiaCubeConquer( pGia, pParams->nCubeProcs, 0, 0, pParams->fVerbose );
+            if ( RetValue == 0 )
+            {
+                pNtk->pModel = ABC_CALLOC( int, Abc_NtkCiNum(pNtk) );
+                for ( i = 0; i < Abc_NtkCiNum(pNtk); i++ )
+                    pNtk->pModel[i] = Abc_InfoHasBit( pGia->pCexComb->pData, i );
+            }
+            Gia_ManStop( pGia );
+        }
+        if ( RetValue < 0 )
+        {
+            RetValue = Fra_FraigSat( pMan2, pParams->nMiteringLimitLast, 0, 0, 0, 0, 0, 0, 0, pParams->fVerbose ); 
+            pNtk->pModel = (int *)pMan2->pData, pMan2->pData = NULL;
+        }
         Aig_ManStop( pMan2 );
     }
 
@@ -22,6 +22,7 @@
 #include "base/main/main.h"
 #include "base/cmd/cmd.h"
 #include "sat/bsat/satSolver.h"
+#include "sat/bmc/bmc.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -98,7 +99,7 @@ int Abc_NtkMiterSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsL
     clk = Abc_Clock();
     if ( fVerbose )
         pSat->verbosity = 1;
-    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    status = Bmc_PortSolve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)nInsLimit );
     if ( status == l_Undef )
     {
 //        printf( "The problem timed out.\n" );
@@ -476,6 +476,153 @@ void Abc_NtkCecFraigPartAuto( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds
     Abc_NtkDelete( pMiter );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Proves the partitioned miter using concurrent workers.]
+
+  Description [The outputs of the miter are partitioned by support.
+  The non-trivial parts are dispatched to the work-stealing solver
+  in cecSplit.c, which cofactors the parts exceeding the conflict limit.
+  Returns 1 if the miter is UNSAT, 0 if SAT (the model over the miter
+  CIs is stored in pMiter->pModel), and -1 if undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMiterProvePartPar( Abc_Ntk_t * pMiter, int nPartSize, int nProcs, int nConfLimit, int nSeconds, int fVerbose )
+{
+    extern Vec_Ptr_t * Abc_NtkPartitionSmart( Abc_Ntk_t * pNtk, int nPartSizeLimit, int fVerbose );
+    extern void Abc_NtkConvertCos( Abc_Ntk_t * pNtk, Vec_Int_t * vOuts, Vec_Ptr_t * vOnePtr );
+    extern Aig_Man_t * Abc_NtkToDar( Abc_Ntk_t * pNtk, int fExors, int fRegisters );
+    extern Gia_Man_t * Gia_ManFromAigSimple( Aig_Man_t * p );
+    extern int Cec_GiaProvePartsPar( Vec_Ptr_t * vParts, int nProcs, int nConfLimit, int nDepthMax, int nTimeOut, int fVerbose, int * piFailed );
+    Vec_Ptr_t * vParts, * vOnePtr, * vNtks, * vGias;
+    Vec_Int_t * vOne;
+    Abc_Ntk_t * pMiterPart;
+    Abc_Obj_t * pObj;
+    Aig_Man_t * pAig;
+    Gia_Man_t * pGia;
+    int i, k, RetValue, iFailed = -1;
+    assert( Abc_NtkIsStrash(pMiter) );
+    ABC_FREE( pMiter->pModel );
+    // derive the parts
+    vParts  = Abc_NtkPartitionSmart( pMiter, nPartSize ? nPartSize : 300, 0 );
+    vOnePtr = Vec_PtrAlloc( 1000 );
+    vNtks   = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+    vGias   = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vOne, i )
+    {
+        Abc_NtkConvertCos( pMiter, vOne, vOnePtr );
+        pMiterPart = Abc_NtkCreateConeArray( pMiter, vOnePtr, 0 );
+        Abc_NtkCombinePos( pMiterPart, 0, 0 );
+        RetValue = Abc_NtkMiterIsConstant( pMiterPart );
+        if ( RetValue == 1 )
+        {
+            Abc_NtkDelete( pMiterPart );
+            continue;
+        }
+        pAig = Abc_NtkToDar( pMiterPart, 0, 0 );
+        pGia = Gia_ManFromAigSimple( pAig );
+        Aig_ManStop( pAig );
+        Vec_PtrPush( vNtks, pMiterPart );
+        Vec_PtrPush( vGias, pGia );
+    }
+    Vec_VecFree( (Vec_Vec_t *)vParts );
+    Vec_PtrFree( vOnePtr );
+    if ( fVerbose )
+        printf( "Partitioned the miter with %d outputs into %d non-trivial parts.\n", Abc_NtkPoNum(pMiter), Vec_PtrSize(vGias) );
+    // solve the parts
+    RetValue = Cec_GiaProvePartsPar( vGias, nProcs, nConfLimit, 12, nSeconds, fVerbose, &iFailed );
+    if ( RetValue == 0 )
+    {
+        // translate the counter-example into the model of the miter
+        Abc_Cex_t * pCex;
+        pMiterPart = (Abc_Ntk_t *)Vec_PtrEntry( vNtks, iFailed );
+        pGia = (Gia_Man_t *)Vec_PtrEntry( vGias, iFailed );
+        pCex = pGia->pCexComb;
+        pMiter->pModel = Abc_NtkVerifyGetCleanModel( pMiter, 1 );
+        Abc_NtkForEachCi( pMiter, pObj, k )
+            pObj->iTemp = k;
+        Abc_NtkForEachPi( pMiterPart, pObj, k )
+            if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + k) )
+                pMiter->pModel[Abc_NtkFindCi(pMiter, Abc_ObjName(pObj))->iTemp] = 1;
+    }
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vNtks, pMiterPart, i )
+        Abc_NtkDelete( pMiterPart );
+    Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i )
+        Gia_ManStop( pGia );
+    Vec_PtrFree( vNtks );
+    Vec_PtrFree( vGias );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies combinational equivalence by concurrent partitioned SAT.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCecFraigPartPar( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nPartSize, int nProcs, int nConfLimit, int fVerbose )
+{
+    Abc_Ntk_t * pMiter;
+    int RetValue;
+    abctime clk = Abc_Clock();
+
+    // get the miter of the two networks
+    pMiter = Abc_NtkMiter( pNtk1, pNtk2, 1, 1, 0, 0 );
+    if ( pMiter == NULL )
+    {
+        printf( "Miter computation has failed.\n" );
+        return;
+    }
+    RetValue = Abc_NtkMiterIsConstant( pMiter );
+    if ( RetValue == 0 )
+    {
+        printf( "Networks are NOT EQUIVALENT after structural hashing.\n" );
+        // report the error
+        pMiter->pModel = Abc_NtkVerifyGetCleanModel( pMiter, 1 );
+        Abc_NtkVerifyReportError( pNtk1, pNtk2, pMiter->pModel );
+        ABC_FREE( pMiter->pModel );
+        Abc_NtkDelete( pMiter );
+        return;
+    }
+    if ( RetValue == 1 )
+    {
+        printf( "Networks are equivalent after structural hashing.\n" );
+        Abc_NtkDelete( pMiter );
+        return;
+    }
+
+    RetValue = Abc_NtkMiterProvePartPar( pMiter, nPartSize, nProcs, nConfLimit, nSeconds, fVerbose );
+    if ( RetValue == -1 )
+        printf( "Networks are undecided (resource limits is reached).\n" );
+    else if ( RetValue == 0 )
+    {
+        int i, * pSimInfo = Abc_NtkVerifySimulatePattern( pMiter, pMiter->pModel );
+        for ( i = 0; i < Abc_NtkPoNum(pMiter); i++ )
+            if ( pSimInfo[i] == 1 )
+                break;
+        if ( i == Abc_NtkPoNum(pMiter) )
+            printf( "ERROR in Abc_NtkMiterProvePartPar(): Generated counter-example is invalid.\n" );
+        else
+            printf( "Networks are NOT EQUIVALENT.\n" );
+        ABC_FREE( pSimInfo );
+        Abc_NtkVerifyReportError( pNtk1, pNtk2, pMiter->pModel );
+    }
+    else
+        printf( "Networks are equivalent.\n" );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    Abc_NtkDelete( pMiter );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Verifies sequential equivalence by brute-force SAT.]
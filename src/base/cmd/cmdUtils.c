@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
+#include "misc/util/utilSatStat.h"
 #include <ctype.h>
 
 ABC_NAMESPACE_IMPL_START
@@ -100,7 +101,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     int (*pFunc) ( Abc_Frame_t *, int, char ** );
     Abc_Command * pCommand;
     char * value;
-    int fError;
+    int fError, iSatTag;
     double clk;
 
     if ( argc == 0 )
@@ -149,8 +150,10 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
 
     // execute the command
     clk = Extra_CpuTimeDouble();
+    iSatTag = Abc_SatStatSetTag( argv[0] );
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
+    Abc_SatStatRestoreTag( iSatTag );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
 
     // automatic execution of arbitrary command after each command 
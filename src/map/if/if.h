@@ -112,6 +112,7 @@ struct If_Par_t_
     int                nStructType;   // type of the structure
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
+    int                nProcs;        // the number of threads computing cuts
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -477,6 +478,9 @@ static inline float      If_CutLutDelay( If_LibLut_t * p, int Size, int iPin )
 // iterator over logic nodes 
 #define If_ManForEachNode( p, pObj, i )                                        \
     If_ManForEachObj( p, pObj, i ) if ( pObj->Type != IF_AND ) {} else
+// iterator over the objects with the given IDs
+#define If_ManForEachObjVec( vIds, p, pObj, i )                                \
+    for ( i = 0; (i < Vec_IntSize(vIds)) && ((pObj) = If_ManObj(p, Vec_IntEntry(vIds, i))); i++ )
 // iterator over cuts of the node
 #define If_ObjForEachCut( pObj, pCut, i )                                      \
     for ( i = 0; (i < (pObj)->pCutSet->nCuts) && ((pCut) = (pObj)->pCutSet->ppCuts[i]); i++ )
@@ -558,7 +562,9 @@ extern void            If_DsdManTune( If_DsdMan_t * p, int LutSize, int fFast, i
 extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int fVerbose );
 extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
+extern void            If_DsdManSaveFile( If_DsdMan_t * p, FILE * pFile );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
+extern If_DsdMan_t *   If_DsdManLoadFile( FILE * pFile, char * pFileName );
 extern void            If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew );
 extern void            If_DsdManCleanOccur( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
@@ -663,6 +669,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern int             If_ManCrossCutLevel( If_Man_t * p );
+extern Vec_Wec_t *     If_ManLevelize( If_Man_t * p );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "if.h"
+#include "misc/util/utilCut.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -118,18 +119,8 @@ int If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered )
 ***********************************************************************/
 static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
 {
-    int i, k;
     assert( pDom->nLeaves <= pCut->nLeaves );
-    for ( i = 0; i < (int)pDom->nLeaves; i++ )
-    {
-        for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            if ( pDom->pLeaves[i] == pCut->pLeaves[k] )
-                break;
-        if ( k == (int)pCut->nLeaves ) // node i in pDom is not contained in pCut
-            return 0;
-    }
-    // every node in pDom is contained in pCut
-    return 1;
+    return Abc_CutIsContained( pCut->pLeaves, pCut->nLeaves, pDom->pLeaves, pDom->nLeaves );
 }
 
 /**Function*************************************************************
@@ -289,63 +280,10 @@ FlushCut1:
 ***********************************************************************/
 int If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t * pC )
 { 
-    int nSizeC0 = pC0->nLeaves;
-    int nSizeC1 = pC1->nLeaves;
-    int nLimit  = pC0->nLimit;
-    int i, k, c, s;
-
-    // both cuts are the largest
-    if ( nSizeC0 == nLimit && nSizeC1 == nLimit )
-    {
-        for ( i = 0; i < nSizeC0; i++ )
-        {
-            if ( pC0->pLeaves[i] != pC1->pLeaves[i] )
-                return 0;
-            pC->pLeaves[i] = pC0->pLeaves[i];
-        }
-        pC->nLeaves = nLimit;
-        pC->uSign = pC0->uSign | pC1->uSign;
-        return 1;
-    }
-
-    // compare two cuts with different numbers
-    i = k = c = s = 0; 
-    if ( nSizeC0 == 0 ) goto FlushCut1;
-    if ( nSizeC1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLimit ) return 0;
-        if ( pC0->pLeaves[i] < pC1->pLeaves[k] )
-        {
-            pC->pLeaves[c++] = pC0->pLeaves[i++];
-            if ( i == nSizeC0 ) goto FlushCut1;
-        }
-        else if ( pC0->pLeaves[i] > pC1->pLeaves[k] )
-        {
-            pC->pLeaves[c++] = pC1->pLeaves[k++];
-            if ( k == nSizeC1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC->pLeaves[c++] = pC0->pLeaves[i++]; k++;
-            if ( i == nSizeC0 ) goto FlushCut1;
-            if ( k == nSizeC1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSizeC0 > nLimit + i ) return 0;
-    while ( i < nSizeC0 )
-        pC->pLeaves[c++] = pC0->pLeaves[i++];
-    pC->nLeaves = c;
-    pC->uSign = pC0->uSign | pC1->uSign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSizeC1 > nLimit + k ) return 0;
-    while ( k < nSizeC1 )
-        pC->pLeaves[c++] = pC1->pLeaves[k++];
-    pC->nLeaves = c;
+    int nSize = Abc_CutMergeOrder( pC0->pLeaves, pC0->nLeaves, pC1->pLeaves, pC1->nLeaves, pC->pLeaves, pC0->nLimit );
+    if ( nSize == -1 )
+        return 0;
+    pC->nLeaves = nSize;
     pC->uSign = pC0->uSign | pC1->uSign;
     return 1;
 }
@@ -1046,18 +1046,12 @@ int If_DsdObjFindOrAdd( If_DsdMan_t * p, int Type, int * pLits, int nLits, word
   SeeAlso     []
 
 ***********************************************************************/
-void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+void If_DsdManSaveFile( If_DsdMan_t * p, FILE * pFile )
 {
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
     word * pTruth; 
     int i, v, Num;
-    FILE * pFile = fopen( pFileName ? pFileName : p->pStore, "wb" );
-    if ( pFile == NULL )
-    {
-        printf( "Writing DSD manager file \"%s\" has failed.\n", pFileName ? pFileName : p->pStore );
-        return;
-    }
     fwrite( DSD_VERSION, 4, 1, pFile );
     Num = p->nVars;
     fwrite( &Num, 4, 1, pFile );
@@ -1101,9 +1095,19 @@ void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
     fwrite( &Num, 4, 1, pFile );
     if ( Num )
         fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
+}
+void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
+{
+    FILE * pFile = fopen( pFileName ? pFileName : p->pStore, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Writing DSD manager file \"%s\" has failed.\n", pFileName ? pFileName : p->pStore );
+        return;
+    }
+    If_DsdManSaveFile( p, pFile );
     fclose( pFile );
 }
-If_DsdMan_t * If_DsdManLoad( char * pFileName )
+If_DsdMan_t * If_DsdManLoadFile( FILE * pFile, char * pFileName )
 {
     If_DsdMan_t * p;
     If_DsdObj_t * pObj; 
@@ -1112,12 +1116,6 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     unsigned * pSpot;
     word * pTruth;
     int i, v, Num, Num2, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
-    {
-        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
-        return NULL;
-    }
     RetValue = fread( pBuffer, 4, 1, pFile );
     if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
     {
@@ -1195,6 +1193,18 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         p->pCellStr = ABC_CALLOC( char, Num + 1 );
         RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
     }
+    return p;
+}
+If_DsdMan_t * If_DsdManLoad( char * pFileName )
+{
+    If_DsdMan_t * p;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
+        return NULL;
+    }
+    p = If_DsdManLoadFile( pFile, pFileName );
     fclose( pFile );
     return p;
 }
@@ -21,6 +21,17 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -30,6 +41,9 @@ ABC_NAMESPACE_IMPL_START
 extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pPerm1, int fCompl0, int fCompl1, int nVars );
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
+
+#define IF_PAR_THR_MAX    64    // the largest number of threads
+#define IF_PAR_NODE_MIN   64    // the smallest number of nodes on a level processed by several threads
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -152,14 +166,15 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Finds the best cut for the given node.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  The cutset of the node should be assigned by the caller.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static void If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
 {
     If_Set_t * pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
@@ -181,8 +196,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    // get the cutset
+    pCutSet = pObj->pCutSet;
+    assert( pCutSet != NULL && pCutSet->nCuts == 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -483,6 +499,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+    // compute the cuts
+    If_ObjPerformMappingAndInt( p, pObj, Mode, fPreprocess, fFirst );
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -571,6 +594,196 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping pass can be performed in parallel.]
+
+  Description [In the delay-oriented passes (Mode 0), the cuts of a node
+  depend only on the node and the best cuts of the nodes on lower levels,
+  so the nodes on the same level can be processed in any order and the
+  result is the same as in the serial pass. The area recovery passes
+  (Mode 1 and 2) reference and dereference the best cuts in the fanin
+  cones, which makes the result depend on the order. The features using
+  shared tables (truth tables, DSDs, libraries, user callbacks), choices,
+  and boxes are also not supported.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingParCheck( If_Man_t * p, int Mode )
+{
+#ifdef ABC_USE_PTHREADS
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nProcs < 2 || Mode != 0 )
+        return 0;
+    if ( p->pManTim != NULL || p->nChoices > 0 )
+        return 0;
+    if ( pPars->fTruth || pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->fPower || pPars->fLiftLeaves )
+        return 0;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass level by level using several threads.]
+
+  Description [Before processing a level, the cutsets of its nodes are
+  assigned in the topological order. Each thread maps a contiguous range
+  of nodes of the level. The cutsets of the fanins are released after all
+  nodes of the level are mapped. Each thread uses a copy of the manager to
+  update the cut counters, which are added to the manager at the end.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct If_ParThData_t_ If_ParThData_t;
+struct If_ParThData_t_
+{
+    If_Man_t         Man;         // the copy of the manager
+    Vec_Int_t *      vLevel;      // the nodes of the current level (NULL to stop)
+    int              iStart;      // the first node in the range
+    int              iStop;       // the node after the last one in the range
+    int              Mode;        // the mapping mode
+    int              fPreprocess; // the preprocessing flag
+    int              fFirst;      // the first pass flag
+    volatile int     fWorking;    // the thread is working
+};
+static void If_ManParCleanStats( If_Man_t * p )
+{
+    p->nCutsMerged     = 0;
+    p->nCutsTotal      = 0;
+    p->nCutsCountAll   = 0;
+    p->nCutsUselessAll = 0;
+    p->nCuts5          = 0;
+    p->nCuts5a         = 0;
+    memset( p->nCutsCount,   0, sizeof(p->nCutsCount) );
+    memset( p->nCutsUseless, 0, sizeof(p->nCutsUseless) );
+}
+static void If_ManParAddStats( If_Man_t * p, If_Man_t * pThr )
+{
+    int i;
+    p->nCutsMerged     += pThr->nCutsMerged;
+    p->nCutsTotal      += pThr->nCutsTotal;
+    p->nCutsCountAll   += pThr->nCutsCountAll;
+    p->nCutsUselessAll += pThr->nCutsUselessAll;
+    p->nCuts5          += pThr->nCuts5;
+    p->nCuts5a         += pThr->nCuts5a;
+    for ( i = 0; i < 32; i++ )
+    {
+        p->nCutsCount[i]   += pThr->nCutsCount[i];
+        p->nCutsUseless[i] += pThr->nCutsUseless[i];
+    }
+}
+static void If_ManParMapRange( If_ParThData_t * pThData )
+{
+    If_Obj_t * pObj;
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        pObj = If_ManObj( &pThData->Man, Vec_IntEntry(pThData->vLevel, i) );
+        If_ObjPerformMappingAndInt( &pThData->Man, pObj, pThData->Mode, pThData->fPreprocess, pThData->fFirst );
+    }
+}
+static void * If_ManParWorkerThread( void * pArg )
+{
+    If_ParThData_t * pThData = (If_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->vLevel == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        If_ManParMapRange( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_ParThData_t * pThData = ABC_CALLOC( If_ParThData_t, IF_PAR_THR_MAX );
+    pthread_t WorkerThread[IF_PAR_THR_MAX];
+    Vec_Wec_t * vLevels = If_ManLevelize( p );
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj;
+    int i, k, status, nNodes, nProcs = Abc_MinInt( p->pPars->nProcs, IF_PAR_THR_MAX );
+    // start the threads (thread 0 is the calling thread)
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].Man         = *p;
+        If_ManParCleanStats( &pThData[i].Man );
+        pThData[i].Mode        = Mode;
+        pThData[i].fPreprocess = fPreprocess;
+        pThData[i].fFirst      = fFirst;
+        if ( i == 0 )
+            continue;
+        status = pthread_create( WorkerThread + i, NULL, If_ManParWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    // map the nodes level by level
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        nNodes = Vec_IntSize( vLevel );
+        If_ManForEachObjVec( vLevel, p, pObj, k )
+            If_ManSetupNodeCutSet( p, pObj );
+        if ( nNodes < IF_PAR_NODE_MIN )
+        {
+            pThData[0].vLevel = vLevel;
+            pThData[0].iStart = 0;
+            pThData[0].iStop  = nNodes;
+            If_ManParMapRange( pThData );
+        }
+        else
+        {
+            for ( k = nProcs - 1; k >= 0; k-- )
+            {
+                pThData[k].vLevel = vLevel;
+                pThData[k].iStart = k * nNodes / nProcs;
+                pThData[k].iStop  = (k + 1) * nNodes / nProcs;
+                if ( k > 0 )
+                    pThData[k].fWorking = 1;
+                else
+                    If_ManParMapRange( pThData );
+            }
+            // wait till threads finish
+            for ( k = 1; k < nProcs; k++ )
+                if ( pThData[k].fWorking )
+                    k = 0;
+        }
+        If_ManForEachObjVec( vLevel, p, pObj, k )
+            If_ManDerefNodeCutSet( p, pObj );
+    }
+    // stop the threads
+    for ( i = 1; i < nProcs; i++ )
+    {
+        assert( !pThData[i].fWorking );
+        pThData[i].vLevel = NULL;
+        pThData[i].fWorking = 1;
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        If_ManParAddStats( p, &pThData[i].Man );
+    Vec_WecFree( vLevels );
+    ABC_FREE( pThData );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -635,6 +848,10 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+#ifdef ABC_USE_PTHREADS
+    else if ( If_ManPerformMappingParCheck( p, Mode ) )
+        If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst );
+#endif
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
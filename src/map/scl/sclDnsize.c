@@ -148,16 +148,12 @@ p->timeSize += Abc_Clock() - clk;
     if ( gateBest >= 0 )
     {
         pCellNew = SC_LibCell( p->pLib, gateBest );
-        Abc_SclObjSetCell( pObj, pCellNew );
-        p->SumArea += pCellNew->area - pCellOld->area;
-//        printf( "%f   %f -> %f\n", pCellNew->area - pCellOld->area, p->SumArea - (pCellNew->area - pCellOld->area), p->SumArea );
 //        printf( "%6d  %20s -> %20s  %f -> %f\n", Abc_ObjId(pObj), pCellOld->pName, pCellNew->pName, pCellOld->area, pCellNew->area );
         // mark used nodes with the current trav ID
         Abc_NtkForEachObjVec( vNodes, p->pNtk, pTemp, k )
             Abc_NodeSetTravIdCurrent( pTemp );
-        // update load and timing...
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        Abc_SclTimeIncInsert( p, pObj );
+        // update gate, load and timing
+        Abc_SclTimeIncUpdateCell( p, pObj, pCellNew );
         return 1;
     }
     return 0;
@@ -295,10 +291,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
                 Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
 
             clk = Abc_Clock();
-            if ( Vec_IntSize(p->vChanged) )
-                Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, &p->SumArea, &p->MaxDelay, pPars->fUseDept, pPars->DelayUser );
+            Abc_SclTimeIncUpdate( p, pPars->fUseDept );
             p->timeTime += Abc_Clock() - clk;
 
             p->MaxDelay = Abc_SclReadMaxDelay( p );
@@ -33,6 +33,12 @@
 #include <math.h>
 #include "misc/vec/vec.h"
 
+// SSE2 is part of the x86-64 baseline, so this path does not need any compiler flags
+#if defined(__SSE2__) || defined(_M_X64)
+#define ABC_SCL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 ABC_NAMESPACE_HEADER_START
 
 
@@ -65,6 +71,13 @@ struct SC_Pair_
     float      rise;
     float      fall;
 };
+typedef struct SC_Point_        SC_Point;
+struct SC_Point_ 
+{
+    int        iData;            // the first data entry of the lookup cell
+    float      sfrac;            // the position of the slew inside the cell
+    float      lfrac;            // the position of the load inside the cell
+};
 typedef struct SC_PairI_        SC_PairI;
 struct SC_PairI_ 
 {
@@ -85,6 +98,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads used by upsizing
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -154,6 +168,9 @@ struct SC_Surface_
     Vec_Int_t      vIndex1I;       // Vec<float>       -- correspondes to "index_2" in the liberty file (for timing: load)
     Vec_Ptr_t      vDataI;         // Vec<Vec<float> > -- 'data[i0][i1]' gives value at '(index0[i0], index1[i1])' 
     float          approx[3][6];
+    float *        pData;          // -- 'data' stored row by row (derived by Abc_SclLibPrepareLookup)
+    float          StepInv0;       // -- the inverse step of "index_1" if it is uniform, or 0 otherwise
+    float          StepInv1;       // -- the inverse step of "index_2" if it is uniform, or 0 otherwise
 };
 
 struct SC_Timing_ 
@@ -165,6 +182,7 @@ struct SC_Timing_
     SC_Surface     pCellFall;
     SC_Surface     pRiseTrans;     // -- Used to compute output slew
     SC_Surface     pFallTrans;
+    int            fShared;        // -- the four tables have the same indexes
 };
 
 struct SC_Timings_ 
@@ -391,6 +409,7 @@ static inline void Abc_SclSurfaceFree( SC_Surface * p )
     Vec_IntErase( &p->vIndex1I );
     Vec_VecErase( (Vec_Vec_t *)&p->vData );
     Vec_VecErase( (Vec_Vec_t *)&p->vDataI );
+    ABC_FREE( p->pData );
     ABC_FREE( p->pName );
 //    ABC_FREE( p );
 }
@@ -476,48 +495,137 @@ static inline void Abc_SclLibFree( SC_Lib * p )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Scl_LibLookupIndex( float * pIndex, int nIndex, float StepInv, float Value )
+{
+    int iLo = 0, iHi = nIndex - 2, iMid;
+    if ( StepInv > 0 )
+    {
+        float Pos = (Value - pIndex[0]) * StepInv;
+        iMid = Pos <= 0 ? 0 : (Pos >= iHi ? iHi : (int)Pos);
+        // rounding may put the value into the neighboring segment
+        if ( iMid < iHi && pIndex[iMid+1] <= Value )
+            iMid++;
+        else if ( iMid > 0 && pIndex[iMid] > Value )
+            iMid--;
+        return iMid;
+    }
+    while ( iLo < iHi )
+    {
+        iMid = (iLo + iHi + 1) >> 1;
+        if ( pIndex[iMid] <= Value )
+            iLo = iMid;
+        else
+            iHi = iMid - 1;
+    }
+    return iLo;
+}
+static inline void Scl_LibLookupPoint( SC_Surface * p, float slew, float load, SC_Point * pPoint )
+{
+    float * pIndex0 = Vec_FltArray(&p->vIndex0);
+    float * pIndex1 = Vec_FltArray(&p->vIndex1);
+    int s = Scl_LibLookupIndex( pIndex0, Vec_FltSize(&p->vIndex0), p->StepInv0, slew );
+    int l = Scl_LibLookupIndex( pIndex1, Vec_FltSize(&p->vIndex1), p->StepInv1, load );
+    pPoint->iData = s * Vec_FltSize(&p->vIndex1) + l;
+    pPoint->sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+    pPoint->lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+}
+static inline float Scl_LibLookupValue( SC_Surface * p, SC_Point * pPoint )
+{
+    float * pDataS  = p->pData + pPoint->iData;
+    float * pDataS1 = pDataS + Vec_FltSize(&p->vIndex1);
+    float p0 = pDataS [0] + pPoint->lfrac * (pDataS [1] - pDataS [0]);
+    float p1 = pDataS1[0] + pPoint->lfrac * (pDataS1[1] - pDataS1[0]);
+    return p0 + pPoint->sfrac * (p1 - p0);      // <<== multiply result with K factor here 
+}
 static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 {
-    float * pIndex0, * pIndex1, * pDataS, * pDataS1;
-    float sfrac, lfrac, p0, p1;
-    int s, l;
-
+    SC_Point Point;
+    assert( p->pData != NULL );
     // handle constant table
     if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
+        return p->pData[0];
+    // interpolate (or extrapolate) function value from sample points
+    Scl_LibLookupPoint( p, slew, load, &Point );
+    return Scl_LibLookupValue( p, &Point );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Lookup table delay computation for four tables at once.]
+
+  Description [The tables should have the same indexes. Interpolates
+  table pSurfs[k] at point pPoints[k] and writes the result into pRes[k].]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_LibLookup4( SC_Surface ** pSurfs, SC_Point ** pPoints, float * pRes )
+{
+    int nRow = Vec_FltSize(&pSurfs[0]->vIndex1);
+    float * pD0 = pSurfs[0]->pData + pPoints[0]->iData;
+    float * pD1 = pSurfs[1]->pData + pPoints[1]->iData;
+    float * pD2 = pSurfs[2]->pData + pPoints[2]->iData;
+    float * pD3 = pSurfs[3]->pData + pPoints[3]->iData;
+#ifdef ABC_SCL_USE_SSE2
+    __m128 d00 = _mm_setr_ps( pD0[0],      pD1[0],      pD2[0],      pD3[0]      );
+    __m128 d01 = _mm_setr_ps( pD0[1],      pD1[1],      pD2[1],      pD3[1]      );
+    __m128 d10 = _mm_setr_ps( pD0[nRow],   pD1[nRow],   pD2[nRow],   pD3[nRow]   );
+    __m128 d11 = _mm_setr_ps( pD0[nRow+1], pD1[nRow+1], pD2[nRow+1], pD3[nRow+1] );
+    __m128 sf  = _mm_setr_ps( pPoints[0]->sfrac, pPoints[1]->sfrac, pPoints[2]->sfrac, pPoints[3]->sfrac );
+    __m128 lf  = _mm_setr_ps( pPoints[0]->lfrac, pPoints[1]->lfrac, pPoints[2]->lfrac, pPoints[3]->lfrac );
+    __m128 p0  = _mm_add_ps( d00, _mm_mul_ps(lf, _mm_sub_ps(d01, d00)) );
+    __m128 p1  = _mm_add_ps( d10, _mm_mul_ps(lf, _mm_sub_ps(d11, d10)) );
+    _mm_storeu_ps( pRes, _mm_add_ps(p0, _mm_mul_ps(sf, _mm_sub_ps(p1, p0))) );
+#else
+    float * pDs[4] = { pD0, pD1, pD2, pD3 };
+    int k;
+    for ( k = 0; k < 4; k++ )
     {
-        Vec_Flt_t * vTemp = (Vec_Flt_t *)Vec_PtrEntry(&p->vData, 0);
-        assert( Vec_PtrSize(&p->vData) == 1 );
-        assert( Vec_FltSize(vTemp) == 1 );
-        return Vec_FltEntry(vTemp, 0);
+        float p0 = pDs[k][0]    + pPoints[k]->lfrac * (pDs[k][1]      - pDs[k][0]);
+        float p1 = pDs[k][nRow] + pPoints[k]->lfrac * (pDs[k][nRow+1] - pDs[k][nRow]);
+        pRes[k] = p0 + pPoints[k]->sfrac * (p1 - p0);
     }
+#endif
+}
 
-    // Find closest sample points in surface:
-    pIndex0 = Vec_FltArray(&p->vIndex0);
-    for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
-        if ( pIndex0[s] > slew )
-            break;
-    s--;
-
-    pIndex1 = Vec_FltArray(&p->vIndex1);
-    for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
-        if ( pIndex1[l] > load )
-            break;
-    l--;
+/**Function*************************************************************
 
-    // Interpolate (or extrapolate) function value from sample points:
-    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
-    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+  Synopsis    [Timing propagation through the arc.]
 
-    pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
-    pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+  Description [When the tables of the arc have the same indexes, the 
+  lookup points are computed once for each transition of the output and 
+  shared by the delay and the slew tables, which are interpolated together.]
+               
+  SideEffects []
 
-    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
-    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+  SeeAlso     []
 
-    return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
+***********************************************************************/
+static inline void Scl_LibPinArrivalShared( SC_Timing * pTime, float ArrR, float ArrF, float SlewR, float SlewF, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
+{
+    SC_Surface * pSurfs[4] = { &pTime->pCellRise, &pTime->pCellFall, &pTime->pRiseTrans, &pTime->pFallTrans };
+    SC_Point Rise, Fall, * pPoints[4] = { &Rise, &Fall, &Rise, &Fall };
+    float Res[4];
+    Scl_LibLookupPoint( &pTime->pCellRise, SlewR, pLoad->rise, &Rise );
+    Scl_LibLookupPoint( &pTime->pCellRise, SlewF, pLoad->fall, &Fall );
+    Scl_LibLookup4( pSurfs, pPoints, Res );
+    pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  ArrR + Res[0] );
+    pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  ArrF + Res[1] );
+    pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,        Res[2] );
+    pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,        Res[3] );
 }
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    if ( pTime->fShared )
+    {
+        if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+            Scl_LibPinArrivalShared( pTime, pArrIn->rise, pArrIn->fall, pSlewIn->rise, pSlewIn->fall, pLoad, pArrOut, pSlewOut );
+        if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+            Scl_LibPinArrivalShared( pTime, pArrIn->fall, pArrIn->rise, pSlewIn->fall, pSlewIn->rise, pLoad, pArrOut, pSlewOut );
+        return;
+    }
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
         pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
@@ -535,6 +643,22 @@ static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pa
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
 {
+    if ( pTime->fShared && pTime->tsense == sc_ts_Non )
+    {
+        SC_Surface * pSurfs[4] = { &pTime->pCellRise, &pTime->pCellFall, &pTime->pCellRise, &pTime->pCellFall };
+        SC_Point Points[4], * pPoints[4] = { Points, Points + 1, Points + 2, Points + 3 };
+        float Res[4];
+        Scl_LibLookupPoint( &pTime->pCellRise, pSlewIn->rise, pLoad->rise, Points     );
+        Scl_LibLookupPoint( &pTime->pCellRise, pSlewIn->fall, pLoad->fall, Points + 1 );
+        Scl_LibLookupPoint( &pTime->pCellRise, pSlewIn->fall, pLoad->rise, Points + 2 );
+        Scl_LibLookupPoint( &pTime->pCellRise, pSlewIn->rise, pLoad->fall, Points + 3 );
+        Scl_LibLookup4( pSurfs, pPoints, Res );
+        pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->rise + Res[0] );
+        pDepIn->fall  = Abc_MaxFloat( pDepIn->fall,  pDepOut->fall + Res[1] );
+        pDepIn->fall  = Abc_MaxFloat( pDepIn->fall,  pDepOut->rise + Res[2] );
+        pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->fall + Res[3] );
+        return;
+    }
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
         pDepIn->rise  = Abc_MaxFloat( pDepIn->rise,  pDepOut->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
@@ -735,11 +859,14 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 
 /*=== sclLiberty.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLibertyCache( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
+extern SC_Lib *      Abc_SclReadCache( char * pCacheName, char * pFileName );
+extern int           Abc_SclWriteCache( char * pCacheName, char * pFileName, Vec_Str_t * vOut );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
@@ -751,6 +878,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern void          Abc_SclLibPrepareLookup( SC_Lib * p );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
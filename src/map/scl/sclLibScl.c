@@ -26,6 +26,12 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +39,12 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the header of the library cache: magic (4 bytes), version (4 bytes), 
+// image size (4 bytes), image checksum (4 bytes), size and modification 
+// time of the Liberty file (8 bytes each)
+#define SCL_CACHE_MAGIC  "SCLC"
+#define SCL_CACHE_HEAD   32
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -175,6 +187,7 @@ SC_Lib * Abc_SclReadFromGenlib( void * pLib0 )
     // hash gates by name
     Abc_SclHashCells( p );
     Abc_SclLinkCells( p );
+    Abc_SclLibPrepareLookup( p );
     return p;
 }
 
@@ -412,6 +425,7 @@ SC_Lib * Abc_SclReadFromStr( Vec_Str_t * vOut )
     // hash gates by name
     Abc_SclHashCells( p );
     Abc_SclLinkCells( p );
+    Abc_SclLibPrepareLookup( p );
     return p;
 }
 SC_Lib * Abc_SclReadFromFile( char * pFileName )
@@ -629,6 +643,136 @@ void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
     Vec_StrFree( vOut );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reading/writing the library cache.]
+
+  Description [The cache stores the SCL image of a Liberty file, which
+  is derived by the Liberty parser, together with the size and the time 
+  of the last change of the Liberty file. The cache is used only if the 
+  Liberty file has not changed. The cache is mapped into memory, so the 
+  processes reading the same library share its pages. The cache is written 
+  into a temporary file, which is then renamed, so that other processes 
+  never see a partially written cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Abc_SclCacheChecksum( char * pData, int nSize )
+{
+    unsigned a = 1, b = 0;
+    int i;
+    for ( i = 0; i < nSize; i++ )
+    {
+        a += (unsigned char)pData[i];
+        b += a;
+        if ( (i & 0xFFF) == 0xFFF )
+            a %= 65521, b %= 65521;
+    }
+    return ((b % 65521) << 16) | (a % 65521);
+}
+static void Abc_SclCacheHeader( char * pHead, char * pFileName, Vec_Str_t * vOut )
+{
+    struct stat Stat;
+    word Size = 0, Time = 0;
+    int Version = ABC_SCL_CUR_VERSION, nImage = Vec_StrSize(vOut);
+    unsigned Check = Abc_SclCacheChecksum( Vec_StrArray(vOut), Vec_StrSize(vOut) );
+    if ( stat( pFileName, &Stat ) == 0 )
+        Size = (word)Stat.st_size, Time = (word)Stat.st_mtime;
+    memcpy( pHead,      SCL_CACHE_MAGIC, 4 );
+    memcpy( pHead +  4, &Version, 4 );
+    memcpy( pHead +  8, &nImage,  4 );
+    memcpy( pHead + 12, &Check,   4 );
+    memcpy( pHead + 16, &Size,    8 );
+    memcpy( pHead + 24, &Time,    8 );
+}
+SC_Lib * Abc_SclReadCache( char * pCacheName, char * pFileName )
+{
+    SC_Lib * p = NULL;
+    Vec_Str_t Image, * vImage = &Image;
+    FILE * pFile;
+    char * pBuffer = NULL, pHead[SCL_CACHE_HEAD];
+    size_t nSize = 0;
+    int fMapped = 0;
+    pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        if ( fstat( fileno(pFile), &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fileno(pFile), 0 );
+            if ( pMap != MAP_FAILED )
+            {
+                pBuffer = (char *)pMap;
+                nSize   = (size_t)Stat.st_size;
+                fMapped = 1;
+            }
+        }
+    }
+#endif
+    if ( !fMapped )
+    {
+        long nFileSize;
+        fseek( pFile, 0, SEEK_END );
+        nFileSize = ftell( pFile );
+        rewind( pFile );
+        pBuffer = ABC_ALLOC( char, Abc_MaxInt(nFileSize, 0) + 1 );
+        nSize   = nFileSize > 0 ? fread( pBuffer, 1, (size_t)nFileSize, pFile ) : 0;
+    }
+    fclose( pFile );
+    // check that the cache is complete and the Liberty file did not change
+    if ( nSize > SCL_CACHE_HEAD && nSize - SCL_CACHE_HEAD < 0x7FFFFFFF )
+    {
+        Image.nCap   = Image.nSize = (int)(nSize - SCL_CACHE_HEAD);
+        Image.pArray = pBuffer + SCL_CACHE_HEAD;
+        Abc_SclCacheHeader( pHead, pFileName, vImage );
+        if ( !memcmp( pHead, pBuffer, SCL_CACHE_HEAD ) )
+            p = Abc_SclReadFromStr( vImage );
+    }
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pBuffer, nSize );
+    else
+#endif
+    ABC_FREE( pBuffer );
+    if ( p == NULL )
+        return NULL;
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( p );
+    return p;
+}
+int Abc_SclWriteCache( char * pCacheName, char * pFileName, Vec_Str_t * vOut )
+{
+    FILE * pFile;
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 20 ), pHead[SCL_CACHE_HEAD];
+    int RetValue = 0;
+#ifndef _WIN32
+    sprintf( pTempName, "%s.%d", pCacheName, (int)getpid() );
+#else
+    sprintf( pTempName, "%s", pCacheName );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile != NULL )
+    {
+        Abc_SclCacheHeader( pHead, pFileName, vOut );
+        RetValue  = fwrite( pHead, 1, SCL_CACHE_HEAD, pFile ) == SCL_CACHE_HEAD;
+        RetValue &= fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile ) == (size_t)Vec_StrSize(vOut);
+        RetValue &= fclose( pFile ) == 0;
+#ifndef _WIN32
+        if ( RetValue )
+            RetValue = rename( pTempName, pCacheName ) == 0;
+        if ( !RetValue )
+            unlink( pTempName );
+#endif
+    }
+    ABC_FREE( pTempName );
+    return RetValue;
+}
+
 
 /**Function*************************************************************
 
@@ -780,6 +780,75 @@ void Abc_SclLibNormalize( SC_Lib * p )
             Abc_SclLibNormalizeSurface( &pTiming->pFallTrans, Time, Load );
         }
     }
+    Abc_SclLibPrepareLookup( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the data used by the table lookup.]
+
+  Description [Should be called after the tables are changed. Stores the
+  table data row by row, detects the indexes with uniform steps, and 
+  marks the arcs, whose four tables have the same indexes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static float Abc_SclLibIndexStepInv( Vec_Flt_t * vIndex )
+{
+    float Step, Entry;
+    int i;
+    if ( Vec_FltSize(vIndex) < 3 )
+        return 0;
+    Step = (Vec_FltEntryLast(vIndex) - Vec_FltEntry(vIndex, 0)) / (Vec_FltSize(vIndex) - 1);
+    if ( Step <= 0 )
+        return 0;
+    Vec_FltForEachEntryStart( vIndex, Entry, i, 1 )
+        if ( fabs(Entry - Vec_FltEntry(vIndex, i-1) - Step) > 0.001 * Step )
+            return 0;
+    return 1.0 / Step;
+}
+static void Abc_SclLibPrepareSurface( SC_Surface * p )
+{
+    Vec_Flt_t * vArray;
+    int k, nRow = Vec_FltSize(&p->vIndex1);
+    ABC_FREE( p->pData );
+    p->pData = ABC_CALLOC( float, Abc_MaxInt(1, Vec_PtrSize(&p->vData) * nRow) );
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vArray, k )
+    {
+        assert( Vec_FltSize(vArray) == nRow );
+        memcpy( p->pData + k * nRow, Vec_FltArray(vArray), sizeof(float) * nRow );
+    }
+    p->StepInv0 = Abc_SclLibIndexStepInv( &p->vIndex0 );
+    p->StepInv1 = Abc_SclLibIndexStepInv( &p->vIndex1 );
+}
+static int Abc_SclLibSameIndex( SC_Surface * p, SC_Surface * q )
+{
+    return Vec_FltSize(&p->vIndex0) >= 2 && Vec_FltSize(&p->vIndex1) >= 2 && 
+        Vec_FltEqual(&p->vIndex0, &q->vIndex0) && Vec_FltEqual(&p->vIndex1, &q->vIndex1);
+}
+void Abc_SclLibPrepareLookup( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pTimings;
+    SC_Timing * pTiming;
+    int i, k, m, n;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPin( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pTimings, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pTimings->vTimings, pTiming, n )
+    {
+        Abc_SclLibPrepareSurface( &pTiming->pCellRise );
+        Abc_SclLibPrepareSurface( &pTiming->pCellFall );
+        Abc_SclLibPrepareSurface( &pTiming->pRiseTrans );
+        Abc_SclLibPrepareSurface( &pTiming->pFallTrans );
+        pTiming->fShared = Abc_SclLibSameIndex( &pTiming->pCellRise, &pTiming->pCellFall ) &&
+                           Abc_SclLibSameIndex( &pTiming->pCellRise, &pTiming->pRiseTrans ) &&
+                           Abc_SclLibSameIndex( &pTiming->pCellRise, &pTiming->pFallTrans );
+    }
 }
 
 /**Function*************************************************************
@@ -1635,19 +1635,65 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     return vOut;
 }
 SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+{
+    return Abc_SclReadLibertyCache( pFileName, 0, fVerbose, fVeryVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the Liberty library using the cache.]
+
+  Description [If fUseCache is set, the library is loaded from the cache
+  file "<pFileName>.sclcache" when it is up to date. Otherwise, the Liberty
+  file is parsed and the cache is updated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLibertyCache( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    char * pCacheName = NULL;
+    abctime clk = Abc_Clock();
+    if ( fUseCache )
+    {
+        pCacheName = ABC_ALLOC( char, strlen(pFileName) + 10 );
+        sprintf( pCacheName, "%s.sclcache", pFileName );
+        pLib = Abc_SclReadCache( pCacheName, pFileName );
+        if ( pLib != NULL )
+        {
+            if ( fVerbose )
+            {
+                printf( "Library \"%s\" from \"%s\" has %d cells (loaded from cache \"%s\").  ", pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            }
+            ABC_FREE( pCacheName );
+            return pLib;
+        }
+    }
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     // collect relevant data
     vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
+    // save the cache
+    if ( pCacheName && !Abc_SclWriteCache( pCacheName, pFileName, vStr ) )
+        printf( "Cannot write library cache \"%s\".\n", pCacheName );
+    ABC_FREE( pCacheName );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
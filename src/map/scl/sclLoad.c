@@ -228,6 +228,22 @@ void Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanou
     pLoad->rise += pPin->rise_cap;
     pLoad->fall += pPin->fall_cap;
 }
+void Abc_SclUpdateLoadMove( SC_Man * p, Abc_Obj_t * pFanout, Abc_Obj_t * pFanin, Abc_Obj_t * pFaninNew )
+{
+    SC_Pin * pPin;
+    SC_Pair * pLoad;
+    int iFanin = Abc_NodeFindFanin( pFanout, pFanin );
+    assert( iFanin >= 0 );
+    pPin = SC_CellPin( Abc_SclObjCell(pFanout), iFanin );
+    // update load of the old fanin
+    pLoad = Abc_SclObjLoad( p, pFanin );
+    pLoad->rise -= pPin->rise_cap;
+    pLoad->fall -= pPin->fall_cap;
+    // update load of the new fanin
+    pLoad = Abc_SclObjLoad( p, pFaninNew );
+    pLoad->rise += pPin->rise_cap;
+    pLoad->fall += pPin->fall_cap;
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
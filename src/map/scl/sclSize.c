@@ -351,7 +351,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
         p->nEstNodes++;
     }
     // get the library cell
-    pCell = Abc_SclObjCell( pObj );
+    pCell = Abc_SclManObjCell( p, pObj );
     // compute for each fanin
     Abc_ObjForEachFanin( pObj, pFanin, k )
     {
@@ -457,7 +457,8 @@ static inline void Abc_SclTimeIncAddNode( SC_Man * p, Abc_Obj_t * pObj )
     assert( !Abc_ObjIsLatch(pObj) );
     assert( pObj->fMarkC == 0 );
     pObj->fMarkC = 1;
-    Vec_IntPush( Vec_WecEntry(p->vLevels, Abc_ObjLevel(pObj)), Abc_ObjId(pObj) );
+    // the levels may grow when the fanins are redirected
+    Vec_WecPush( p->vLevels, Abc_ObjLevel(pObj), Abc_ObjId(pObj) );
     p->nIncUpdates++;
 }
 static inline void Abc_SclTimeIncAddFanins( SC_Man * p, Abc_Obj_t * pObj )
@@ -479,16 +480,17 @@ static inline void Abc_SclTimeIncAddFanouts( SC_Man * p, Abc_Obj_t * pObj )
 }
 static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
 {
-    Vec_Int_t * vLevel;
     SC_Pair ArrOut, SlewOut;
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
     float E = (float)0.1;
     int i, k;
-    Vec_WecForEachLevel( p->vLevels, vLevel, i )
+    // adding fanouts may reallocate the levels, so the current level is fetched for each node
+    for ( i = 0; i < Vec_WecSize(p->vLevels); i++ )
     {
-        Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
+        for ( k = 0; k < Vec_IntSize(Vec_WecEntry(p->vLevels, i)); k++ )
         {
+            pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(Vec_WecEntry(p->vLevels, i), k) );
             if ( Abc_ObjIsCo(pObj) )
             {
                 Abc_SclObjDupFanin( p, pObj );
@@ -537,7 +539,7 @@ void Abc_SclTimeIncCheckLevel( Abc_Ntk_t * pNtk )
         if ( (int)pObj->Level != Abc_ObjLevelNew(pObj) )
             printf( "Level of node %d is out of date!\n", i );
 }
-int Abc_SclTimeIncUpdate( SC_Man * p )
+int Abc_SclTimeIncUpdate( SC_Man * p, int fDept )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
@@ -553,7 +555,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( fDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -578,6 +581,45 @@ void Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj )
     Abc_SclTimeIncUpdateLevel_rec( pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Incremental changes of the mapped network.]
+
+  Description [These procedures change the network while keeping the
+  loads and the levels up to date. The changed nodes are recorded, so
+  that the arrival/slew/departure times are updated by the next call to
+  Abc_SclTimeIncUpdate(), which propagates the changes level by level
+  only as long as the timing of the nodes changes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeIncUpdateCell( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pCellNew )
+{
+    SC_Cell * pCellOld = Abc_SclObjCell( pObj );
+    p->SumArea += pCellNew->area - pCellOld->area;
+    Abc_SclObjSetCell( pObj, pCellNew );
+    Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+    Abc_SclTimeIncInsert( p, pObj );
+}
+void Abc_SclTimeIncPatchFanin( SC_Man * p, Abc_Obj_t * pObj, Abc_Obj_t * pFanin, Abc_Obj_t * pFaninNew )
+{
+    // move the pin capacitance
+    Abc_SclUpdateLoadMove( p, pObj, pFanin, pFaninNew );
+    // update the wire loads, which depend on the fanout counts
+    Abc_SclAddWireLoad( p, pFanin, 1 );
+    Abc_SclAddWireLoad( p, pFaninNew, 1 );
+    Abc_ObjPatchFanin( pObj, pFanin, pFaninNew );
+    Abc_SclAddWireLoad( p, pFanin, 0 );
+    Abc_SclAddWireLoad( p, pFaninNew, 0 );
+    Abc_SclTimeIncUpdateLevel( pObj );
+    Abc_SclTimeIncInsert( p, pFanin );
+    Abc_SclTimeIncInsert( p, pFaninNew );
+    Abc_SclTimeIncInsert( p, pObj );
+}
+
 
 
 /**Function*************************************************************
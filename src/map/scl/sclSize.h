@@ -67,6 +67,7 @@ struct SC_Man_
     Vec_Flt_t *    vLoads3;       // backup storage for loads
     Vec_Flt_t *    vTimes2;       // backup storage for times
     Vec_Flt_t *    vTimes3;       // backup storage for slews
+    Vec_Int_t *    vGatesLocal;   // gates used by the timing of a thread copy of the manager (or NULL)
     // buffer trees
     float          EstLoadMax;    // max ratio of Cout/Cin when this kicks in
     float          EstLoadAve;    // average load of the gate
@@ -109,6 +110,8 @@ static inline SC_Lib  * Abc_SclObjLib( Abc_Obj_t * p )
 static inline int       Abc_SclObjCellId( Abc_Obj_t * p )                           { return Vec_IntEntry( p->pNtk->vGates, Abc_ObjId(p) );                               }
 static inline SC_Cell * Abc_SclObjCell( Abc_Obj_t * p )                             { int c = Abc_SclObjCellId(p); return c == -1 ? NULL:SC_LibCell(Abc_SclObjLib(p), c); }
 static inline void      Abc_SclObjSetCell( Abc_Obj_t * p, SC_Cell * pCell )         { Vec_IntWriteEntry( p->pNtk->vGates, Abc_ObjId(p), pCell->Id );                      }
+static inline SC_Cell * Abc_SclManObjCell( SC_Man * p, Abc_Obj_t * pObj )          { return p->vGatesLocal ? SC_LibCell(p->pLib, Vec_IntEntry(p->vGatesLocal, Abc_ObjId(pObj))) : Abc_SclObjCell(pObj); }
+static inline void      Abc_SclManObjSetCell( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pCell ) { if ( p->vGatesLocal ) Vec_IntWriteEntry( p->vGatesLocal, Abc_ObjId(pObj), pCell->Id ); else Abc_SclObjSetCell( pObj, pCell ); }
 
 static inline SC_Pair * Abc_SclObjLoad( SC_Man * p, Abc_Obj_t * pObj )              { return p->pLoads + Abc_ObjId(pObj);  }
 static inline SC_Pair * Abc_SclObjDept( SC_Man * p, Abc_Obj_t * pObj )              { return p->pDepts + Abc_ObjId(pObj);  }
@@ -559,6 +562,7 @@ extern void          Abc_SclAddWireLoad( SC_Man * p, Abc_Obj_t * pObj, int fSubt
 extern void          Abc_SclComputeLoad( SC_Man * p );
 extern void          Abc_SclUpdateLoad( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pOld, SC_Cell * pNew );
 extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Abc_Obj_t * pFanout );
+extern void          Abc_SclUpdateLoadMove( SC_Man * p, Abc_Obj_t * pFanout, Abc_Obj_t * pFanin, Abc_Obj_t * pFaninNew );
 /*=== sclSize.c ===============================================================*/
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
@@ -566,9 +570,11 @@ extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPa
 extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
-extern int           Abc_SclTimeIncUpdate( SC_Man * p );
+extern int           Abc_SclTimeIncUpdate( SC_Man * p, int fDept );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
+extern void          Abc_SclTimeIncUpdateCell( SC_Man * p, Abc_Obj_t * pObj, SC_Cell * pCellNew );
+extern void          Abc_SclTimeIncPatchFanin( SC_Man * p, Abc_Obj_t * pObj, Abc_Obj_t * pFanin, Abc_Obj_t * pFaninNew );
 extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
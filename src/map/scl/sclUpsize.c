@@ -20,6 +20,17 @@
 
 #include "sclSize.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,10 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SCL_PAR_THR_MAX    64    // the largest number of threads
+#define SCL_PAR_NODE_MIN   16    // the smallest number of nodes evaluated by several threads
+#define SCL_TIME_FULL_FREQ 10    // the number of iterations between full timing updates
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -237,27 +252,17 @@ void Abc_SclFindNodesToUpdate( Abc_Obj_t * pPivot, Vec_Int_t ** pvNodes, Vec_Int
                     Vec_IntPush( vNodes, Abc_ObjId(pNext2) );
         }
     Vec_IntUniqify( vNodes );
-    // label nodes
-    Abc_NtkForEachObjVec( vNodes, p, pObj, i )
-    {
-        assert( pObj->fMarkB == 0 );
-        pObj->fMarkB = 1;
-    }
     // collect nodes visible from the critical paths
+    // (the nodes are not labeled, because several threads may call this procedure)
     Vec_IntClear( vEvals );
     Abc_NtkForEachObjVec( vNodes, p, pObj, i )
         Abc_ObjForEachFanout( pObj, pNext, k )
-            if ( pNext->fMarkA && !pNext->fMarkB )
-//            if ( !pNext->fMarkB )
+            if ( pNext->fMarkA && Vec_IntFind(vNodes, Abc_ObjId(pNext)) == -1 )
             {
-                assert( pObj->fMarkB );
                 Vec_IntPush( vEvals, Abc_ObjId(pObj) );
                 break;
             }
     assert( Vec_IntSize(vEvals) > 0 );
-    // label nodes
-    Abc_NtkForEachObjVec( vNodes, p, pObj, i )
-        pObj->fMarkB = 0;
 }
 
 
@@ -278,7 +283,7 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     float dGain, dGainBest;
     int k, gateBest, NoChange = 0;
     // save old gate, timing, fanin load
-    pCellOld = Abc_SclObjCell( pObj );
+    pCellOld = Abc_SclManObjCell( p, pObj );
     Abc_SclConeStore( p, vRecalcs );
     Abc_SclEvalStore( p, vEvals );
     Abc_SclLoadStore( p, pObj );
@@ -292,12 +297,12 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
         if ( k > Notches )
             break;
         // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
+        Abc_SclManObjSetCell( p, pObj, pCellNew );
         Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
         // recompute timing
         Abc_SclTimeCone( p, vRecalcs );
         // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
+        Abc_SclManObjSetCell( p, pObj, pCellOld );
         Abc_SclLoadRestore( p, pObj );
         // save best gain
         dGain = Abc_SclEvalPerform( p, vEvals );
@@ -316,7 +321,7 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
 //    printf( "Best = %.2f   ", dGainBest );
 //    printf( "\n" );
     // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
+    Abc_SclManObjSetCell( p, pObj, pCellOld );
     Abc_SclConeRestore( p, vRecalcs );
     *pGainBest = dGainBest;
     return gateBest;
@@ -339,6 +344,7 @@ int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notc
     Vec_Ptr_t * vFanouts;
     Vec_Int_t * vRecalcs, * vEvals;
     Abc_Obj_t * pBuf, * pFanin, * pFanout, * pExtra;
+    SC_Pair LoadBuf, LoadFanin;
     int i, j, iNode, gateBest, gateBest2, fanBest, Counter = 0;
     float dGainBest, dGainBest2;
 
@@ -392,14 +398,16 @@ int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notc
             // skip if fanin already has fanout as a fanout
             if ( pExtra && Abc_NodeFindFanin(pFanout, pExtra) >= 0 )
                 continue;
-            // prepare
-            Abc_SclLoadStore3( p, pBuf );
-            Abc_SclUpdateLoadSplit( p, pBuf, pFanout );
+            // prepare (the load moves to pFanin, which differs from the fanin of pBuf for inverter pairs)
+            LoadBuf   = *Abc_SclObjLoad( p, pBuf );
+            LoadFanin = *Abc_SclObjLoad( p, pFanin );
+            Abc_SclUpdateLoadMove( p, pFanout, pBuf, pFanin );
             Abc_ObjPatchFanin( pFanout, pBuf, pFanin );
             // size the fanin
             gateBest = Abc_SclFindBestCell( p, pFanin, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
             // unprepare
-            Abc_SclLoadRestore3( p, pBuf );
+            *Abc_SclObjLoad( p, pBuf )   = LoadBuf;
+            *Abc_SclObjLoad( p, pFanin ) = LoadFanin;
             Abc_ObjPatchFanin( pFanout, pFanin, pBuf );
             if ( gateBest == -1 )
                 continue;
@@ -475,13 +483,7 @@ int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notc
 //        else if ( dGainBest2 > 2*Vec_FltEntry(p->vNode2Gain, iNode) )
 //            break;
         // redirect
-        Abc_SclUpdateLoadSplit( p, pBuf, pFanout );
-        Abc_SclAddWireLoad( p, pBuf, 1 );
-        Abc_SclAddWireLoad( p, pFanin, 1 );
-        Abc_ObjPatchFanin( pFanout, pBuf, pFanin );
-        Abc_SclAddWireLoad( p, pBuf, 0 );
-        Abc_SclAddWireLoad( p, pFanin, 0 );
-        Abc_SclTimeIncUpdateLevel( pFanout );
+        Abc_SclTimeIncPatchFanin( p, pFanout, pBuf, pFanin );
         // remember
         Vec_IntPush( p->vUpdates2, Abc_ObjId(pFanout) );
         Vec_IntPush( p->vUpdates2, Abc_ObjId(pFanin) );
@@ -489,15 +491,10 @@ int Abc_SclFindBypasses( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notc
         // update cell
         pCellOld = Abc_SclObjCell( pFanin );
         pCellNew = SC_LibCell( p->pLib, Vec_IntEntry(p->vNode2Gate, iNode) );
-        p->SumArea += pCellNew->area - pCellOld->area;
-        Abc_SclObjSetCell( pFanin, pCellNew );
-        Abc_SclUpdateLoad( p, pFanin, pCellOld, pCellNew );
+        Abc_SclTimeIncUpdateCell( p, pFanin, pCellNew );
         // record the update
         Vec_IntPush( p->vUpdates, Abc_ObjId(pFanin) );
         Vec_IntPush( p->vUpdates, pCellNew->Id );
-        Abc_SclTimeIncInsert( p, pFanout );
-        Abc_SclTimeIncInsert( p, pBuf );
-        Abc_SclTimeIncInsert( p, pFanin );
         // remember when this node was upsized
         Vec_IntWriteEntry( p->vNodeIter, Abc_ObjId(pFanout), -1 );
         Vec_IntWriteEntry( p->vNodeIter, Abc_ObjId(pBuf), -1 );
@@ -582,6 +579,170 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
 */
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the gate sizes of a range of nodes.]
+
+  Description [Writes the best gate and its gain for each node into 
+  vGates and vGains. If the manager p is a thread copy of pMan, the 
+  timing data of each window is first copied from pMan, which is not
+  changed. The evaluation of a node restores the timing data, so the
+  results do not depend on the order of nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclFindBestCellsSyncObj( SC_Man * p, SC_Man * pMan, Abc_Obj_t * pObj )
+{
+    *Abc_SclObjLoad(p, pObj) = *Abc_SclObjLoad(pMan, pObj);
+    *Abc_SclObjTime(p, pObj) = *Abc_SclObjTime(pMan, pObj);
+    *Abc_SclObjSlew(p, pObj) = *Abc_SclObjSlew(pMan, pObj);
+}
+void Abc_SclFindBestCellsRange( SC_Man * p, SC_Man * pMan, Vec_Int_t * vPivots, int iStart, int iStop, int Notches, int DelayGap, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Vec_Int_t * vRecalcs = Vec_IntAlloc( 100 );
+    Vec_Int_t * vEvals = Vec_IntAlloc( 100 );
+    Abc_Obj_t * pObj, * pNode, * pFanin;
+    float dGainBest;
+    int i, k, f;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(vPivots, i) );
+        // compute nodes to recalculate timing and nodes to evaluate afterwards
+        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
+        assert( Vec_IntSize(vEvals) > 0 );
+        // copy the timing data of the window
+        if ( p != pMan )
+        {
+            Abc_NtkForEachObjVec( vRecalcs, p->pNtk, pNode, k )
+            {
+                Vec_IntWriteEntry( p->vGatesLocal, Abc_ObjId(pNode), Abc_SclObjCellId(pNode) );
+                Abc_SclFindBestCellsSyncObj( p, pMan, pNode );
+                Abc_ObjForEachFanin( pNode, pFanin, f )
+                    Abc_SclFindBestCellsSyncObj( p, pMan, pFanin );
+            }
+        }
+        Vec_IntWriteEntry( vGates, i, Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest ) );
+        Vec_FltWriteEntry( vGains, i, dGainBest );
+    }
+    Vec_IntFree( vRecalcs );
+    Vec_IntFree( vEvals );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the gate sizes of the nodes using several threads.]
+
+  Description [Each thread evaluates a contiguous range of nodes using
+  a copy of the manager, which has its own loads, arrival times, slews, 
+  and gates. The network and the manager are not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Scl_ParThData_t_ Scl_ParThData_t;
+struct Scl_ParThData_t_
+{
+    SC_Man           Man;         // the copy of the manager
+    SC_Man *         pMan;        // the manager
+    Vec_Int_t *      vPivots;     // the nodes to evaluate (NULL to stop)
+    int              iStart;      // the first node in the range
+    int              iStop;       // the node after the last one in the range
+    int              Notches;     // the limit on upsizing steps
+    int              DelayGap;    // the delay gap
+    Vec_Int_t *      vGates;      // the best gates
+    Vec_Flt_t *      vGains;      // the best gains
+    volatile int     fWorking;    // the thread is working
+};
+static void Abc_SclFindBestCellsParRange( Scl_ParThData_t * pThData )
+{
+    Abc_SclFindBestCellsRange( &pThData->Man, pThData->pMan, pThData->vPivots, pThData->iStart, pThData->iStop, 
+        pThData->Notches, pThData->DelayGap, pThData->vGates, pThData->vGains );
+}
+static void * Abc_SclFindBestCellsWorkerThread( void * pArg )
+{
+    Scl_ParThData_t * pThData = (Scl_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->vPivots == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Abc_SclFindBestCellsParRange( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Abc_SclFindBestCellsPar( SC_Man * p, Vec_Int_t * vPivots, int Notches, int DelayGap, int nProcs, Vec_Int_t * vGates, Vec_Flt_t * vGains )
+{
+    Scl_ParThData_t * pThData = ABC_CALLOC( Scl_ParThData_t, SCL_PAR_THR_MAX );
+    pthread_t WorkerThread[SCL_PAR_THR_MAX];
+    int i, status, nNodes = Vec_IntSize(vPivots);
+    nProcs = Abc_MinInt( nProcs, SCL_PAR_THR_MAX );
+    // start the threads (thread 0 is the calling thread)
+    for ( i = nProcs - 1; i >= 0; i-- )
+    {
+        pThData[i].Man         = *p;
+        pThData[i].Man.pLoads  = ABC_ALLOC( SC_Pair, p->nObjs );
+        pThData[i].Man.pTimes  = ABC_ALLOC( SC_Pair, p->nObjs );
+        pThData[i].Man.pSlews  = ABC_ALLOC( SC_Pair, p->nObjs );
+        pThData[i].Man.pDepts  = NULL;
+        pThData[i].Man.vLoads2 = Vec_FltAlloc( 100 );
+        pThData[i].Man.vTimes2 = Vec_FltAlloc( 100 );
+        pThData[i].Man.vTimes3 = Vec_FltAlloc( 100 );
+        pThData[i].Man.vGatesLocal = Vec_IntStartFull( p->nObjs );
+        pThData[i].pMan        = p;
+        pThData[i].vPivots     = vPivots;
+        pThData[i].iStart      = i * nNodes / nProcs;
+        pThData[i].iStop       = (i + 1) * nNodes / nProcs;
+        pThData[i].Notches     = Notches;
+        pThData[i].DelayGap    = DelayGap;
+        pThData[i].vGates      = vGates;
+        pThData[i].vGains      = vGains;
+        if ( i == 0 )
+            continue;
+        pThData[i].fWorking    = 1;
+        status = pthread_create( WorkerThread + i, NULL, Abc_SclFindBestCellsWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    Abc_SclFindBestCellsParRange( pThData );
+    // wait till threads finish
+    for ( i = 1; i < nProcs; i++ )
+        if ( pThData[i].fWorking )
+            i = 0;
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( i > 0 )
+        {
+            pThData[i].vPivots = NULL;
+            pThData[i].fWorking = 1;
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        ABC_FREE( pThData[i].Man.pLoads );
+        ABC_FREE( pThData[i].Man.pTimes );
+        ABC_FREE( pThData[i].Man.pSlews );
+        Vec_FltFree( pThData[i].Man.vLoads2 );
+        Vec_FltFree( pThData[i].Man.vTimes2 );
+        Vec_FltFree( pThData[i].Man.vTimes3 );
+        Vec_IntFree( pThData[i].Man.vGatesLocal );
+    }
+    ABC_FREE( pThData );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Computes the set of gates to upsize.]
@@ -593,41 +754,49 @@ void Abc_SclObjMarkFanFans( Abc_Obj_t * pObj, Vec_Ptr_t * vNodes )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf )
+int Abc_SclFindUpsizes( SC_Man * p, Vec_Int_t * vPathNodes, int Ratio, int Notches, int iIter, int DelayGap, int fMoreConserf, int nProcs )
 {
     SC_Cell * pCellOld, * pCellNew;
-    Vec_Int_t * vRecalcs, * vEvals;
+    Vec_Int_t * vPivots, * vGates;
+    Vec_Flt_t * vGains;
     Vec_Ptr_t * vFanouts;
     Abc_Obj_t * pObj;
-    float dGainBest, dGainBest2;
-    int i, gateBest, Limit, Counter, iIterLast;
+    float dGainBest2;
+    int i, Limit, Counter, iIterLast;
 
-    // compute savings due to upsizing each node
-    vRecalcs = Vec_IntAlloc( 100 );
-    vEvals = Vec_IntAlloc( 100 );
-    Vec_QueClear( p->vNodeByGain );
+    // collect the nodes to evaluate
+    vPivots = Vec_IntAlloc( Vec_IntSize(vPathNodes) );
     Abc_NtkForEachObjVec( vPathNodes, p->pNtk, pObj, i )
     {
         assert( pObj->fMarkB == 0 );
         iIterLast = Vec_IntEntry(p->vNodeIter, Abc_ObjId(pObj));
         if ( iIterLast >= 0 && iIterLast + 5 > iIter )
             continue;
-        // compute nodes to recalculate timing and nodes to evaluate afterwards
-        Abc_SclFindNodesToUpdate( pObj, &vRecalcs, &vEvals, NULL );
-        assert( Vec_IntSize(vEvals) > 0 );
-        //printf( "%d -> %d\n", Vec_IntSize(vRecalcs), Vec_IntSize(vEvals) );
-        gateBest = Abc_SclFindBestCell( p, pObj, vRecalcs, vEvals, Notches, DelayGap, &dGainBest );
-        // remember savings
-        if ( gateBest >= 0 )
-        {
-            assert( dGainBest > 0.0 );
-            Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), dGainBest );
-            Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), gateBest );
-            Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
-        }
+        Vec_IntPush( vPivots, Abc_ObjId(pObj) );
     }
-    Vec_IntFree( vRecalcs );
-    Vec_IntFree( vEvals );
+    // compute savings due to upsizing each node
+    vGates = Vec_IntStartFull( Vec_IntSize(vPivots) );
+    vGains = Vec_FltStart( Vec_IntSize(vPivots) );
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 && Vec_IntSize(vPivots) >= SCL_PAR_NODE_MIN )
+        Abc_SclFindBestCellsPar( p, vPivots, Notches, DelayGap, nProcs, vGates, vGains );
+    else
+#endif
+    Abc_SclFindBestCellsRange( p, p, vPivots, 0, Vec_IntSize(vPivots), Notches, DelayGap, vGates, vGains );
+    // remember savings
+    Vec_QueClear( p->vNodeByGain );
+    Abc_NtkForEachObjVec( vPivots, p->pNtk, pObj, i )
+    {
+        if ( Vec_IntEntry(vGates, i) < 0 )
+            continue;
+        assert( Vec_FltEntry(vGains, i) > 0.0 );
+        Vec_FltWriteEntry( p->vNode2Gain, Abc_ObjId(pObj), Vec_FltEntry(vGains, i) );
+        Vec_IntWriteEntry( p->vNode2Gate, Abc_ObjId(pObj), Vec_IntEntry(vGates, i) );
+        Vec_QuePush( p->vNodeByGain, Abc_ObjId(pObj) );
+    }
+    Vec_IntFree( vPivots );
+    Vec_IntFree( vGates );
+    Vec_FltFree( vGains );
     if ( Vec_QueSize(p->vNodeByGain) == 0 )
         return 0;
 /*
@@ -686,13 +855,10 @@ return Limit;
 //        if ( pCellOld->Order > 0 )
 //            printf( "%.2f  %d -> %d(%d)   ", Vec_FltEntry(p->vNode2Gain, iNode), pCellOld->Order, pCellNew->Order, pCellNew->nGates );
         // update gate
-        p->SumArea += pCellNew->area - pCellOld->area;
-        Abc_SclObjSetCell( pObj, pCellNew );
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
+        Abc_SclTimeIncUpdateCell( p, pObj, pCellNew );
         // record the update
         Vec_IntPush( p->vUpdates, Abc_ObjId(pObj) );
         Vec_IntPush( p->vUpdates, pCellNew->Id );
-        Abc_SclTimeIncInsert( p, pObj );
         // remember when this node was upsized
         Vec_IntWriteEntry( p->vNodeIter, Abc_ObjId(pObj), iIter );
         Counter++;
@@ -915,7 +1081,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             if ( pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0 )
                 nUpsizes = Abc_SclFindBypasses( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, pPars->fVeryVerbose );
             else
-                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0) );
+                nUpsizes = Abc_SclFindUpsizes( p, vPathNodes, pPars->Ratio, pPars->Notches, i, pPars->DelayGap, (pPars->BypassFreq > 0), pPars->nProcs );
             p->timeSize += Abc_Clock() - clk;
 
             // unmark critical path
@@ -933,20 +1099,11 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
         // update timing information
         clk = Abc_Clock();
-        if ( pPars->fUseDept )
-        {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
-        }
-        else
-        {
-            Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
-            Abc_SclTimeCone( p, vTFO );
-            nConeSize = Vec_IntSize( vTFO );
-            Vec_IntFree( vTFO );
-        }
+        nConeSize = Abc_SclTimeIncUpdate( p, pPars->fUseDept );
+        // the incremental update stops at the nodes whose timing changes less
+        // than the cutoff, so the error accumulates over the iterations
+        if ( (i + 1) % SCL_TIME_FULL_FREQ == 0 )
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
@@ -157,7 +157,8 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
     float AreaLimit;
     int fSkipInvs;
     int fWriteOldFormat; 
-    int nVarsMax, nLevels, nGatesMax, TimeLimit;
+    int nVarsMax, nLevels, nGatesMax, TimeLimit, nProcs;
+    int fUseCache;
     int fVerbose;
     int c;
 
@@ -171,13 +172,15 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
     AreaLimit  = 0;
     nGatesMax  = 0;
     TimeLimit  = 0;
+    nProcs     = 1;
     fSkipInvs  = 1;
+    fUseCache  = 0;
     fVerbose   = 0;
     fWriteOldFormat = 0;
     ExcludeFile = 0;
 
     Extra_UtilGetoptReset();
-    while ( (c = Extra_UtilGetopt(argc, argv, "ILNTDAEsovh")) != EOF ) 
+    while ( (c = Extra_UtilGetopt(argc, argv, "ILNTPDAEscovh")) != EOF ) 
     {
         switch (c) 
         {
@@ -204,6 +207,12 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
                 globalUtilOptind++;
                 if ( TimeLimit < 0 ) 
                     goto usage;
+                break;
+            case 'P':
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs < 1 ) 
+                    goto usage;
                 break;
 			case 'D':
 				DelayLimit = (float)atof(argv[globalUtilOptind]);
@@ -226,6 +235,9 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
             case 's':
                 fSkipInvs ^= 1;
                 break;
+            case 'c':
+                fUseCache ^= 1;
+                break;
             case 'o':
                 fWriteOldFormat ^= 1;
                 break;
@@ -276,23 +288,25 @@ int Super_CommandSupergates( Abc_Frame_t * pAbc, int argc, char **argv )
 
     // compute the gates
     FileName = Extra_FileNameGenericAppend(Mio_LibraryReadName(pLib), ".super");
-    Super_Precompute( pLib, nVarsMax, nLevels, nGatesMax, DelayLimit, AreaLimit, TimeLimit, fSkipInvs, fVerbose, FileName );
+    Super_Precompute( pLib, nVarsMax, nLevels, nGatesMax, DelayLimit, AreaLimit, TimeLimit, fSkipInvs, nProcs, fUseCache, fVerbose, FileName );
 
     // delete the library
     Mio_LibraryDelete( pLib );
     return 0;
 
 usage:
-    fprintf( pErr, "usage: super [-ILNT num] [-DA float] [-E file] [-sovh] <genlib_file>\n");
+    fprintf( pErr, "usage: super [-ILNTP num] [-DA float] [-E file] [-scovh] <genlib_file>\n");
     fprintf( pErr, "\t         precomputes the supergates for the given genlib library\n" );  
     fprintf( pErr, "\t-I num   : the max number of supergate inputs [default = %d]\n", nVarsMax );
     fprintf( pErr, "\t-L num   : the max number of levels of gates [default = %d]\n", nLevels );
     fprintf( pErr, "\t-N num   : the limit on the number of considered supergates [default = %d]\n", nGatesMax );
     fprintf( pErr, "\t-T num   : the approximate runtime limit in seconds [default = %d]\n", TimeLimit );
+    fprintf( pErr, "\t-P num   : the number of threads used to enumerate supergates [default = %d]\n", nProcs );
 	fprintf( pErr, "\t-D float : the max delay of the supergates [default = %.2f]\n", DelayLimit );
 	fprintf( pErr, "\t-A float : the max area of the supergates [default = %.2f]\n", AreaLimit );
     fprintf( pErr, "\t-E file  : file contains list of genlib gates to exclude\n" );
     fprintf( pErr, "\t-s       : toggle the use of inverters at the inputs [default = %s]\n", (fSkipInvs? "no": "yes") );
+    fprintf( pErr, "\t-c       : toggle using the cache of supergate libraries [default = %s]\n", (fUseCache? "yes": "no") );
     fprintf( pErr, "\t-o       : toggle dumping the supergate library in old format [default = %s]\n", (fWriteOldFormat? "yes": "no") );
     fprintf( pErr, "\t-v       : enable verbose output [default = %s]\n", (fVerbose? "yes" : "no") );
     fprintf( pErr, "\t-h       : print the help message\n");
@@ -19,6 +19,21 @@
 #include <math.h>
 #include "superInt.h"
 
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -32,6 +47,17 @@ ABC_NAMESPACE_IMPL_START
 #define SUPER_NO_VAR         (-9999.0)
 #define SUPER_EPSILON        (0.001)
 
+// the max number of threads used to enumerate the supergates
+#define SUPER_PAR_THR_MAX    64
+// the number of jobs given to each thread at a time
+#define SUPER_PAR_JOB_NUM    64
+
+// the header of the supergate cache: magic (4 bytes), version (4 bytes), 
+// text size (4 bytes), text checksum (4 bytes), key (8 bytes)
+#define SUPER_CACHE_MAGIC    "SUPC"
+#define SUPER_CACHE_VERSION  1
+#define SUPER_CACHE_HEAD     24
+
 // data structure for supergate precomputation
 typedef struct Super_ManStruct_t_     Super_Man_t;   // manager
 typedef struct Super_GateStruct_t_    Super_Gate_t;  // supergate
@@ -48,6 +74,7 @@ struct Super_ManStruct_t_
     float               tAreaMax;     // the max area of the supergates in the library
     int                 fSkipInv;     // the flag says about skipping inverters
     int                 fWriteOldFormat; // in addition, writes the file in the old format
+    int                 nProcs;       // the number of threads
     int                 fVerbose;
 
     // supergates
@@ -68,6 +95,7 @@ struct Super_ManStruct_t_
     int                 nUnique;      // the number of unique gates
     int                 nLookups;     // the number of hash table lookups
     int                 nAliases;     // the number of hash table lookups thrown away due to aliasing
+    int                 fTimeOut;     // the computation was stopped by the timeout
 
     // runtime
     abctime             Time;         // the runtime of the generation procedure
@@ -92,6 +120,17 @@ struct Super_GateStruct_t_
     Super_Gate_t *      pNext;        // the next gate in the table
 };
 
+// the supergate derived by a worker thread
+typedef struct Super_Cand_t_          Super_Cand_t;
+struct Super_Cand_t_
+{
+    int                 pFanins[6];   // the fanins (the indexes in the array of gates)
+    unsigned            uTruth[2];    // the truth table
+    float               Area;         // the area
+    float               ptDelays[6];  // the pin-to-pin delays for all inputs
+    float               tDelayMax;    // the maximum delay
+};
+
 
 // iterating through the gates in the library
 #define Super_ManForEachGate( GateArray, Limit, Index, Gate )    \
@@ -112,6 +151,7 @@ static int            Super_DelayCompare( Super_Gate_t ** ppG1, Super_Gate_t **
 static int            Super_AreaCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
 static void           Super_TranferGatesToArray( Super_Man_t * pMan );
 static int            Super_CheckTimeout( ProgressBar * pPro, Super_Man_t * pMan );
+static Vec_Str_t *    Super_PrecomputeStrInt( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose, int * pfTimeOut );
  
 static Vec_Str_t *    Super_Write( Super_Man_t * pMan );
 static int            Super_WriteCompare( Super_Gate_t ** ppG1, Super_Gate_t ** ppG2 );
@@ -137,7 +177,7 @@ static Vec_Str_t *    Super_WriteLibraryTreeStr( Super_Man_t * pMan );
   SeeAlso     []
 
 ***********************************************************************/
-void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose, char * pFileName )
+void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fUseCache, int fVerbose, char * pFileName )
 {
     Vec_Str_t * vStr;
     FILE * pFile = fopen( pFileName, "wb" );
@@ -146,7 +186,15 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
         printf( "Cannot open output file \"%s\".\n", pFileName );
         return;
     }
-    vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, fVerbose );
+    if ( fUseCache )
+        vStr = Super_PrecomputeStrCache( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose );
+    else
+        vStr = Super_PrecomputeStr( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose );
+    if ( vStr == NULL )
+    {
+        fclose( pFile );
+        return;
+    }
     fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile );
     fclose( pFile );
     Vec_StrFree( vStr );
@@ -169,7 +217,12 @@ void Super_Precompute( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int n
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int fVerbose )
+Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose )
+{
+    int fTimeOut;
+    return Super_PrecomputeStrInt( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose, &fTimeOut );
+}
+Vec_Str_t * Super_PrecomputeStrInt( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose, int * pfTimeOut )
 {
     Vec_Str_t * vStr;
     Super_Man_t * pMan;
@@ -178,6 +231,7 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
     abctime clk, clockStart;
 
     assert( nVarsMax < 7 );
+    *pfTimeOut = 0;
     if ( nGatesMax && nGatesMax < nVarsMax )
     {
         fprintf( stderr, "Erro! The number of supergates requested (%d) in less than the number of variables (%d).\n", nGatesMax, nVarsMax );
@@ -202,6 +256,7 @@ Vec_Str_t * Super_PrecomputeStr( Mio_Library_t * pLibGen, int nVarsMax, int nLev
     pMan->tAreaMax  = tAreaMax;
     pMan->TimeLimit = TimeLimit; // in seconds
     pMan->TimeStop  = TimeLimit ? TimeLimit * CLOCKS_PER_SEC + Abc_Clock() : 0; // in CPU ticks
+    pMan->nProcs    = nProcs;
     pMan->fVerbose  = fVerbose;
 
     if ( nGates == 0 )
@@ -233,7 +288,10 @@ if ( fVerbose )
     for ( Level = 1; Level <= nLevels; Level++ )
     {
         if ( pMan->TimeStop && Abc_Clock() > pMan->TimeStop )
+        {
+            pMan->fTimeOut = 1;
             break;
+        }
 clk = Abc_Clock();
         Super_Compute( pMan, ppGates, nGates, nGatesMax, fSkipInv );
         pMan->nLevels = Level;
@@ -254,6 +312,7 @@ fflush( stdout );
 }
     // write them into a file
     vStr = Super_Write( pMan );
+    *pfTimeOut = pMan->fTimeOut;
 
     // stop the manager
     Super_ManStop( pMan );
@@ -262,6 +321,174 @@ fflush( stdout );
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Precomputes the library of supergates using the cache.]
+
+  Description [The cache is a file next to the genlib library, which 
+  contains the text of the supergate library. The name of the cache 
+  file includes a 64-bit key, which is a hash of the genlib gates and 
+  the parameters of the computation, so the libraries computed with 
+  different parameters are cached in different files. The key is also 
+  stored in the header of the cache together with the size and the 
+  checksum of the text. The library is not cached if the computation 
+  was stopped by the timeout because the result is not reproducible.
+  The cache is written into a temporary file, which is then renamed,
+  so that other processes never see a partially written cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Super_CacheHash( word Hash, void * pData, int nSize )
+{
+    unsigned char * pBytes = (unsigned char *)pData;
+    int i;
+    for ( i = 0; i < nSize; i++ )
+        Hash = (Hash ^ pBytes[i]) * ABC_CONST(0x100000001B3);
+    return Hash;
+}
+static word Super_CacheHashStr( word Hash, char * pStr )
+{
+    return pStr ? Super_CacheHash( Hash, pStr, strlen(pStr) + 1 ) : Super_CacheHash( Hash, "", 1 );
+}
+static word Super_CacheKey( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv )
+{
+    int pParams[6] = { SUPER_CACHE_VERSION, nVarsMax, nLevels, nGatesMax, TimeLimit, fSkipInv };
+    float pLimits[2] = { tDelayMax, tAreaMax };
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    double pValues[6];
+    int Phase;
+    Hash = Super_CacheHash( Hash, pParams, sizeof(pParams) );
+    Hash = Super_CacheHash( Hash, pLimits, sizeof(pLimits) );
+    Hash = Super_CacheHashStr( Hash, Mio_LibraryReadName(pLibGen) );
+    Mio_LibraryForEachGate( pLibGen, pGate )
+    {
+        pValues[0] = Mio_GateReadArea( pGate );
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadName(pGate) );
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadOutName(pGate) );
+        Hash = Super_CacheHashStr( Hash, Mio_GateReadForm(pGate) );
+        Hash = Super_CacheHash( Hash, pValues, sizeof(double) );
+        Mio_GateForEachPin( pGate, pPin )
+        {
+            Phase      = (int)Mio_PinReadPhase( pPin );
+            pValues[0] = Mio_PinReadInputLoad( pPin );
+            pValues[1] = Mio_PinReadMaxLoad( pPin );
+            pValues[2] = Mio_PinReadDelayBlockRise( pPin );
+            pValues[3] = Mio_PinReadDelayFanoutRise( pPin );
+            pValues[4] = Mio_PinReadDelayBlockFall( pPin );
+            pValues[5] = Mio_PinReadDelayFanoutFall( pPin );
+            Hash = Super_CacheHashStr( Hash, Mio_PinReadName(pPin) );
+            Hash = Super_CacheHash( Hash, &Phase, sizeof(int) );
+            Hash = Super_CacheHash( Hash, pValues, sizeof(pValues) );
+        }
+    }
+    return Hash;
+}
+static void Super_CacheHeader( char * pHead, word Key, Vec_Str_t * vStr )
+{
+    int Version = SUPER_CACHE_VERSION, nSize = Vec_StrSize(vStr);
+    unsigned Check = (unsigned)Super_CacheHash( ABC_CONST(0xCBF29CE484222325), Vec_StrArray(vStr), Vec_StrSize(vStr) );
+    memcpy( pHead,      SUPER_CACHE_MAGIC, 4 );
+    memcpy( pHead +  4, &Version, 4 );
+    memcpy( pHead +  8, &nSize,   4 );
+    memcpy( pHead + 12, &Check,   4 );
+    memcpy( pHead + 16, &Key,     8 );
+}
+static Vec_Str_t * Super_CacheRead( char * pCacheName, word Key )
+{
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    char pHead[SUPER_CACHE_HEAD], pHeadFile[SUPER_CACHE_HEAD];
+    int nSize;
+    pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    if ( fread( pHeadFile, 1, SUPER_CACHE_HEAD, pFile ) != SUPER_CACHE_HEAD )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    memcpy( &nSize, pHeadFile + 8, 4 );
+    if ( nSize <= 0 || nSize > Extra_FileSize(pCacheName) - SUPER_CACHE_HEAD )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    vStr = Vec_StrStart( nSize );
+    nSize = (int)fread( Vec_StrArray(vStr), 1, nSize, pFile );
+    fclose( pFile );
+    // check that the cache is complete and corresponds to this key
+    Super_CacheHeader( pHead, Key, vStr );
+    if ( nSize != Vec_StrSize(vStr) || memcmp( pHead, pHeadFile, SUPER_CACHE_HEAD ) )
+    {
+        Vec_StrFree( vStr );
+        return NULL;
+    }
+    return vStr;
+}
+static int Super_CacheWrite( char * pCacheName, word Key, Vec_Str_t * vStr )
+{
+    FILE * pFile;
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 20 ), pHead[SUPER_CACHE_HEAD];
+    int RetValue = 0;
+#ifndef _WIN32
+    sprintf( pTempName, "%s.%d", pCacheName, (int)getpid() );
+#else
+    sprintf( pTempName, "%s", pCacheName );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile != NULL )
+    {
+        Super_CacheHeader( pHead, Key, vStr );
+        RetValue  = fwrite( pHead, 1, SUPER_CACHE_HEAD, pFile ) == SUPER_CACHE_HEAD;
+        RetValue &= fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+        RetValue &= fclose( pFile ) == 0;
+#ifndef _WIN32
+        if ( RetValue )
+            RetValue = rename( pTempName, pCacheName ) == 0;
+        if ( !RetValue )
+            unlink( pTempName );
+#endif
+    }
+    ABC_FREE( pTempName );
+    return RetValue;
+}
+Vec_Str_t * Super_PrecomputeStrCache( Mio_Library_t * pLibGen, int nVarsMax, int nLevels, int nGatesMax, float tDelayMax, float tAreaMax, int TimeLimit, int fSkipInv, int nProcs, int fVerbose )
+{
+    Vec_Str_t * vStr;
+    char * pCacheName, * pDot;
+    int fTimeOut;
+    word Key = Super_CacheKey( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv );
+    // the cache name is derived here because the caller may use the buffer of Extra_FileNameGenericAppend()
+    pCacheName = ABC_ALLOC( char, strlen(Mio_LibraryReadName(pLibGen)) + 40 );
+    strcpy( pCacheName, Mio_LibraryReadName(pLibGen) );
+    if ( (pDot = strrchr( pCacheName, '.' )) )
+        *pDot = 0;
+    sprintf( pCacheName + strlen(pCacheName), ".%08x%08x.supercache", (unsigned)(Key >> 32), (unsigned)Key );
+    vStr = Super_CacheRead( pCacheName, Key );
+    if ( vStr != NULL )
+    {
+        if ( fVerbose )
+            printf( "The supergates are read from the cache \"%s\".\n", pCacheName );
+        ABC_FREE( pCacheName );
+        return vStr;
+    }
+    vStr = Super_PrecomputeStrInt( pLibGen, nVarsMax, nLevels, nGatesMax, tDelayMax, tAreaMax, TimeLimit, fSkipInv, nProcs, fVerbose, &fTimeOut );
+    if ( vStr != NULL && !fTimeOut )
+    {
+        if ( !Super_CacheWrite( pCacheName, Key, vStr ) )
+            printf( "Cannot write the supergate cache \"%s\".\n", pCacheName );
+        else if ( fVerbose )
+            printf( "The supergates are written into the cache \"%s\".\n", pCacheName );
+    }
+    ABC_FREE( pCacheName );
+    return vStr;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives the starting supergates.]
@@ -324,6 +551,267 @@ void Super_First( Super_Man_t * pMan, int nVarsMax )
     }
 }
 
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Enumerates the supergates with the given root gate in several threads.]
+
+  Description [The combinations of fanins are divided into jobs by fixing 
+  the first fanin (for two-input root gates) or the first two fanins (for 
+  larger root gates). Each thread takes every nProcs-th job, enumerates 
+  the remaining fanins with the same area bounds as Super_Compute(), and 
+  saves the truth tables and the pin-to-pin delays of the non-constant
+  supergates. The unique table is not used by the threads. After all 
+  threads are done, the calling thread checks the candidates against the 
+  unique table in the order of the serial enumeration, so the resulting 
+  library does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Super_ThData_t_ Super_ThData_t;
+struct Super_ThData_t_
+{
+    Super_Man_t *       pMan;         // the manager
+    Mio_Gate_t *        pRoot;        // the root gate (NULL to stop the thread)
+    Super_Gate_t **     ppGates;      // the gates to be used as fanins
+    int                 nGates;       // the number of these gates
+    float               AreaMio;      // the area of the root gate
+    Vec_Int_t *         vJobs;        // the fanins fixed in each job
+    int                 nPrefix;      // the number of fanins fixed in each job
+    int                 iThread;      // the thread number
+    int                 nProcs;       // the number of threads
+    Vec_Int_t *         vJobEnds;     // the end of candidates of each job of this thread
+    Super_Cand_t *      pCands;       // the candidates
+    int                 nCands;       // the number of candidates
+    int                 nCandsAlloc;  // the number of allocated candidates
+    int                 nTried;       // the number of tried combinations
+    volatile int        fWorking;     // the thread is working
+};
+static void Super_ComputeJob_rec( Super_ThData_t * p, int * pFanins, int Level, float AreaCur )
+{
+    Super_Man_t * pMan = p->pMan;
+    Super_Cand_t * pCand;
+    float * ptPinDelays[6];
+    unsigned uTruths[6][2];
+    float Area;
+    int nFanins = Mio_GateReadPinNum( p->pRoot );
+    int i, k;
+    for ( i = 0; i < p->nGates; i++ )
+    {
+        for ( k = 0; k < Level; k++ )
+            if ( pFanins[k] == i )
+                break;
+        if ( k < Level )
+            continue;
+        if ( Level == nFanins - 1 )
+            p->nTried++;
+        Area = AreaCur + p->ppGates[i]->Area;
+        if ( pMan->tAreaMax > 0.0 && Area > pMan->tAreaMax )
+            break;
+        pFanins[Level] = i;
+        if ( Level < nFanins - 1 )
+        {
+            Super_ComputeJob_rec( p, pFanins, Level + 1, Area );
+            continue;
+        }
+        // derive the supergate
+        if ( p->nCands == p->nCandsAlloc )
+        {
+            p->nCandsAlloc = Abc_MaxInt( 2 * p->nCandsAlloc, 1000 );
+            p->pCands = ABC_REALLOC( Super_Cand_t, p->pCands, p->nCandsAlloc );
+        }
+        pCand = p->pCands + p->nCands;
+        for ( k = 0; k < nFanins; k++ )
+        {
+            pCand->pFanins[k] = pFanins[k];
+            uTruths[k][0]  = p->ppGates[pFanins[k]]->uTruth[0];
+            uTruths[k][1]  = p->ppGates[pFanins[k]]->uTruth[1];
+            ptPinDelays[k] = p->ppGates[pFanins[k]]->ptDelays;
+        }
+        pCand->Area = Area;
+        Mio_DeriveGateDelays( p->pRoot, ptPinDelays, nFanins, pMan->nVarsMax, SUPER_NO_VAR, pCand->ptDelays, &pCand->tDelayMax );
+        Mio_DeriveTruthTable( p->pRoot, uTruths, nFanins, pMan->nVarsMax, pCand->uTruth );
+        // skip constant functions (they are also skipped by Super_CompareGates)
+        if ( pMan->nVarsMax < 6 )
+        {
+            if ( pCand->uTruth[0] == 0 || ~pCand->uTruth[0] == 0 )
+                continue;
+        }
+        else
+        {
+            if ( ( pCand->uTruth[0] == 0 && pCand->uTruth[1] == 0 ) || ( ~pCand->uTruth[0] == 0 && ~pCand->uTruth[1] == 0 ) )
+                continue;
+        }
+        p->nCands++;
+    }
+}
+static void Super_ComputeJobs( Super_ThData_t * p )
+{
+    int pFanins[6], i, k, nJobs = Vec_IntSize(p->vJobs) / p->nPrefix;
+    float Area;
+    p->nCands = 0;
+    Vec_IntClear( p->vJobEnds );
+    for ( i = p->iThread; i < nJobs; i += p->nProcs )
+    {
+        Area = p->AreaMio;
+        for ( k = 0; k < p->nPrefix; k++ )
+        {
+            pFanins[k] = Vec_IntEntry( p->vJobs, i * p->nPrefix + k );
+            Area += p->ppGates[pFanins[k]]->Area;
+        }
+        Super_ComputeJob_rec( p, pFanins, p->nPrefix, Area );
+        Vec_IntPush( p->vJobEnds, p->nCands );
+    }
+}
+static void * Super_ComputeWorkerThread( void * pArg )
+{
+    Super_ThData_t * pThData = (Super_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->pRoot == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Super_ComputeJobs( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+static Super_ThData_t * Super_ComputeParStart( Super_Man_t * pMan, pthread_t * pThreads )
+{
+    Super_ThData_t * pThData = ABC_CALLOC( Super_ThData_t, SUPER_PAR_THR_MAX );
+    int i, status, nProcs = Abc_MinInt( pMan->nProcs, SUPER_PAR_THR_MAX );
+    // start the threads (thread 0 is the calling thread)
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pMan     = pMan;
+        pThData[i].iThread  = i;
+        pThData[i].nProcs   = nProcs;
+        pThData[i].vJobEnds = Vec_IntAlloc( SUPER_PAR_JOB_NUM );
+        if ( i == 0 )
+            continue;
+        status = pthread_create( pThreads + i, NULL, Super_ComputeWorkerThread, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    return pThData;
+}
+static void Super_ComputeParStop( Super_ThData_t * pThData, pthread_t * pThreads )
+{
+    int i, status, nProcs = pThData[0].nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( i > 0 )
+        {
+            pThData[i].pRoot = NULL;
+            pThData[i].fWorking = 1;
+            status = pthread_join( pThreads[i], NULL );  assert( status == 0 );
+        }
+        Vec_IntFree( pThData[i].vJobEnds );
+        ABC_FREE( pThData[i].pCands );
+    }
+    ABC_FREE( pThData );
+}
+static int Super_ComputePar( Super_Man_t * pMan, Super_ThData_t * pThData, Mio_Gate_t * pRoot, Super_Gate_t ** ppGates, int nGates, int nGatesMax, ProgressBar * pProgress, int * pfTimeOut )
+{
+    Super_Gate_t * pSupers[6], * pGateNew;
+    Super_Cand_t * pCand;
+    Vec_Int_t * vJobs = Vec_IntAlloc( 1000 );
+    float Area0, Area1, AreaMio = (float)Mio_GateReadArea(pRoot);
+    int nProcs  = pThData[0].nProcs;
+    int nFanins = Mio_GateReadPinNum(pRoot);
+    int nPrefix = nFanins == 2 ? 1 : 2;
+    int i, k, c, t, i0 = 0, i1, nJobs, RetValue = 0;
+    while ( !*pfTimeOut )
+    {
+        // collect the next jobs in the order of the serial enumeration
+        Vec_IntClear( vJobs );
+        for ( ; i0 < nGates && Vec_IntSize(vJobs) < nProcs * SUPER_PAR_JOB_NUM * nPrefix; i0++ )
+        {
+            Area0 = AreaMio + ppGates[i0]->Area;
+            if ( pMan->tAreaMax > 0.0 && Area0 > pMan->tAreaMax )
+            {
+                i0 = nGates;
+                break;
+            }
+            if ( nPrefix == 1 )
+            {
+                Vec_IntPush( vJobs, i0 );
+                continue;
+            }
+            for ( i1 = 0; i1 < nGates; i1++ )
+            {
+                if ( i1 == i0 )
+                    continue;
+                Area1 = Area0 + ppGates[i1]->Area;
+                if ( pMan->tAreaMax > 0.0 && Area1 > pMan->tAreaMax )
+                    break;
+                Vec_IntPushTwo( vJobs, i0, i1 );
+            }
+        }
+        nJobs = Vec_IntSize(vJobs) / nPrefix;
+        if ( nJobs == 0 )
+            break;
+        // enumerate the supergates
+        for ( t = nProcs - 1; t >= 0; t-- )
+        {
+            pThData[t].pRoot   = pRoot;
+            pThData[t].ppGates = ppGates;
+            pThData[t].nGates  = nGates;
+            pThData[t].AreaMio = AreaMio;
+            pThData[t].vJobs   = vJobs;
+            pThData[t].nPrefix = nPrefix;
+            pThData[t].nTried  = 0;
+            if ( t > 0 )
+                pThData[t].fWorking = 1;
+        }
+        Super_ComputeJobs( pThData );
+        // wait till threads finish
+        for ( t = 1; t < nProcs; t++ )
+            if ( pThData[t].fWorking )
+                t = 0;
+        for ( t = 0; t < nProcs; t++ )
+            pMan->nTried += pThData[t].nTried;
+        // add the supergates to the table in the order of the serial enumeration
+        for ( i = 0; i < nJobs; i++ )
+        {
+            Super_ThData_t * p = pThData + i % nProcs;
+            int iJob = i / nProcs;
+            int iStart = iJob ? Vec_IntEntry(p->vJobEnds, iJob - 1) : 0;
+            int iStop  = Vec_IntEntry(p->vJobEnds, iJob);
+            for ( c = iStart; c < iStop; c++ )
+            {
+                pCand = p->pCands + c;
+                if ( !Super_CompareGates( pMan, pCand->uTruth, pCand->Area, pCand->ptDelays, pMan->nVarsMax ) )
+                    continue;
+                for ( k = 0; k < nFanins; k++ )
+                    pSupers[k] = ppGates[pCand->pFanins[k]];
+                pGateNew = Super_CreateGateNew( pMan, pRoot, pSupers, nFanins, pCand->uTruth, pCand->Area, pCand->ptDelays, pCand->tDelayMax, pMan->nVarsMax );
+                Super_AddGateToTable( pMan, pGateNew );
+                if ( nGatesMax && pMan->nClasses > nGatesMax )
+                {
+                    RetValue = 1;
+                    goto finish;
+                }
+            }
+        }
+        *pfTimeOut = Super_CheckTimeout( pProgress, pMan );
+    }
+finish:
+    Vec_IntFree( vJobs );
+    return RetValue;
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Precomputes one level of supergates.]
@@ -356,6 +844,10 @@ Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGat
     int iPruneLimit = 3;                // Each of the gates plugged into the root gate will have 
                                         // less than these many fanins
     int iPruneLimitRoot = 4;            // The root gate may have only less than these many fanins
+#ifdef ABC_USE_PTHREADS
+    Super_ThData_t * pThData = NULL;
+    pthread_t WorkerThread[SUPER_PAR_THR_MAX];
+#endif
 
     // put the gates from the unique table into the array
     // the gates from the array will be used to compose other gates
@@ -379,6 +871,10 @@ Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGat
     pProgress = Extra_ProgressBarStart( stdout, pMan->TimeLimit );
     pMan->TimePrint = Abc_Clock() + CLOCKS_PER_SEC;
     ppGatesLimit = ABC_ALLOC( Super_Gate_t *, pMan->nGates );
+#ifdef ABC_USE_PTHREADS
+    if ( pMan->nProcs > 1 )
+        pThData = Super_ComputeParStart( pMan, WorkerThread );
+#endif
     // go through the root gates
     // the root gates are sorted in the increasing gelay
     fTimeOut = 0;
@@ -433,6 +929,14 @@ Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGat
         // consider the combinations of gates with the root gate on top
         AreaMio = (float)Mio_GateReadArea(ppGates[k]);
         nFanins = Mio_GateReadPinNum(ppGates[k]);
+#ifdef ABC_USE_PTHREADS
+        if ( pThData && nFanins >= 2 && nFanins <= 5 )
+        {
+            if ( Super_ComputePar( pMan, pThData, ppGates[k], ppGatesLimit, nGatesLimit, nGatesMax, pProgress, &fTimeOut ) )
+                goto done;
+            continue;
+        }
+#endif
         switch ( nFanins )
         {
         case 0: // should not happen
@@ -718,6 +1222,10 @@ Super_Man_t * Super_Compute( Super_Man_t * pMan, Mio_Gate_t ** ppGates, int nGat
         }
     }
 done: 
+#ifdef ABC_USE_PTHREADS
+    if ( pThData )
+        Super_ComputeParStop( pThData, WorkerThread );
+#endif
     Extra_ProgressBarStop( pProgress );
     ABC_FREE( ppGatesLimit );
     return pMan;
@@ -745,6 +1253,7 @@ int Super_CheckTimeout( ProgressBar * pPro, Super_Man_t * pMan )
     if ( pMan->TimeStop && TimeNow > pMan->TimeStop )
     {
         printf ("Timeout!\n");
+        pMan->fTimeOut = 1;
         return 1;
     }
     pMan->nTried++;
@@ -881,7 +1390,9 @@ int Super_CompareGates( Super_Man_t * pMan, unsigned uTruth[], float Area, float
                 *ppList = pGate->pNext;
             else
                 pPrev->pNext = pGate->pNext;
-            Extra_MmFixedEntryRecycle( pMan->pMem, (char *)pGate );
+            // the gate is not recycled because it may be in the array of gates 
+            // of the previous level, which are used as fanins of new gates
+//            Extra_MmFixedEntryRecycle( pMan->pMem, (char *)pGate );
             pMan->nRemoved++;
         }
         else if ( fGateIsBetter ) // new is worse, already dominated no need to see others
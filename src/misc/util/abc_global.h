@@ -61,6 +61,17 @@
 #endif
 #endif
 
+// storage class for state private to each thread (such as random seeds)
+#if !defined(ABC_THREAD_LOCAL)
+#if defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(ABC_USE_PTHREADS)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
@@ -280,6 +291,19 @@ static inline abctime Abc_Clock()
 #endif
 }
 
+// wall-clock time, which is needed for deadlines of multi-threaded runs
+static inline abctime Abc_ClockWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !(__APPLE__ & __MACH__) && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    return ((abctime) ts.tv_sec) * CLOCKS_PER_SEC + (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+#else
+    return Abc_Clock();
+#endif
+}
+
 // bridge communication
 #define BRIDGE_NETLIST           106
 #define BRIDGE_ABS_NETLIST       107
@@ -0,0 +1,215 @@
+/**CFile****************************************************************
+
+  FileName    [utilCut.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Operations on the leaf sets of cuts shared by the mappers.]
+
+  Synopsis    [Merging and containment checks of small leaf arrays.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilCut.h,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilCut_h
+#define ABC__misc__util__utilCut_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "abc_global.h"
+
+// SSE2 is part of the x86-64 baseline, so this path does not need any compiler flags
+#if defined(__SSE2__) || defined(_M_X64)
+#define ABC_CUT_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the leaves are non-negative object IDs, which are distinct within each cut;
+// the unused lanes are padded with negative values that match nothing
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DEFINITIONS                          ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_CUT_USE_SSE2
+
+/**Function*************************************************************
+
+  Synopsis    [Loads up to four leaves into the register.]
+
+  Description [Does not read beyond the end of the array.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline __m128i Abc_CutLoad4( int * pLeaves, int nLeaves, int Fill )
+{
+    if ( nLeaves >= 4 )
+        return _mm_loadu_si128( (__m128i *)pLeaves );
+    return _mm_setr_epi32( pLeaves[0], nLeaves > 1 ? pLeaves[1] : Fill, nLeaves > 2 ? pLeaves[2] : Fill, Fill );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the mask of the four leaves found in the cut.]
+
+  Description [Each group of four leaves of the cut is compared with
+  the given leaves in all four rotations, so that every pair of leaves
+  is compared once.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_CutMatch4( __m128i Leaves, int * pCut, int nCut )
+{
+    __m128i Group, Match = _mm_setzero_si128();
+    int k;
+    for ( k = 0; k < nCut; k += 4 )
+    {
+        Group = Abc_CutLoad4( pCut + k, nCut - k, -2 );
+        Match = _mm_or_si128( Match, _mm_cmpeq_epi32(Leaves, Group) );
+        Group = _mm_shuffle_epi32( Group, _MM_SHUFFLE(0,3,2,1) );
+        Match = _mm_or_si128( Match, _mm_cmpeq_epi32(Leaves, Group) );
+        Group = _mm_shuffle_epi32( Group, _MM_SHUFFLE(0,3,2,1) );
+        Match = _mm_or_si128( Match, _mm_cmpeq_epi32(Leaves, Group) );
+        Group = _mm_shuffle_epi32( Group, _MM_SHUFFLE(0,3,2,1) );
+        Match = _mm_or_si128( Match, _mm_cmpeq_epi32(Leaves, Group) );
+    }
+    return _mm_movemask_ps( _mm_castsi128_ps(Match) );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of leaves of pCut1 present in pCut0.]
+
+  Description [The leaves do not have to be ordered.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_CutCountShared( int * pCut0, int nCut0, int * pCut1, int nCut1 )
+{
+    int i, Count = 0;
+#ifdef ABC_CUT_USE_SSE2
+    for ( i = 0; i < nCut1; i += 4 )
+    {
+        int Mask = Abc_CutMatch4( Abc_CutLoad4(pCut1 + i, nCut1 - i, -1), pCut0, nCut0 );
+        Count += (int)((ABC_CONST(0x4332322132212110) >> (Mask << 2)) & 0xF);
+    }
+#else
+    int k;
+    for ( i = 0; i < nCut1; i++ )
+        for ( k = 0; k < nCut0; k++ )
+            if ( pCut1[i] == pCut0[k] )
+            {
+                Count++;
+                break;
+            }
+#endif
+    return Count;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if pCut is contained in pBase.]
+
+  Description [The leaves do not have to be ordered.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_CutIsContained( int * pBase, int nBase, int * pCut, int nCut )
+{
+    int i;
+    if ( nCut > nBase )
+        return 0;
+#ifdef ABC_CUT_USE_SSE2
+    for ( i = 0; i < nCut; i += 4 )
+        if ( Abc_CutMatch4( Abc_CutLoad4(pCut + i, nCut - i, -1), pBase, nBase ) != (int)Abc_InfoMask(Abc_MinInt(nCut - i, 4)) )
+            return 0;
+#else
+    {
+        int k;
+        for ( i = 0; i < nCut; i++ )
+        {
+            for ( k = 0; k < nBase; k++ )
+                if ( pCut[i] == pBase[k] )
+                    break;
+            if ( k == nBase )
+                return 0;
+        }
+    }
+#endif
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two ordered cuts.]
+
+  Description [Returns the number of leaves in the resulting ordered
+  cut, or -1 if it has more than nLimit leaves. In the latter case,
+  pCut is not changed. Most of the merges performed by the mappers
+  exceed the limit, so the size of the union is computed first without
+  branching on the leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_CutMergeOrder( int * pCut0, int nCut0, int * pCut1, int nCut1, int * pCut, int nLimit )
+{
+    int i = 0, k = 0, c = 0;
+    if ( nCut0 + nCut1 > nLimit && nCut0 + nCut1 - Abc_CutCountShared(pCut0, nCut0, pCut1, nCut1) > nLimit )
+        return -1;
+    while ( i < nCut0 && k < nCut1 )
+    {
+        int Leaf0 = pCut0[i], Leaf1 = pCut1[k];
+        pCut[c++] = Abc_MinInt( Leaf0, Leaf1 );
+        i += (Leaf0 <= Leaf1);
+        k += (Leaf1 <= Leaf0);
+    }
+    while ( i < nCut0 )
+        pCut[c++] = pCut0[i++];
+    while ( k < nCut1 )
+        pCut[c++] = pCut1[k++];
+    assert( c <= nLimit );
+    return c;
+}
+
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,319 @@
+/**CFile****************************************************************
+
+  FileName    [utilDimacs.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DIMACS CNF reader shared by the SAT solvers.]
+
+  Synopsis    [Memory-mapped DIMACS tokenizer.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilDimacs.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "abc_global.h"
+#include "misc/vec/vec.h"
+#include "utilDimacs.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the tokenizer never writes into the buffer, so the file can be mapped
+// read-only and the clauses are decoded straight from the mapped pages
+
+// the largest number of decimal digits in a variable number
+#define DIM_DIGITS_MAX  9
+
+static inline int Abc_DimIsSpace( char c )  { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; }
+static inline int Abc_DimIsDigit( char c )  { return c >= '0' && c <= '9';                                                     }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of decimal digits at the given position.]
+
+  Description [Classifies eight characters at a time: a character is a
+  digit if its high nibble is 3 and its low nibble does not exceed 9.
+  Neither test carries across characters.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_DimCountDigits( char * pCur, char * pLimit )
+{
+    int n = 0;
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    while ( pLimit - pCur >= 8 )
+    {
+        word Word, Bad, Mask;
+        memcpy( &Word, pCur, 8 );
+        Bad  = (Word & ABC_CONST(0xF0F0F0F0F0F0F0F0)) ^ ABC_CONST(0x3030303030303030);
+        Bad |= ((Word & ABC_CONST(0x0F0F0F0F0F0F0F0F)) + ABC_CONST(0x0606060606060606)) & ABC_CONST(0x1010101010101010);
+        // set the high bit of each non-zero byte
+        Mask = (((Bad & ABC_CONST(0x7F7F7F7F7F7F7F7F)) + ABC_CONST(0x7F7F7F7F7F7F7F7F)) | Bad) & ABC_CONST(0x8080808080808080);
+        if ( Mask )
+            return n + (__builtin_ctzll(Mask) >> 3);
+        pCur += 8;
+        n    += 8;
+    }
+#endif
+    for ( ; pCur < pLimit && Abc_DimIsDigit(*pCur); pCur++ )
+        n++;
+    return n;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Skips white space and comment lines.]
+
+  Description [Comment lines are skipped using memchr(), which is
+  vectorized by the C library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_DimSkipLine( Abc_Dim_t * p )
+{
+    char * pNext = (char *)memchr( p->pCur, '\n', p->pLimit - p->pCur );
+    p->pCur = pNext ? pNext + 1 : p->pLimit;
+}
+static inline void Abc_DimSkipSpaces( Abc_Dim_t * p )
+{
+    while ( p->pCur < p->pLimit )
+    {
+        if ( Abc_DimIsSpace(*p->pCur) )
+            p->pCur++;
+        else if ( *p->pCur == 'c' )
+            Abc_DimSkipLine( p );
+        else
+            break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one signed integer.]
+
+  Description [Returns 0 if there is no integer at the current position.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_DimReadInt( Abc_Dim_t * p, int * pValue )
+{
+    int i, nDigits, fNeg = 0, Value = 0;
+    Abc_DimSkipSpaces( p );
+    if ( p->pCur < p->pLimit && (*p->pCur == '-' || *p->pCur == '+') )
+        fNeg = (*p->pCur++ == '-');
+    nDigits = Abc_DimCountDigits( p->pCur, p->pLimit );
+    if ( nDigits == 0 || nDigits > DIM_DIGITS_MAX )
+        return 0;
+    for ( i = 0; i < nDigits; i++ )
+        Value = 10 * Value + (p->pCur[i] - '0');
+    p->pCur += nDigits;
+    *pValue = fNeg ? -Value : Value;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the open file.]
+
+  Description [Maps the file into memory if possible; otherwise, reads
+  it into a buffer. Parses the header if present. The file can be closed
+  after this call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Dim_t * Abc_DimStartFile( FILE * pFile )
+{
+    Abc_Dim_t * p = ABC_CALLOC( Abc_Dim_t, 1 );
+    p->nVars = p->nClauses = -1;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        if ( fstat( fileno(pFile), &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fileno(pFile), 0 );
+            if ( pMap != MAP_FAILED )
+            {
+#ifdef MADV_SEQUENTIAL
+                madvise( pMap, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+                p->pBuffer = (char *)pMap;
+                p->nSize   = (size_t)Stat.st_size;
+                p->fMapped = 1;
+            }
+        }
+    }
+#endif
+    if ( !p->fMapped )
+    {
+        long nFileSize;
+        fseek( pFile, 0, SEEK_END );
+        nFileSize = ftell( pFile );
+        rewind( pFile );
+        p->pBuffer = ABC_ALLOC( char, Abc_MaxInt(nFileSize, 0) + 1 );
+        p->nSize   = nFileSize > 0 ? fread( p->pBuffer, 1, (size_t)nFileSize, pFile ) : 0;
+    }
+    p->pCur   = p->pBuffer;
+    p->pLimit = p->pBuffer + p->nSize;
+    // parse the header
+    Abc_DimSkipSpaces( p );
+    if ( p->pCur < p->pLimit && *p->pCur == 'p' )
+    {
+        for ( p->pCur++; p->pCur < p->pLimit && Abc_DimIsSpace(*p->pCur); p->pCur++ );
+        for ( ; p->pCur < p->pLimit && !Abc_DimIsSpace(*p->pCur); p->pCur++ );
+        if ( !Abc_DimReadInt(p, &p->nVars) || !Abc_DimReadInt(p, &p->nClauses) || p->nVars < 0 || p->nClauses < 0 )
+        {
+            printf( "Incorrect DIMACS header.\n" );
+            p->fError = 1;
+        }
+        Abc_DimSkipLine( p );
+    }
+    return p;
+}
+Abc_Dim_t * Abc_DimStart( char * pFileName )
+{
+    Abc_Dim_t * p;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    p = Abc_DimStartFile( pFile );
+    fclose( pFile );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the reader.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_DimStop( Abc_Dim_t * p )
+{
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( p->pBuffer, p->nSize );
+    else
+#endif
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next clause.]
+
+  Description [Returns 1 if a clause was read, 0 at the end of the file,
+  and -1 on a parsing error. The literals are returned in vLits using
+  the ABC encoding, that is, DIMACS literal -3 becomes literal 5.
+  The last clause may miss the terminating zero. The clause can be
+  empty if the file contains a single zero.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_DimReadClause( Abc_Dim_t * p, Vec_Int_t * vLits )
+{
+    Vec_IntClear( vLits );
+    return Abc_DimReadClauseAppend( p, vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next clause and appends it to the array.]
+
+  Description [Same as Abc_DimReadClause() but the literals are added 
+  at the end of vLits without clearing it. This allows the caller to
+  decode all clauses into one array. The number of literals in the 
+  clause is the increase of the size of vLits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_DimReadClauseAppend( Abc_Dim_t * p, Vec_Int_t * vLits )
+{
+    int Value, nStart = Vec_IntSize(vLits);
+    if ( p->fError )
+        return -1;
+    while ( 1 )
+    {
+        Abc_DimSkipSpaces( p );
+        // '%' is used by some benchmark sets to mark the end of the file
+        if ( p->pCur == p->pLimit || *p->pCur == '%' )
+        {
+            p->pCur = p->pLimit;
+            if ( Vec_IntSize(vLits) == nStart )
+                return 0;
+            break;
+        }
+        if ( !Abc_DimReadInt( p, &Value ) )
+        {
+            printf( "DIMACS parsing error: Unexpected character '%c' in clause %d.\n", p->pCur < p->pLimit ? *p->pCur : ' ', p->nClausesRead + 1 );
+            p->fError = 1;
+            return -1;
+        }
+        if ( Value == 0 )
+            break;
+        Vec_IntPush( vLits, Abc_Var2Lit(Abc_AbsInt(Value) - 1, Value < 0) );
+        p->nVarsMax = Abc_MaxInt( p->nVarsMax, Abc_AbsInt(Value) );
+    }
+    p->nClausesRead++;
+    p->nLitsRead += Vec_IntSize(vLits) - nStart;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,85 @@
+/**CFile****************************************************************
+
+  FileName    [utilDimacs.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DIMACS CNF reader shared by the SAT solvers.]
+
+  Synopsis    [External declarations.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilDimacs.h,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilDimacs_h
+#define ABC__misc__util__utilDimacs_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include "misc/vec/vecInt.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Abc_Dim_t_           Abc_Dim_t;
+struct Abc_Dim_t_
+{
+    char *           pBuffer;      // the file contents (mapped or read)
+    char *           pCur;         // the current reading position
+    char *           pLimit;       // the end of the contents
+    size_t           nSize;        // the size of the contents
+    int              fMapped;      // the contents are memory-mapped
+    int              nVars;        // the number of variables in the header (-1 if no header)
+    int              nClauses;     // the number of clauses in the header (-1 if no header)
+    int              nVarsMax;     // the number of variables seen so far
+    int              nClausesRead; // the number of clauses read so far
+    int              nLitsRead;    // the number of literals read so far
+    int              fError;       // a parsing error was detected
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// iterates through the clauses; the literals use the ABC encoding (2*(v-1) + complement)
+#define Abc_DimForEachClause( p, vLits )  \
+    while ( Abc_DimReadClause(p, vLits) == 1 )
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilDimacs.c ===============================================================*/
+extern Abc_Dim_t *     Abc_DimStart( char * pFileName );
+extern Abc_Dim_t *     Abc_DimStartFile( FILE * pFile );
+extern void            Abc_DimStop( Abc_Dim_t * p );
+extern int             Abc_DimReadClause( Abc_Dim_t * p, Vec_Int_t * vLits );
+extern int             Abc_DimReadClauseAppend( Abc_Dim_t * p, Vec_Int_t * vLits );
+
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,363 @@
+/**CFile****************************************************************
+
+  FileName    [utilSatStat.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Instrumentation of the SAT solver calls.]
+
+  Synopsis    [Ring buffer of the SAT solver calls.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilSatStat.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+
+#include "misc/vec/vec.h"
+#include "utilSatStat.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the solvers call Abc_SatStatIsOn() once per call and do nothing else
+// when the collection is disabled; otherwise, they report the difference
+// of their own counters before and after the call using Abc_SatStatAdd()
+
+#define SAT_STAT_HISTO   40     // the number of histogram bins
+
+static Abc_SatCall_t * s_pSatCalls    = NULL;  // the ring buffer of the calls
+static int             s_nSatCallsMax = 0;     // the size of the ring buffer
+static word            s_nSatCalls    = 0;     // the number of calls recorded so far
+static int             s_fSatStatOn   = 0;     // the collection is enabled
+static Vec_Ptr_t *     s_vSatTags     = NULL;  // the caller tags
+static int             s_iSatTag      = 0;     // the current caller tag
+
+static char *          s_pSatNames[ABC_SAT_NUM] = { "bsat", "satoko", "glucose", "bsat2", "bsat3" };
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_SatStatMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static inline int      Abc_SatStatCallNum()   { return (int)Abc_MinWord( s_nSatCalls, (word)s_nSatCallsMax );      }
+static inline Abc_SatCall_t * Abc_SatStatCall( int i ) // the i-th oldest call in the buffer
+{
+    word iFirst = s_nSatCalls - Abc_SatStatCallNum();
+    return s_pSatCalls + (int)((iFirst + i) % s_nSatCallsMax);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the collection.]
+
+  Description [The ring buffer keeps the last nCallsMax calls.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SatStatIsOn()
+{
+    return s_fSatStatOn;
+}
+int Abc_SatStatCallsMax()
+{
+    return s_nSatCallsMax;
+}
+void Abc_SatStatStart( int nCallsMax )
+{
+    assert( nCallsMax > 0 );
+    Abc_SatStatStop();
+    s_pSatCalls    = ABC_CALLOC( Abc_SatCall_t, nCallsMax );
+    s_nSatCallsMax = nCallsMax;
+    s_nSatCalls    = 0;
+    s_vSatTags     = Vec_PtrAlloc( 100 );
+    Vec_PtrPush( s_vSatTags, Abc_UtilStrsav("-") );
+    s_iSatTag      = 0;
+    s_fSatStatOn   = 1;
+}
+void Abc_SatStatStop()
+{
+    s_fSatStatOn = 0;
+    if ( s_vSatTags )
+        Vec_PtrFreeFree( s_vSatTags );
+    s_vSatTags = NULL;
+    ABC_FREE( s_pSatCalls );
+    s_nSatCallsMax = 0;
+    s_nSatCalls    = 0;
+    s_iSatTag      = 0;
+}
+void Abc_SatStatReset()
+{
+    s_nSatCalls = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the caller tag.]
+
+  Description [Returns the previous tag, which should be restored using
+  Abc_SatStatRestoreTag() after the tagged computation is finished.
+  Does nothing and returns -1 if the collection is disabled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SatStatSetTag( char * pTag )
+{
+    char * pEntry;
+    int i, iTagOld = s_iSatTag;
+    if ( !s_fSatStatOn )
+        return -1;
+    Vec_PtrForEachEntry( char *, s_vSatTags, pEntry, i )
+        if ( !strcmp(pEntry, pTag) )
+            break;
+    if ( i == Vec_PtrSize(s_vSatTags) )
+        Vec_PtrPush( s_vSatTags, Abc_UtilStrsav(pTag) );
+    s_iSatTag = i;
+    return iTagOld;
+}
+void Abc_SatStatRestoreTag( int iTag )
+{
+    if ( s_fSatStatOn && iTag >= 0 && iTag < Vec_PtrSize(s_vSatTags) )
+        s_iSatTag = iTag;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records one call.]
+
+  Description [The result is 1 (SAT), 0 (UNSAT), or -1 (undecided).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SatStatAdd( int Solver, int Result, int nVars, int nClauses, int nAssumps, word nConflicts, word nPropagations, word nDecisions, word nLearntLits, abctime Time )
+{
+    Abc_SatCall_t * pCall;
+    assert( Solver >= 0 && Solver < ABC_SAT_NUM );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_SatStatMutex );
+#endif
+    if ( s_fSatStatOn )
+    {
+        pCall = s_pSatCalls + (int)(s_nSatCalls++ % s_nSatCallsMax);
+        pCall->iTag          = s_iSatTag;
+        pCall->Solver        = Solver;
+        pCall->Result        = Result;
+        pCall->nVars         = nVars;
+        pCall->nClauses      = nClauses;
+        pCall->nAssumps      = nAssumps;
+        pCall->nConflicts    = nConflicts;
+        pCall->nPropagations = nPropagations;
+        pCall->nDecisions    = nDecisions;
+        pCall->nLearntLits   = nLearntLits;
+        pCall->Time          = Time;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_SatStatMutex );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the histogram of one metric.]
+
+  Description [Bin 0 contains zero values; bin k > 0 contains the values
+  in the range [2^(k-1), 2^k). The metric is 0 (conflicts), 1 (runtime
+  in microseconds), or 2 (the average learned clause size).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Abc_SatStatMetric( Abc_SatCall_t * pCall, int Metric )
+{
+    if ( Metric == 0 )
+        return pCall->nConflicts;
+    if ( Metric == 1 )
+        return (word)((double)pCall->Time * 1000000 / CLOCKS_PER_SEC);
+    return pCall->nConflicts ? pCall->nLearntLits / pCall->nConflicts : 0;
+}
+static void Abc_SatStatPrintHisto( int Metric, int nCalls, abctime TimeAll )
+{
+    char * pTitles[3] = { "Conflicts per call", "Runtime per call (usec)", "Average learned clause size" };
+    int    pCalls[SAT_STAT_HISTO] = {0}, pUnsat[SAT_STAT_HISTO] = {0};
+    abctime pTimes[SAT_STAT_HISTO] = {0};
+    Abc_SatCall_t * pCall;
+    word Value;
+    int i, b, bMax = 0;
+    for ( i = 0; i < nCalls; i++ )
+    {
+        pCall = Abc_SatStatCall( i );
+        Value = Abc_SatStatMetric( pCall, Metric );
+        for ( b = 0; Value && b < SAT_STAT_HISTO - 1; b++ )
+            Value >>= 1;
+        pCalls[b]++;
+        pUnsat[b] += (pCall->Result == 0);
+        pTimes[b] += pCall->Time;
+        bMax = Abc_MaxInt( bMax, b );
+    }
+    printf( "%s:\n", pTitles[Metric] );
+    for ( b = 0; b <= bMax; b++ )
+    {
+        if ( b == 0 )
+            printf( "  %21d", 0 );
+        else
+            printf( "  %10.0f - %8.0f", pow(2.0, b-1), pow(2.0, b) - 1 );
+        printf( " : Calls = %8d (%6.2f %%)  Unsat = %8d  ", pCalls[b], 100.0 * pCalls[b] / Abc_MaxInt(nCalls, 1), pUnsat[b] );
+        printf( "Time = %9.2f sec (%6.2f %%)\n", 1.0 * pTimes[b] / CLOCKS_PER_SEC, TimeAll ? 100.0 * pTimes[b] / TimeAll : 0.0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the recorded calls.]
+
+  Description [Prints one line for each pair of the caller tag and the
+  solver. If fHisto is set, also prints the histograms of the conflicts,
+  the runtime, and the learned clause sizes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SatStatPrint( int fHisto )
+{
+    Abc_SatCall_t * pCall, * pSums;
+    int * pCalls, * pSat, * pUnsat;
+    int i, k, nTags, nCalls = Abc_SatStatCallNum();
+    abctime TimeAll = 0;
+    if ( !s_fSatStatOn )
+    {
+        printf( "The collection of SAT solver statistics is not enabled (use \"sat_stats -e\").\n" );
+        return;
+    }
+    printf( "Recorded %.0f SAT calls", (double)s_nSatCalls );
+    if ( s_nSatCalls > (word)nCalls )
+        printf( " (the last %d are kept)", nCalls );
+    printf( ".\n" );
+    if ( nCalls == 0 )
+        return;
+    // collect the sums for each pair of the tag and the solver
+    nTags  = Vec_PtrSize(s_vSatTags) * ABC_SAT_NUM;
+    pSums  = ABC_CALLOC( Abc_SatCall_t, nTags );
+    pCalls = ABC_CALLOC( int, nTags );
+    pSat   = ABC_CALLOC( int, nTags );
+    pUnsat = ABC_CALLOC( int, nTags );
+    for ( i = 0; i < nCalls; i++ )
+    {
+        pCall = Abc_SatStatCall( i );
+        k = pCall->iTag * ABC_SAT_NUM + pCall->Solver;
+        pCalls[k]++;
+        pSat[k]   += (pCall->Result == 1);
+        pUnsat[k] += (pCall->Result == 0);
+        pSums[k].nVars          = Abc_MaxInt( pSums[k].nVars, pCall->nVars );
+        pSums[k].nConflicts    += pCall->nConflicts;
+        pSums[k].nPropagations += pCall->nPropagations;
+        pSums[k].nDecisions    += pCall->nDecisions;
+        pSums[k].nLearntLits   += pCall->nLearntLits;
+        pSums[k].Time          += pCall->Time;
+        TimeAll += pCall->Time;
+    }
+    printf( "%-16s %-8s %9s %9s %9s %9s %8s %12s %12s %12s %7s %9s\n",
+        "Tag", "Solver", "Calls", "Sat", "Unsat", "Undec", "MaxVars", "Conflicts", "Props", "Decisions", "Learnt", "Time" );
+    for ( k = 0; k < nTags; k++ )
+    {
+        if ( pCalls[k] == 0 )
+            continue;
+        printf( "%-16s %-8s ", (char *)Vec_PtrEntry(s_vSatTags, k / ABC_SAT_NUM), s_pSatNames[k % ABC_SAT_NUM] );
+        printf( "%9d %9d %9d %9d %8d ", pCalls[k], pSat[k], pUnsat[k], pCalls[k] - pSat[k] - pUnsat[k], pSums[k].nVars );
+        printf( "%12.0f %12.0f %12.0f ", (double)pSums[k].nConflicts, (double)pSums[k].nPropagations, (double)pSums[k].nDecisions );
+        printf( "%7.2f ", pSums[k].nConflicts ? 1.0 * pSums[k].nLearntLits / pSums[k].nConflicts : 0.0 );
+        printf( "%9.2f\n", 1.0 * pSums[k].Time / CLOCKS_PER_SEC );
+    }
+    ABC_FREE( pSums );
+    ABC_FREE( pCalls );
+    ABC_FREE( pSat );
+    ABC_FREE( pUnsat );
+    if ( !fHisto )
+        return;
+    for ( k = 0; k < 3; k++ )
+        Abc_SatStatPrintHisto( k, nCalls, TimeAll );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the recorded calls into a CSV file.]
+
+  Description [The calls are written from the oldest to the newest.
+  Returns 0 if the file cannot be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SatStatDumpCsv( char * pFileName )
+{
+    Abc_SatCall_t * pCall;
+    int i, nCalls = s_fSatStatOn ? Abc_SatStatCallNum() : 0;
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    fprintf( pFile, "index,tag,solver,result,vars,clauses,assumptions,conflicts,propagations,decisions,learnt_lits,time\n" );
+    for ( i = 0; i < nCalls; i++ )
+    {
+        pCall = Abc_SatStatCall( i );
+        fprintf( pFile, "%.0f,%s,%s,%s,", (double)(s_nSatCalls - nCalls + i), (char *)Vec_PtrEntry(s_vSatTags, pCall->iTag), s_pSatNames[pCall->Solver],
+            pCall->Result == 1 ? "sat" : (pCall->Result == 0 ? "unsat" : "undec") );
+        fprintf( pFile, "%d,%d,%d,", pCall->nVars, pCall->nClauses, pCall->nAssumps );
+        fprintf( pFile, "%.0f,%.0f,%.0f,%.0f,", (double)pCall->nConflicts, (double)pCall->nPropagations, (double)pCall->nDecisions, (double)pCall->nLearntLits );
+        fprintf( pFile, "%.6f\n", 1.0 * pCall->Time / CLOCKS_PER_SEC );
+    }
+    fclose( pFile );
+    printf( "Written %d SAT calls into file \"%s\".\n", nCalls, pFileName );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,90 @@
+/**CFile****************************************************************
+
+  FileName    [utilSatStat.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Instrumentation of the SAT solver calls.]
+
+  Synopsis    [External declarations.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilSatStat.h,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSatStat_h
+#define ABC__misc__util__utilSatStat_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the solvers reporting their calls
+#define ABC_SAT_BSAT     0
+#define ABC_SAT_SATOKO   1
+#define ABC_SAT_GLUCOSE  2
+#define ABC_SAT_BSAT2    3
+#define ABC_SAT_BSAT3    4
+#define ABC_SAT_NUM      5
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// one call to the SAT solver
+typedef struct Abc_SatCall_t_      Abc_SatCall_t;
+struct Abc_SatCall_t_
+{
+    int              iTag;         // the caller tag (the command name, unless changed by the engine)
+    int              Solver;       // the solver (ABC_SAT_BSAT, etc)
+    int              Result;       // 1 = SAT, 0 = UNSAT, -1 = undecided
+    int              nVars;        // the number of variables in the solver
+    int              nClauses;     // the number of problem clauses in the solver
+    int              nAssumps;     // the number of assumptions
+    word             nConflicts;   // the number of conflicts (= the number of learned clauses)
+    word             nPropagations;// the number of propagations
+    word             nDecisions;   // the number of decisions
+    word             nLearntLits;  // the total size of the learned clauses
+    abctime          Time;         // the runtime of the call
+};
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSatStat.c ===============================================================*/
+extern int             Abc_SatStatIsOn();
+extern void            Abc_SatStatStart( int nCallsMax );
+extern void            Abc_SatStatStop();
+extern void            Abc_SatStatReset();
+extern int             Abc_SatStatSetTag( char * pTag );
+extern void            Abc_SatStatRestoreTag( int iTag );
+extern void            Abc_SatStatAdd( int Solver, int Result, int nVars, int nClauses, int nAssumps, word nConflicts, word nPropagations, word nDecisions, word nLearntLits, abctime Time );
+extern void            Abc_SatStatPrint( int fHisto );
+extern int             Abc_SatStatDumpCsv( char * pFileName );
+extern int             Abc_SatStatCallsMax();
+
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
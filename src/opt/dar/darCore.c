@@ -20,6 +20,17 @@
 
 #include "darInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -337,6 +348,255 @@ Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtM
     return pMemCuts;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes in the order of their levels.]
+
+  Description [Returns the nodes sorted by level. The nodes of each level
+  come in the topological order. The entry i of vStarts is the index of 
+  the first node of level i+1 in the array. The last entry is the number
+  of nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Dar_ManCollectLevels( Aig_Man_t * pAig, Vec_Int_t * vStarts )
+{
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vLevels;
+    Aig_Obj_t * pObj, * pFanin0, * pFanin1;
+    int i, Level, LevelMax = 0;
+    // compute levels of the nodes as seen by the cut computation
+    vLevels = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        pFanin0 = Aig_Regular( Aig_ObjReal_rec( Aig_ObjChild0(pObj) ) );
+        pFanin1 = Aig_Regular( Aig_ObjReal_rec( Aig_ObjChild1(pObj) ) );
+        Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevels, pFanin0->Id), Vec_IntEntry(vLevels, pFanin1->Id) );
+        Vec_IntWriteEntry( vLevels, pObj->Id, Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    // count the nodes on each level
+    Vec_IntFill( vStarts, LevelMax + 1, 0 );
+    Aig_ManForEachNode( pAig, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, pObj->Id), 1 );
+    // convert counts into the starting positions
+    for ( Level = 1; Level <= LevelMax; Level++ )
+        Vec_IntAddToEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    vNodes = Vec_PtrStart( Aig_ManNodeNum(pAig) );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        Level = Vec_IntEntry( vLevels, pObj->Id ) - 1;
+        Vec_PtrWriteEntry( vNodes, Vec_IntEntry(vStarts, Level), pObj );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // the entries now point to the next level; shift them back
+    for ( Level = LevelMax; Level > 0; Level-- )
+        Vec_IntWriteEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    Vec_IntFree( vLevels );
+    return vNodes;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+Aig_MmFixed_t * Dar_ManComputeCutsPar( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads )
+{
+    return Dar_ManComputeCuts( pAig, nCutsMax, fSkipTtMin, 0 );
+}
+
+#else // pthreads are used
+
+#define DAR_PAR_THR_MAX  64   // the largest number of threads
+#define DAR_PAR_CHUNK    64   // the smallest number of nodes given to a thread
+
+typedef struct Dar_ParMan_t_ Dar_ParMan_t;
+struct Dar_ParMan_t_
+{
+    Dar_Man_t *      p;          // the shared cut manager
+    Aig_Obj_t **     pNodes;     // the nodes sorted by level
+    int              fSkipTtMin; // skip truth table minimization
+    int              iNext;      // the next node to be processed
+    int              iStop;      // the node after the last one in this round
+    int              nChunk;     // the number of nodes given out at a time
+    int              iRound;     // the current round (one level per round)
+    int              nBusy;      // the number of threads still in this round
+    int              fStop;      // the threads should quit
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   CondStart;
+    pthread_cond_t   CondDone;
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the nodes of the current round.]
+
+  Description [Takes chunks of nodes until the round is exhausted. 
+  The statistics are accumulated in the local copy of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManComputeCutsParRound( Dar_ParMan_t * pPar, Dar_Man_t * pLoc )
+{
+    int i, iStart, iStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPar->Mutex );
+        iStart = pPar->iNext;
+        iStop  = Abc_MinInt( iStart + pPar->nChunk, pPar->iStop );
+        pPar->iNext = iStop;
+        pthread_mutex_unlock( &pPar->Mutex );
+        if ( iStart >= iStop )
+            return;
+        for ( i = iStart; i < iStop; i++ )
+            Dar_ObjMergeCuts( pLoc, pPar->pNodes[i], pPar->fSkipTtMin );
+    }
+}
+void * Dar_ManComputeCutsParThread( void * pArg )
+{
+    Dar_ParMan_t * pPar = (Dar_ParMan_t *)pArg;
+    Dar_Man_t Loc = *pPar->p;
+    int iRound = 0;
+    Loc.nCutsAll = Loc.nCutsTried = Loc.nCutsUsed = Loc.nCutsSkipped = 0;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( !pPar->fStop && pPar->iRound == iRound )
+            pthread_cond_wait( &pPar->CondStart, &pPar->Mutex );
+        if ( pPar->fStop )
+        {
+            // return the statistics
+            pPar->p->nCutsAll     += Loc.nCutsAll;
+            pPar->p->nCutsTried   += Loc.nCutsTried;
+            pPar->p->nCutsUsed    += Loc.nCutsUsed;
+            pPar->p->nCutsSkipped += Loc.nCutsSkipped;
+            pthread_mutex_unlock( &pPar->Mutex );
+            break;
+        }
+        iRound = pPar->iRound;
+        pthread_mutex_unlock( &pPar->Mutex );
+        Dar_ManComputeCutsParRound( pPar, &Loc );
+        pthread_mutex_lock( &pPar->Mutex );
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->CondDone );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for all nodes using several threads.]
+
+  Description [Produces the same cuts as Dar_ManComputeCuts(). The cutsets
+  are allocated by the calling thread in the topological order, so the 
+  memory layout does not change either. After that, the nodes are processed
+  level by level. The nodes of one level do not depend on each other, so 
+  the threads take them in chunks. Small levels are processed by the calling
+  thread alone.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_MmFixed_t * Dar_ManComputeCutsPar( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nThreads )
+{
+    pthread_t WorkerThread[DAR_PAR_THR_MAX];
+    Dar_ParMan_t Par, * pPar = &Par;
+    Dar_Man_t * p;
+    Dar_RwrPar_t Pars, * pPars = &Pars; 
+    Aig_MmFixed_t * pMemCuts;
+    Aig_Obj_t * pObj;
+    Vec_Ptr_t * vNodes;
+    Vec_Int_t * vStarts;
+    int i, k, status, iStart, iStop;
+    if ( nThreads < 2 )
+        return Dar_ManComputeCuts( pAig, nCutsMax, fSkipTtMin, 0 );
+    nThreads = Abc_MinInt( nThreads, DAR_PAR_THR_MAX );
+    // remove dangling nodes
+    Aig_ManCleanup( pAig );
+    // create rewriting manager
+    Dar_ManDefaultRwrParams( pPars );
+    pPars->nCutsMax = nCutsMax;
+    p = Dar_ManStart( pAig, pPars );
+    // allocate all cutsets in the same order as the sequential version
+    Aig_MmFixedRestart( p->pMemCuts );
+    Dar_ObjPrepareCuts( p, Aig_ManConst1(p->pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Dar_ObjPrepareCuts( p, pObj );
+    Aig_ManForEachNode( pAig, pObj, i )
+        Dar_ObjPrepareCuts( p, pObj );
+    // sort the nodes by level
+    vStarts = Vec_IntAlloc( 100 );
+    vNodes = Dar_ManCollectLevels( pAig, vStarts );
+    // start the threads
+    memset( pPar, 0, sizeof(Dar_ParMan_t) );
+    pPar->p          = p;
+    pPar->pNodes     = (Aig_Obj_t **)Vec_PtrArray( vNodes );
+    pPar->fSkipTtMin = fSkipTtMin;
+    pthread_mutex_init( &pPar->Mutex, NULL );
+    pthread_cond_init( &pPar->CondStart, NULL );
+    pthread_cond_init( &pPar->CondDone, NULL );
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Dar_ManComputeCutsParThread, (void *)pPar );  assert( status == 0 );
+    }
+    // process the levels
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        iStart = Vec_IntEntry( vStarts, i );
+        iStop  = Vec_IntEntry( vStarts, i+1 );
+        if ( iStop - iStart < 2 * DAR_PAR_CHUNK )
+        {
+            for ( k = iStart; k < iStop; k++ )
+                Dar_ObjMergeCuts( p, pPar->pNodes[k], fSkipTtMin );
+            continue;
+        }
+        pthread_mutex_lock( &pPar->Mutex );
+        pPar->iNext  = iStart;
+        pPar->iStop  = iStop;
+        pPar->nChunk = Abc_MaxInt( DAR_PAR_CHUNK, (iStop - iStart) / (4 * nThreads) );
+        pPar->nBusy  = nThreads - 1;
+        pPar->iRound++;
+        pthread_cond_broadcast( &pPar->CondStart );
+        pthread_mutex_unlock( &pPar->Mutex );
+        // the calling thread works too
+        Dar_ManComputeCutsParRound( pPar, p );
+        pthread_mutex_lock( &pPar->Mutex );
+        while ( pPar->nBusy > 0 )
+            pthread_cond_wait( &pPar->CondDone, &pPar->Mutex );
+        pthread_mutex_unlock( &pPar->Mutex );
+    }
+    // stop the threads
+    pthread_mutex_lock( &pPar->Mutex );
+    pPar->fStop = 1;
+    pthread_cond_broadcast( &pPar->CondStart );
+    pthread_mutex_unlock( &pPar->Mutex );
+    for ( k = 0; k < nThreads - 1; k++ )
+        pthread_join( WorkerThread[k], NULL );
+    pthread_cond_destroy( &pPar->CondStart );
+    pthread_cond_destroy( &pPar->CondDone );
+    pthread_mutex_destroy( &pPar->Mutex );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vStarts );
+    // free the cuts
+    pMemCuts = p->pMemCuts;
+    p->pMemCuts = NULL;
+    // stop the rewriting manager
+    Dar_ManStop( p );
+    return pMemCuts;
+}
+
+#endif // pthreads are used
+
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,7 @@ struct Cec_ParSim_t_
     int              fSeqSimulate;  // performs sequential simulation
     int              fLatchCorr;    // consider only latch outputs
     int              fConstCorr;    // consider only constants
+    int              fBiasSim;      // uses biased and targeted patterns
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -125,6 +126,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nCubeProcs;    // the number of cube-and-conquer threads (0 = not used)
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -220,6 +222,8 @@ extern void          Cec_ManSimulation( Gia_Man_t * pAig, Cec_ParSim_t * pPars )
 extern int           Cec_ManSeqResimulateCounter( Gia_Man_t * pAig, Cec_ParSim_t * pPars, Abc_Cex_t * pCex );
 extern int           Cec_ManSeqSemiformal( Gia_Man_t * pAig, Cec_ParSmf_t * pPars );
 extern int           Cec_ManCheckNonTrivialCands( Gia_Man_t * pAig );
+/*=== cecSplit.c ==========================================================*/
+extern int           Cec_GiaCubeConquer( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int fVerbose );
 /*=== cecSynth.c ==========================================================*/
 extern int           Cec_SeqReadMinDomSize( Cec_ParSeq_t * p );
 extern int           Cec_SeqReadVerbose( Cec_ParSeq_t * p );
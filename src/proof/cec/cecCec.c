@@ -312,6 +312,48 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs checking using cube-and-conquer.]
+
+  Description [Takes the dual-output miter and the original miter, 
+  which gets the counter-example.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifyCubes( Gia_Man_t * p, Gia_Man_t * pInit, Cec_ParCec_t * pPars, abctime clkTotal )
+{
+    Gia_Man_t * pMiter = Gia_ManTransformMiter( p );
+    int nTimeLeft = pPars->TimeLimit ? Abc_MaxInt( 1, pPars->TimeLimit - (int)((Abc_Clock() - clkTotal)/CLOCKS_PER_SEC) ) : 0;
+    int RetValue;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Calling cube-and-conquer with %d threads.\n", pPars->nCubeProcs );
+    fflush( stdout );
+    RetValue = Cec_GiaCubeConquer( pMiter, pPars->nCubeProcs, 0, nTimeLeft, pPars->fVerbose );
+    if ( RetValue == 0 )
+    {
+        pInit->pCexComb = pMiter->pCexComb; pMiter->pCexComb = NULL;
+        pPars->iOutFail = pInit->pCexComb->iPo;
+        if ( !Gia_ManVerifyCex( pInit, pInit->pCexComb, 1 ) )
+            Abc_Print( 1, "Counter-example simulation has failed.\n" );
+    }
+    Gia_ManStop( pMiter );
+    if ( !pPars->fSilent && (RetValue >= 0 || pPars->TimeLimit) )
+    {
+        if ( RetValue == 1 )
+            Abc_Print( 1, "Networks are equivalent.  " );
+        else if ( RetValue == 0 )
+            Abc_Print( 1, "Networks are NOT EQUIVALENT.  " );
+        else
+            Abc_Print( 1, "Networks are UNDECIDED.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [New CEC engine.]
@@ -345,7 +387,10 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     Gia_ManStop( pNew );
     if ( pPars->fNaive )
     {
-        RetValue = Cec_ManVerifyNaive( p, pPars );
+        if ( pPars->nCubeProcs > 0 )
+            RetValue = Cec_ManVerifyCubes( p, pInit, pPars, clkTotal );
+        else
+            RetValue = Cec_ManVerifyNaive( p, pPars );
         Gia_ManStop( p );
         return RetValue;
     }
@@ -400,6 +445,16 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
         Gia_ManStop( pNew );
         return -1;
     }
+    // call cube-and-conquer
+    if ( pPars->nCubeProcs > 0 )
+    {
+        RetValue = Cec_ManVerifyCubes( pNew, p, pPars, clkTotal );
+        if ( RetValue >= 0 || pPars->TimeLimit )
+        {
+            Gia_ManStop( pNew );
+            return RetValue;
+        }
+    }
     // call other solver
     if ( pPars->fVerbose )
         Abc_Print( 1, "Calling the old CEC engine.\n" );
@@ -737,6 +737,9 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
         }
 
 references:
+        // update signal probabilities
+        if ( p->vProbs )
+            Gia_ManSimBiasRecord( p->vProbs, i, pRes + 1, p->nWords );
         // if this node is candidate constant, collect it
         if ( Gia_ObjIsConst(p->pAig, i) && !Cec_ManSimCompareConst(pRes + 1, p->nWords) )
         {
@@ -794,6 +797,75 @@ references:
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Derives biased and targeted patterns for this round.]
+
+  Description [Targets are the candidate constants and the pairs of
+  nodes in the same class that were not refined so far. For each target,
+  the rare value of the node (or of the node in the pair with the more
+  skewed probability) is justified to the CIs. The resulting assignments
+  are written into the leading patterns, while the CI biases derived from
+  them are used to generate the remaining patterns. Only free CIs (the
+  first nCisFree) are assigned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSimCreateInfoBiased( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, int nCisFree )
+{
+    Gia_Obj_t * pObj, * pRepr;
+    unsigned * pRes0;
+    int * pCube;
+    int i, k, iObj, iRepr, nObjs, Lit, iPat = 1;
+    int nTargetsMax = Abc_MaxInt( 1, 32 * p->nWords / 4 );
+    // justify the targets
+    Vec_IntFill( p->vVotes, 2 * Gia_ManCiNum(p->pAig), 0 );
+    Vec_IntClear( p->vCubes );
+    p->nTargets = 0;
+    nObjs = Gia_ManObjNum(p->pAig);
+    for ( k = 0; k < nObjs && p->nTargets < nTargetsMax; k++ )
+    {
+        iObj = (p->iTarget + k) % nObjs;
+        pObj = Gia_ManObj( p->pAig, iObj );
+        if ( !Gia_ObjIsAnd(pObj) && !Gia_ObjIsCi(pObj) )
+            continue;
+        iRepr = Gia_ObjRepr( p->pAig, iObj );
+        if ( iRepr == GIA_VOID )
+            continue;
+        if ( iRepr > 0 )
+        {
+            pRepr = Gia_ManObj( p->pAig, iRepr );
+            if ( Gia_ManSimBiasIsRare(p->pAig, p->vProbs, pRepr, 2) && !Gia_ManSimBiasIsRare(p->pAig, p->vProbs, pObj, 2) )
+                pObj = pRepr;
+        }
+        Gia_ManSimBiasJustify( p->pAig, pObj, Gia_ManSimBiasRareValue(p->pAig, p->vProbs, pObj), p->vProbs, p->vCube );
+        Gia_ManSimBiasAddVotes( p->vCube, p->vVotes );
+        Vec_IntPush( p->vCubes, Vec_IntSize(p->vCube) );
+        Vec_IntAppend( p->vCubes, p->vCube );
+        p->nTargets++;
+    }
+    p->iTarget = (p->iTarget + k) % nObjs;
+    // generate biased patterns
+    Vec_IntFill( p->vBias, Gia_ManCiNum(p->pAig), 8 );
+    p->nBiased = Gia_ManSimBiasDerive( p->vVotes, p->vBias );
+    for ( i = 0; i < nCisFree; i++ )
+        Gia_ManSimBiasFillInfo( (unsigned *)Vec_PtrEntry(vInfoCis, i), p->nWords, Vec_IntEntry(p->vBias, i) );
+    // write the targeted patterns
+    for ( pCube = Vec_IntArray(p->vCubes); pCube < Vec_IntLimit(p->vCubes); pCube += 1 + pCube[0], iPat++ )
+        for ( k = 1; k <= pCube[0]; k++ )
+        {
+            Lit = pCube[k];
+            if ( Abc_Lit2Var(Lit) >= nCisFree )
+                continue;
+            pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, Abc_Lit2Var(Lit) );
+            if ( Abc_InfoHasBit(pRes0, iPat) == Abc_LitIsCompl(Lit) )
+                Abc_InfoXorBit( pRes0, iPat );
+        }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates simulation info for this round.]
@@ -812,6 +884,9 @@ void Cec_ManSimCreateInfo( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * v
     if ( p->pPars->fSeqSimulate && Gia_ManRegNum(p->pAig) > 0 )
     {
         assert( vInfoCis && vInfoCos );
+        if ( p->vProbs )
+            Cec_ManSimCreateInfoBiased( p, vInfoCis, Gia_ManPiNum(p->pAig) );
+        else
         for ( i = 0; i < Gia_ManPiNum(p->pAig); i++ )
         {
             pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, i );
@@ -826,6 +901,8 @@ void Cec_ManSimCreateInfo( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * v
                 pRes0[w] = pRes1[w];
         }
     }
+    else if ( p->vProbs )
+        Cec_ManSimCreateInfoBiased( p, vInfoCis, Gia_ManCiNum(p->pAig) );
     else 
     {
         for ( i = 0; i < Gia_ManCiNum(p->pAig); i++ )
@@ -907,16 +984,27 @@ int Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int LevelMax )
 ***********************************************************************/
 int Cec_ManSimClassesRefine( Cec_ManSim_t * p )
 {
-    int i;
+    int i, nLitsOld, nLitsNew;
+    int fReport = p->pPars->fVerbose && (p->vProbs || p->pPars->fVeryVerbose);
     Gia_ManCreateValueRefs( p->pAig );
     p->nWords = p->pPars->nWords;
     for ( i = 0; i < p->pPars->nRounds; i++ )
     {
         if ( (i % (p->pPars->nRounds / 5)) == 0 && p->pPars->fVerbose )
             Gia_ManEquivPrintClasses( p->pAig, 0, Cec_MemUsage(p) );
+        nLitsOld = fReport ? Gia_ManEquivCountLits( p->pAig ) : 0;
         Cec_ManSimCreateInfo( p, p->vCiSimInfo, p->vCoSimInfo );
         if ( Cec_ManSimSimulateRound( p, p->vCiSimInfo, p->vCoSimInfo ) )
             return 1;
+        if ( fReport )
+        {
+            nLitsNew = Gia_ManEquivCountLits( p->pAig );
+            Abc_Print( 1, "Round %3d :  Lits = %8d.  Refined = %6d (%6.2f %%).", 
+                i, nLitsNew, nLitsOld - nLitsNew, nLitsOld ? 100.0 * (nLitsOld - nLitsNew) / nLitsOld : 0.0 );
+            if ( p->vProbs )
+                Abc_Print( 1, "  Targets = %5d.  Biased CIs = %5d.", p->nTargets, p->nBiased );
+            Abc_Print( 1, "\n" );
+        }
     }
     if ( p->pPars->fVerbose )
         Gia_ManEquivPrintClasses( p->pAig, 0, Cec_MemUsage(p) );
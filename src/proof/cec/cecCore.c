@@ -80,6 +80,7 @@ void Cec_ManSimSetDefaultParams( Cec_ParSim_t * p )
     p->fDualOut       =       0;  // miter with separate outputs
     p->fConstCorr     =       0;  // consider only constants
     p->fSeqSimulate   =       0;  // performs sequential simulation
+    p->fBiasSim       =       0;  // uses biased and targeted patterns
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
 } 
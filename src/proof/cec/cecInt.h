@@ -59,6 +59,7 @@ struct Cec_ManPat_t_
     int              nPatLitsMin;    // total number of literals in minimized recent patterns
     int              nPatLitsMinAll; // total number of literals in minimized all patterns
     int              nSeries;        // simulation series
+    int              nShrinkMax;     // the max number of literals in a pattern to be shrunk
     int              fVerbose;       // verbose stats
     // runtime statistics
     abctime          timeFind;       // detecting the pattern  
@@ -87,6 +88,10 @@ struct Cec_ManSat_t_
     int              nRecycles;      // the number of times SAT solver was recycled
     int              nCallsSince;    // the number of calls since the last recycle
     Vec_Ptr_t *      vFanins;        // fanins of the CNF node
+    Vec_Int_t *      vCnfStart;      // offset of the cached CNF fragment of each node
+    Vec_Int_t *      vCnfData;       // cached CNF fragments in terms of object literals
+    Vec_Int_t *      vCnfLits;       // temporary clause in terms of SAT literals
+    int              nCnfHits;       // the number of fragments reused from the cache
     // counter-examples
     Vec_Int_t *      vCex;           // the latest counter-example
     Vec_Int_t *      vVisits;        // temporary array for visited nodes  
@@ -139,6 +144,15 @@ struct Cec_ManSim_t_
     Vec_Int_t *      vClassNew;      // new class numbers
     Vec_Int_t *      vClassTemp;     // temporary storage
     Vec_Int_t *      vRefinedC;      // refined const reprs
+    // biased pattern generation
+    Vec_Int_t *      vProbs;         // signal probabilities of the objects
+    Vec_Int_t *      vBias;          // biases of the CIs
+    Vec_Int_t *      vVotes;         // CI value requests of the targets
+    Vec_Int_t *      vCube;          // justified CI assignment of one target
+    Vec_Int_t *      vCubes;         // justified CI assignments of this round
+    int              iTarget;        // the next object to be targeted
+    int              nTargets;       // the number of targets in this round
+    int              nBiased;        // the number of biased CIs in this round
 };
 
 // combinational simulation manager
@@ -55,6 +55,9 @@ Cec_ManSat_t * Cec_ManSatCreate( Gia_Man_t * pAig, Cec_ParSat_t * pPars )
     p->pSatVars     = ABC_CALLOC( int, Gia_ManObjNum(pAig) );
     p->vUsedNodes   = Vec_PtrAlloc( 1000 );
     p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vCnfStart    = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vCnfData     = Vec_IntAlloc( 1000 );
+    p->vCnfLits     = Vec_IntAlloc( 100 );
     p->vCex         = Vec_IntAlloc( 100 );
     p->vVisits      = Vec_IntAlloc( 100 );
     return p;
@@ -77,7 +80,8 @@ void Cec_ManSatPrintStats( Cec_ManSat_t * p )
     Abc_Print( 1, "AND = %8d  ", Gia_ManAndNum(p->pAig) );
     Abc_Print( 1, "Conf = %5d  ", p->pPars->nBTLimit );
     Abc_Print( 1, "MinVar = %5d  ", p->pPars->nSatVarMax );
-    Abc_Print( 1, "MinCalls = %5d\n", p->pPars->nCallsRecycle );
+    Abc_Print( 1, "MinCalls = %5d  ", p->pPars->nCallsRecycle );
+    Abc_Print( 1, "CnfHits = %8d\n", p->nCnfHits );
     Abc_Print( 1, "Unsat calls %6d  (%6.2f %%)   Ave conf = %8.1f   ", 
         p->nSatUnsat, p->nSatTotal? 100.0*p->nSatUnsat/p->nSatTotal : 0.0, p->nSatUnsat? 1.0*p->nConfUnsat/p->nSatUnsat :0.0 );
     Abc_PrintTimeP( 1, "Time", p->timeSatUnsat, p->timeTotal );
@@ -109,6 +113,9 @@ void Cec_ManSatStop( Cec_ManSat_t * p )
     Vec_IntFree( p->vVisits );
     Vec_PtrFree( p->vUsedNodes );
     Vec_PtrFree( p->vFanins );
+    Vec_IntFree( p->vCnfStart );
+    Vec_IntFree( p->vCnfData );
+    Vec_IntFree( p->vCnfLits );
     ABC_FREE( p->pSatVars );
     ABC_FREE( p );
 }
@@ -133,6 +140,7 @@ Cec_ManPat_t * Cec_ManPatStart()
     p->vStorage  = Vec_StrAlloc( 1<<20 );
     p->vPattern1 = Vec_IntAlloc( 1000 );
     p->vPattern2 = Vec_IntAlloc( 1000 );
+    p->nShrinkMax = 100;
     return p;
 }
 
@@ -214,6 +222,14 @@ Cec_ManSim_t * Cec_ManSimStart( Gia_Man_t * pAig, Cec_ParSim_t *  pPars )
         p->vCoSimInfo = Vec_PtrAllocSimInfo( Gia_ManCoNum(p->pAig), pPars->nWords );
         Vec_PtrCleanSimInfo( p->vCoSimInfo, 0, pPars->nWords );
     }
+    if ( pPars->fBiasSim )
+    {
+        p->vProbs = Vec_IntStartFull( Gia_ManObjNum(p->pAig) );
+        p->vBias  = Vec_IntAlloc( Gia_ManCiNum(p->pAig) );
+        p->vVotes = Vec_IntAlloc( 2 * Gia_ManCiNum(p->pAig) );
+        p->vCube  = Vec_IntAlloc( 100 );
+        p->vCubes = Vec_IntAlloc( 1000 );
+    }
     p->iOut = -1;
     return p;
 }
@@ -235,6 +251,11 @@ void Cec_ManSimStop( Cec_ManSim_t * p )
     Vec_IntFree( p->vClassNew );
     Vec_IntFree( p->vClassTemp );
     Vec_IntFree( p->vRefinedC );
+    Vec_IntFreeP( &p->vProbs );
+    Vec_IntFreeP( &p->vBias );
+    Vec_IntFreeP( &p->vVotes );
+    Vec_IntFreeP( &p->vCube );
+    Vec_IntFreeP( &p->vCubes );
     if ( p->vCiSimInfo ) 
         Vec_PtrFree( p->vCiSimInfo );
     if ( p->vCoSimInfo ) 
@@ -303,6 +303,66 @@ void Cec_ManPatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vPat
     assert( Value == GIA_ONE );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks whether the partial pattern justifies the output.]
+
+  Description [Performs ternary simulation of the cone of pObj with
+  the CIs assigned according to the literals of the pattern, except
+  the literal iSkip, while the remaining CIs are undefined.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPatCheckPattern( Gia_Man_t * p, Gia_Obj_t * pObj, int * pLits, int nLits, int iSkip )
+{
+    Gia_Obj_t * pTemp;
+    int i, Value;
+    Gia_ManIncrementTravId( p );
+    for ( i = 0; i < nLits; i++ )
+    {
+        if ( i == iSkip )
+            continue;
+        pTemp = Gia_ManCi( p, Abc_Lit2Var(pLits[i]) );
+        pTemp->fMark0 =  Abc_LitIsCompl(pLits[i]);
+        pTemp->fMark1 = !Abc_LitIsCompl(pLits[i]);
+        Gia_ObjSetTravIdCurrent( p, pTemp );
+    }
+    Value = Cec_ManPatComputePattern3_rec( p, Gia_ObjFanin0(pObj) );
+    Value = Gia_XsimNotCond( Value, Gia_ObjFaninC0(pObj) );
+    return Value == GIA_ONE;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reduces the pattern to its essential care bits.]
+
+  Description [Tries to drop each literal of the pattern in turn and
+  keeps it dropped if ternary simulation still justifies the output.
+  The resulting pattern is irredundant: each remaining literal is needed.
+  Returns the number of literals removed.]
+               
+  SideEffects [Overwrites fMark0/fMark1 of the nodes in the cone.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPatShrinkPattern( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vPat )
+{
+    int i, k, nLitsOld = Vec_IntSize(vPat);
+    for ( i = Vec_IntSize(vPat) - 1; i >= 0; i-- )
+    {
+        if ( !Cec_ManPatCheckPattern( p, pObj, Vec_IntArray(vPat), Vec_IntSize(vPat), i ) )
+            continue;
+        for ( k = i + 1; k < Vec_IntSize(vPat); k++ )
+            Vec_IntWriteEntry( vPat, k-1, Vec_IntEntry(vPat, k) );
+        Vec_IntShrink( vPat, Vec_IntSize(vPat) - 1 );
+    }
+    return nLitsOld - Vec_IntSize(vPat);
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -384,6 +444,13 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
     Cec_ManPatComputePattern2_rec( p->pAig, Gia_ObjFanin0(pObj), pMan->vPattern2 );
     // compare patterns
     vPat = Vec_IntSize(pMan->vPattern1) < Vec_IntSize(pMan->vPattern2) ? pMan->vPattern1 : pMan->vPattern2;
+    // reduce the pattern to the essential care bits
+    if ( Vec_IntSize(vPat) <= pMan->nShrinkMax )
+    {
+        abctime clk = Abc_Clock();
+        Cec_ManPatShrinkPattern( p->pAig, pObj, vPat );
+        pMan->timeShrink += Abc_Clock() - clk;
+    }
     pMan->nPatLitsMin += Vec_IntSize(vPat);
     pMan->nPatLitsMinAll += Vec_IntSize(vPat);
 //pMan->timeShrink += Abc_Clock() - clk;
@@ -441,6 +508,40 @@ int Cec_ManPatCollectTry( Vec_Ptr_t * vInfo, Vec_Ptr_t * vPres, int iBit, int *
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the first bit where the pattern can be packed.]
+
+  Description [Computes the compatibility of the pattern with all bits
+  of one word at a time: a bit is compatible if none of the literals
+  conflicts with a value already assigned there. The first bit of each
+  series of nWordsSeries words is reserved. Returns -1 if there is no
+  compatible bit among the first nWords words.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPatCollectFind( Vec_Ptr_t * vInfo, Vec_Ptr_t * vPres, int nWords, int nWordsSeries, int * pLits, int nLits )
+{
+    unsigned * pInfo, * pPres, uMask;
+    int i, w;
+    for ( w = 0; w < nWords; w++ )
+    {
+        uMask = (w % nWordsSeries) ? ~(unsigned)0 : ~(unsigned)1;
+        for ( i = 0; i < nLits && uMask; i++ )
+        {
+            pInfo = (unsigned *)Vec_PtrEntry(vInfo, Abc_Lit2Var(pLits[i]));
+            pPres = (unsigned *)Vec_PtrEntry(vPres, Abc_Lit2Var(pLits[i]));
+            uMask &= ~(pPres[w] & (Abc_LitIsCompl(pLits[i]) ? pInfo[w] : ~pInfo[w]));
+        }
+        if ( uMask )
+            return 32 * w + Gia_WordFindFirstBit( uMask );
+    }
+    return -1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Packs patterns into array of simulation info.]
@@ -459,7 +560,6 @@ Vec_Ptr_t * Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nW
     int k, kMax = -1, nPatterns = 0;
     int iStartOld = pMan->iStart;
     int nWords = nWordsInit;
-    int nBits = 32 * nWords;
     abctime clk = Abc_Clock();
     vInfo = Vec_PtrAllocSimInfo( nInputs, nWords );
     Gia_ManRandomInfo( vInfo, 0, 0, nWords );
@@ -469,19 +569,18 @@ Vec_Ptr_t * Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nW
     {
         nPatterns++;
         Cec_ManPatRestore( pMan, vPat );
-        for ( k = 1; k < nBits; k++, k += ((k % (32 * nWordsInit)) == 0) )
-            if ( Cec_ManPatCollectTry( vInfo, vPres, k, (int *)Vec_IntArray(vPat), Vec_IntSize(vPat) ) )
-                break;
-        kMax = Abc_MaxInt( kMax, k );
-        if ( k == nBits-1 )
+        k = Cec_ManPatCollectFind( vInfo, vPres, nWords, nWordsInit, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+        if ( k == -1 )
         {
             Vec_PtrReallocSimInfo( vInfo );
             Gia_ManRandomInfo( vInfo, 0, nWords, 2*nWords );
             Vec_PtrReallocSimInfo( vPres );
             Vec_PtrCleanSimInfo( vPres, nWords, 2*nWords );
+            k = 32 * nWords + 1;
             nWords *= 2;
-            nBits *= 2;
         }
+        Cec_ManPatCollectTry( vInfo, vPres, k, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+        kMax = Abc_MaxInt( kMax, k );
     }
     Vec_PtrFree( vPres );
     pMan->nSeries = Vec_PtrReadWordsSimInfo(vInfo) / nWordsInit;
@@ -516,7 +615,6 @@ Vec_Ptr_t * Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nReg
     Vec_Ptr_t * vInfo, * vPres;
     int k, nSize, iStart, kMax = 0, nPatterns = 0;
     int nWords = nWordsInit;
-    int nBits = 32 * nWords;
 //    int RetValue;
     assert( nRegs <= nInputs );
     vPat  = Vec_IntAlloc( 100 );
@@ -542,16 +640,8 @@ Vec_Ptr_t * Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nReg
         for ( k = 0; k < nSize; k++ )
             Vec_IntPush( vPat, Vec_IntEntry( vCexStore, iStart++ ) );
         // add pattern to storage
-        for ( k = 1; k < nBits; k++, k += ((k % (32 * nWordsInit)) == 0) )
-            if ( Cec_ManPatCollectTry( vInfo, vPres, k, (int *)Vec_IntArray(vPat), Vec_IntSize(vPat) ) )
-                break;
-
-//        k = kMax + 1;
-//        RetValue = Cec_ManPatCollectTry( vInfo, vPres, k, (int *)Vec_IntArray(vPat), Vec_IntSize(vPat) );
-//        assert( RetValue == 1 );
-
-        kMax = Abc_MaxInt( kMax, k );
-        if ( k == nBits-1 )
+        k = Cec_ManPatCollectFind( vInfo, vPres, nWords, nWordsInit, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+        if ( k == -1 )
         {
             Vec_PtrReallocSimInfo( vInfo );
             Vec_PtrCleanSimInfo( vInfo, nWords, 2*nWords );
@@ -559,11 +649,13 @@ Vec_Ptr_t * Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nReg
 
             Vec_PtrReallocSimInfo( vPres );
             Vec_PtrCleanSimInfo( vPres, nWords, 2*nWords );
+            k = 32 * nWords + 1;
             nWords *= 2;
-            nBits *= 2;
         }
+        Cec_ManPatCollectTry( vInfo, vPres, k, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+        kMax = Abc_MaxInt( kMax, k );
     }
-//    Abc_Print( 1, "packed %d patterns into %d vectors (out of %d)\n", nPatterns, kMax, nBits );
+//    Abc_Print( 1, "packed %d patterns into %d vectors (out of %d)\n", nPatterns, kMax, 32 * nWords );
     Vec_PtrFree( vPres );
     Vec_IntFree( vPat );
     return vInfo;
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -52,32 +53,55 @@ int Cec_ObjSatVarValue( Cec_ManSat_t * p, Gia_Obj_t * pObj )
 
 /**Function*************************************************************
 
-  Synopsis    [Addes clauses to the solver.]
+  Synopsis    [Records one clause of the CNF fragment.]
 
-  Description []
+  Description [The literals are given in terms of object IDs.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cec_AddClausesMux( Cec_ManSat_t * p, Gia_Obj_t * pNode )
+static inline void Cec_CnfPushClause( Vec_Int_t * vCnf, int * pLits, int nLits )
+{
+    int i;
+    Vec_IntPush( vCnf, nLits );
+    for ( i = 0; i < nLits; i++ )
+        Vec_IntPush( vCnf, pLits[i] );
+}
+static inline int Cec_ObjLitCond( Cec_ManSat_t * p, Gia_Obj_t * pObj, int fCompl )
+{
+    if ( p->pPars->fPolarFlip && pObj->fPhase )
+        fCompl ^= 1;
+    return Abc_Var2Lit( Gia_ObjId(p->pAig, pObj), fCompl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives clauses of the MUX.]
+
+  Description [Clauses are added to vCnf in terms of object literals.
+  Returns the number of clauses added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_AddClausesMux( Cec_ManSat_t * p, Gia_Obj_t * pNode, Vec_Int_t * vCnf )
 {
     Gia_Obj_t * pNodeI, * pNodeT, * pNodeE;
-    int pLits[4], RetValue, VarF, VarI, VarT, VarE, fCompT, fCompE;
+    int pLits[4], fCompT, fCompE;
 
     assert( !Gia_IsComplement( pNode ) );
     assert( Gia_ObjIsMuxType( pNode ) );
     // get nodes (I = if, T = then, E = else)
     pNodeI = Gia_ObjRecognizeMux( pNode, &pNodeT, &pNodeE );
-    // get the variable numbers
-    VarF = Cec_ObjSatNum(p,pNode);
-    VarI = Cec_ObjSatNum(p,pNodeI);
-    VarT = Cec_ObjSatNum(p,Gia_Regular(pNodeT));
-    VarE = Cec_ObjSatNum(p,Gia_Regular(pNodeE));
     // get the complementation flags
     fCompT = Gia_IsComplement(pNodeT);
     fCompE = Gia_IsComplement(pNodeE);
+    pNodeT = Gia_Regular(pNodeT);
+    pNodeE = Gia_Regular(pNodeE);
 
     // f = ITE(i, t, e)
 
@@ -87,50 +111,22 @@ void Cec_AddClausesMux( Cec_ManSat_t * p, Gia_Obj_t * pNode )
     // i  + e  + f'
 
     // create four clauses
-    pLits[0] = toLitCond(VarI, 1);
-    pLits[1] = toLitCond(VarT, 1^fCompT);
-    pLits[2] = toLitCond(VarF, 0);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
-    pLits[0] = toLitCond(VarI, 1);
-    pLits[1] = toLitCond(VarT, 0^fCompT);
-    pLits[2] = toLitCond(VarF, 1);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
-    pLits[0] = toLitCond(VarI, 0);
-    pLits[1] = toLitCond(VarE, 1^fCompE);
-    pLits[2] = toLitCond(VarF, 0);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
-    pLits[0] = toLitCond(VarI, 0);
-    pLits[1] = toLitCond(VarE, 0^fCompE);
-    pLits[2] = toLitCond(VarF, 1);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( pNodeI->fPhase )               pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
+    pLits[0] = Cec_ObjLitCond( p, pNodeI, 1 );
+    pLits[1] = Cec_ObjLitCond( p, pNodeT, 1^fCompT );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  0 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
+    pLits[0] = Cec_ObjLitCond( p, pNodeI, 1 );
+    pLits[1] = Cec_ObjLitCond( p, pNodeT, 0^fCompT );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  1 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
+    pLits[0] = Cec_ObjLitCond( p, pNodeI, 0 );
+    pLits[1] = Cec_ObjLitCond( p, pNodeE, 1^fCompE );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  0 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
+    pLits[0] = Cec_ObjLitCond( p, pNodeI, 0 );
+    pLits[1] = Cec_ObjLitCond( p, pNodeE, 0^fCompE );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  1 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
 
     // two additional clauses
     // t' & e' -> f'
@@ -139,87 +135,55 @@ void Cec_AddClausesMux( Cec_ManSat_t * p, Gia_Obj_t * pNode )
     // t  + e   + f'
     // t' + e'  + f 
 
-    if ( VarT == VarE )
+    if ( pNodeT == pNodeE )
     {
 //        assert( fCompT == !fCompE );
-        return;
+        return 4;
     }
 
-    pLits[0] = toLitCond(VarT, 0^fCompT);
-    pLits[1] = toLitCond(VarE, 0^fCompE);
-    pLits[2] = toLitCond(VarF, 1);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
-    pLits[0] = toLitCond(VarT, 1^fCompT);
-    pLits[1] = toLitCond(VarE, 1^fCompE);
-    pLits[2] = toLitCond(VarF, 0);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( Gia_Regular(pNodeT)->fPhase )  pLits[0] = lit_neg( pLits[0] );
-        if ( Gia_Regular(pNodeE)->fPhase )  pLits[1] = lit_neg( pLits[1] );
-        if ( pNode->fPhase )                pLits[2] = lit_neg( pLits[2] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 3 );
-    assert( RetValue );
+    pLits[0] = Cec_ObjLitCond( p, pNodeT, 0^fCompT );
+    pLits[1] = Cec_ObjLitCond( p, pNodeE, 0^fCompE );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  1 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
+    pLits[0] = Cec_ObjLitCond( p, pNodeT, 1^fCompT );
+    pLits[1] = Cec_ObjLitCond( p, pNodeE, 1^fCompE );
+    pLits[2] = Cec_ObjLitCond( p, pNode,  0 );
+    Cec_CnfPushClause( vCnf, pLits, 3 );
+    return 6;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Addes clauses to the solver.]
+  Synopsis    [Derives clauses of the supergate.]
 
-  Description []
+  Description [Clauses are added to vCnf in terms of object literals.
+  Returns the number of clauses added.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Cec_AddClausesSuper( Cec_ManSat_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper )
+int Cec_AddClausesSuper( Cec_ManSat_t * p, Gia_Obj_t * pNode, Vec_Ptr_t * vSuper, Vec_Int_t * vCnf )
 {
     Gia_Obj_t * pFanin;
-    int * pLits, nLits, RetValue, i;
+    int i, pLits[2];
     assert( !Gia_IsComplement(pNode) );
     assert( Gia_ObjIsAnd( pNode ) );
-    // create storage for literals
-    nLits = Vec_PtrSize(vSuper) + 1;
-    pLits = ABC_ALLOC( int, nLits );
     // suppose AND-gate is A & B = C
     // add !A => !C   or   A + !C
     Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
     {
-        pLits[0] = toLitCond(Cec_ObjSatNum(p,Gia_Regular(pFanin)), Gia_IsComplement(pFanin));
-        pLits[1] = toLitCond(Cec_ObjSatNum(p,pNode), 1);
-        if ( p->pPars->fPolarFlip )
-        {
-            if ( Gia_Regular(pFanin)->fPhase )  pLits[0] = lit_neg( pLits[0] );
-            if ( pNode->fPhase )                pLits[1] = lit_neg( pLits[1] );
-        }
-        RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 2 );
-        assert( RetValue );
+        pLits[0] = Cec_ObjLitCond( p, Gia_Regular(pFanin), Gia_IsComplement(pFanin) );
+        pLits[1] = Cec_ObjLitCond( p, pNode, 1 );
+        Cec_CnfPushClause( vCnf, pLits, 2 );
     }
     // add A & B => C   or   !A + !B + C
+    Vec_IntPush( vCnf, Vec_PtrSize(vSuper) + 1 );
     Vec_PtrForEachEntry( Gia_Obj_t *, vSuper, pFanin, i )
-    {
-        pLits[i] = toLitCond(Cec_ObjSatNum(p,Gia_Regular(pFanin)), !Gia_IsComplement(pFanin));
-        if ( p->pPars->fPolarFlip )
-        {
-            if ( Gia_Regular(pFanin)->fPhase )  pLits[i] = lit_neg( pLits[i] );
-        }
-    }
-    pLits[nLits-1] = toLitCond(Cec_ObjSatNum(p,pNode), 0);
-    if ( p->pPars->fPolarFlip )
-    {
-        if ( pNode->fPhase )  pLits[nLits-1] = lit_neg( pLits[nLits-1] );
-    }
-    RetValue = sat_solver_addclause( p->pSat, pLits, pLits + nLits );
-    assert( RetValue );
-    ABC_FREE( pLits );
+        Vec_IntPush( vCnf, Cec_ObjLitCond( p, Gia_Regular(pFanin), !Gia_IsComplement(pFanin) ) );
+    Vec_IntPush( vCnf, Cec_ObjLitCond( p, pNode, 0 ) );
+    return Vec_PtrSize(vSuper) + 1;
 }
 
 /**Function*************************************************************
@@ -267,6 +231,59 @@ void Cec_CollectSuper( Gia_Obj_t * pObj, int fUseMuxes, Vec_Ptr_t * vSuper )
     Cec_CollectSuper_rec( pObj, vSuper, 1, fUseMuxes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the cached CNF fragment of the node.]
+
+  Description [The fragment is computed once per node and kept for the
+  lifetime of the manager, so it survives recycling of the SAT solver.
+  It is stored in p->vCnfData starting from the returned offset as
+  follows: the number of fanins, the fanin IDs, the number of clauses,
+  and the clauses, each given by its size followed by object literals.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_CnfNodeFragment( Cec_ManSat_t * p, Gia_Obj_t * pNode )
+{
+    Gia_Obj_t * pFanin;
+    int k, iStart, iClaNum, nClauses, fUseMuxes = 1;
+    iStart = Vec_IntEntry( p->vCnfStart, Gia_ObjId(p->pAig, pNode) );
+    if ( iStart >= 0 )
+    {
+        p->nCnfHits++;
+        return iStart;
+    }
+    iStart = Vec_IntSize( p->vCnfData );
+    Vec_IntWriteEntry( p->vCnfStart, Gia_ObjId(p->pAig, pNode), iStart );
+    // collect the supergate
+    if ( fUseMuxes && Gia_ObjIsMuxType(pNode) )
+    {
+        Vec_PtrClear( p->vFanins );
+        Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin0(pNode) ) );
+        Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin1(pNode) ) );
+        Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin0(pNode) ) );
+        Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin1(pNode) ) );
+    }
+    else
+        Cec_CollectSuper( pNode, fUseMuxes, p->vFanins );
+    assert( Vec_PtrSize(p->vFanins) > 1 );
+    Vec_IntPush( p->vCnfData, Vec_PtrSize(p->vFanins) );
+    Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
+        Vec_IntPush( p->vCnfData, Gia_ObjId(p->pAig, Gia_Regular(pFanin)) );
+    // derive the clauses
+    iClaNum = Vec_IntSize( p->vCnfData );
+    Vec_IntPush( p->vCnfData, 0 );
+    if ( fUseMuxes && Gia_ObjIsMuxType(pNode) )
+        nClauses = Cec_AddClausesMux( p, pNode, p->vCnfData );
+    else
+        nClauses = Cec_AddClausesSuper( p, pNode, p->vFanins, p->vCnfData );
+    Vec_IntWriteEntry( p->vCnfData, iClaNum, nClauses );
+    return iStart;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Updates the solver clause database.]
@@ -296,7 +313,8 @@ void Cec_ObjAddToFrontier( Cec_ManSat_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFron
 
   Synopsis    [Updates the solver clause database.]
 
-  Description []
+  Description [Loads the cached CNF fragments of the nodes in the TFI
+  of pObj that are not yet in the solver.]
                
   SideEffects []
 
@@ -306,8 +324,8 @@ void Cec_ObjAddToFrontier( Cec_ManSat_t * p, Gia_Obj_t * pObj, Vec_Ptr_t * vFron
 void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
 { 
     Vec_Ptr_t * vFrontier;
-    Gia_Obj_t * pNode, * pFanin;
-    int i, k, fUseMuxes = 1;
+    Gia_Obj_t * pNode;
+    int i, k, c, nFanins, nClauses, nLits, RetValue, * pData, * pLits;
     // quit if CNF is ready
     if ( Cec_ObjSatNum(p,pObj) )
         return;
@@ -325,27 +343,24 @@ void Cec_CnfNodeAddToSolver( Cec_ManSat_t * p, Gia_Obj_t * pObj )
     // explore nodes in the frontier
     Vec_PtrForEachEntry( Gia_Obj_t *, vFrontier, pNode, i )
     {
-        // create the supergate
         assert( Cec_ObjSatNum(p,pNode) );
-        if ( fUseMuxes && Gia_ObjIsMuxType(pNode) )
-        {
-            Vec_PtrClear( p->vFanins );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin0(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin0( Gia_ObjFanin1(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin0(pNode) ) );
-            Vec_PtrPushUnique( p->vFanins, Gia_ObjFanin1( Gia_ObjFanin1(pNode) ) );
-            Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec_ObjAddToFrontier( p, Gia_Regular(pFanin), vFrontier );
-            Cec_AddClausesMux( p, pNode );
-        }
-        else
+        pData = Vec_IntEntryP( p->vCnfData, Cec_CnfNodeFragment(p, pNode) );
+        // add the fanins to the frontier
+        nFanins = *pData++;
+        for ( k = 0; k < nFanins; k++ )
+            Cec_ObjAddToFrontier( p, Gia_ManObj(p->pAig, *pData++), vFrontier );
+        // translate the clauses into SAT variables
+        nClauses = *pData++;
+        for ( c = 0; c < nClauses; c++ )
         {
-            Cec_CollectSuper( pNode, fUseMuxes, p->vFanins );
-            Vec_PtrForEachEntry( Gia_Obj_t *, p->vFanins, pFanin, k )
-                Cec_ObjAddToFrontier( p, Gia_Regular(pFanin), vFrontier );
-            Cec_AddClausesSuper( p, pNode, p->vFanins );
+            nLits = *pData++;
+            Vec_IntClear( p->vCnfLits );
+            for ( k = 0; k < nLits; k++, pData++ )
+                Vec_IntPush( p->vCnfLits, Abc_Var2Lit(p->pSatVars[Abc_Lit2Var(*pData)], Abc_LitIsCompl(*pData)) );
+            pLits = Vec_IntArray( p->vCnfLits );
+            RetValue = sat_solver_addclause( p->pSat, pLits, pLits + nLits );
+            assert( RetValue );
         }
-        assert( Vec_PtrSize(p->vFanins) > 1 );
     }
     Vec_PtrFree( vFrontier );
 }
@@ -522,8 +537,7 @@ clk = Abc_Clock();
     nConflicts = p->pSat->stats.conflicts;
 
 clk2 = Abc_Clock();
-    RetValue = sat_solver_solve( p->pSat, &Lit, &Lit + 1, 
-        (ABC_INT64_T)nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    RetValue = Bmc_PortSolve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)nBTLimit, (ABC_INT64_T)0 );
 //ABC_PRT( "sat", Abc_Clock() - clk2 );
 
     if ( RetValue == l_False )
@@ -626,8 +640,7 @@ clk = Abc_Clock();
     nConflicts = p->pSat->stats.conflicts;
 
 clk2 = Abc_Clock();
-    RetValue = sat_solver_solve( p->pSat, Lits, Lits + 2, 
-        (ABC_INT64_T)nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    RetValue = Bmc_PortSolve( p->pSat, Lits, Lits + 2, (ABC_INT64_T)nBTLimit, (ABC_INT64_T)0 );
 //ABC_PRT( "sat", Abc_Clock() - clk2 );
 
     if ( RetValue == l_False )
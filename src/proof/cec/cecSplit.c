@@ -24,6 +24,8 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/vec/vecHsh.h"
+#include "proof/cec/cec.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -47,6 +49,8 @@ ABC_NAMESPACE_IMPL_START
 #ifndef ABC_USE_PTHREADS
 
 int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaProvePartsPar( Vec_Ptr_t * vParts, int nProcs, int nConfLimit, int nDepthMax, int nTimeOut, int fVerbose, int * piFailed ) { *piFailed = -1; return -1; }
+int Cec_GiaCubeConquer( Gia_Man_t * p, int nProcs, int nConfLimit, int nTimeOut, int fVerbose ) { return -1; }
 
 #else // pthreads are used
 
@@ -219,8 +223,10 @@ int Gia_SplitCofVar2( Gia_Man_t * p, int * pnFanouts, int * pnCost )
         if ( CostBest < Gia_ObjRefNum(p, pObj) )
             iBest = i, CostBest = Gia_ObjRefNum(p, pObj);
     assert( iBest >= 0 );
-    *pnFanouts = Gia_ObjRefNum(p, Gia_ManPi(p, iBest));
-    *pnCost = -1;
+    if ( pnFanouts )
+        *pnFanouts = Gia_ObjRefNum(p, Gia_ManPi(p, iBest));
+    if ( pnCost )
+        *pnCost = -1;
     return iBest;
 }
 int Gia_SplitCofVar( Gia_Man_t * p, int LookAhead, int * pnFanouts, int * pnCost )
@@ -259,8 +265,10 @@ int Gia_SplitCofVar( Gia_Man_t * p, int LookAhead, int * pnFanouts, int * pnCost
     }
     ABC_FREE( pOrder );
     assert( iBest >= 0 );
-    *pnFanouts = Gia_ObjRefNum(p, Gia_ManPi(p, iBest));
-    *pnCost = CostBest;
+    if ( pnFanouts )
+        *pnFanouts = Gia_ObjRefNum(p, Gia_ManPi(p, iBest));
+    if ( pnCost )
+        *pnCost = CostBest;
     return iBest;
 }
 
@@ -768,6 +776,889 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Work-stealing solver for a set of partitioned miters.]
+
+  Description [Each job is first reduced by SAT sweeping and then solved
+  with a conflict limit. Each worker owns a deque of jobs. The owner pops the most
+  recently pushed job (typically a cofactor it has just created), while
+  idle workers steal the oldest job from other deques. A job that exceeds
+  the conflict limit is cofactored using Gia_SplitCofVar() and both halves
+  are pushed on the owner's deque, where they can be stolen by others.
+  Idle workers sleep on a condition variable until a job is pushed or the
+  last job is finished. The first SAT job raises the stop flag of the
+  manager, which is polled by all solvers. Its counter-example is completed
+  with the cofactored values and checked on the original part.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_ParJob_t_ Cec_ParJob_t;
+struct Cec_ParJob_t_
+{
+    Gia_Man_t *       p;          // cofactored part (owns vCofVars)
+    int               iPart;      // the index of the original part
+    int               Depth;      // the number of cofactored variables
+};
+typedef struct Cec_ParMan_t_ Cec_ParMan_t;
+typedef struct Cec_ParWrk_t_ Cec_ParWrk_t;
+struct Cec_ParWrk_t_
+{
+    Cec_ParMan_t *    pMan;       // shared manager
+    Vec_Ptr_t *       vDeque;     // jobs owned by this worker
+    pthread_mutex_t   Mutex;      // protects the deque
+    int               iThread;    // thread ID
+    int               nSolved;    // jobs solved
+    int               nStolen;    // jobs stolen from others
+    int               nSplits;    // jobs cofactored
+};
+struct Cec_ParMan_t_
+{
+    Cec_ParWrk_t *    pWrks;      // workers
+    int               nWrks;      // the number of workers
+    int               nConfLimit; // conflict limit before splitting
+    int               nDepthMax;  // max cofactoring depth
+    int               LookAhead;  // lookahead for choosing the split variable
+    abctime           TimeStop;   // global wall-clock deadline (0 if none)
+    pthread_mutex_t   Mutex;      // protects the fields below and CNF derivation
+    pthread_cond_t    Cond;       // signals new jobs and termination
+    volatile int      fStop;      // stop flag polled by the solvers
+    int               nJobsLeft;  // jobs pushed but not finished
+    int               nPushes;    // the number of jobs pushed so far
+    int               fUndec;     // some job remained undecided
+    int               iFailed;    // the index of the SAT part
+    Abc_Cex_t *       pCex;       // counter-example for the SAT part
+    Vec_Ptr_t *       vParts;     // original parts
+};
+static inline void Cec_GiaParPush( Cec_ParWrk_t * pWrk, Gia_Man_t * p, int iPart, int Depth )
+{
+    Cec_ParJob_t * pJob = ABC_CALLOC( Cec_ParJob_t, 1 );
+    pJob->p = p; pJob->iPart = iPart; pJob->Depth = Depth;
+    pthread_mutex_lock( &pWrk->Mutex );
+    Vec_PtrPush( pWrk->vDeque, pJob );
+    pthread_mutex_unlock( &pWrk->Mutex );
+    pthread_mutex_lock( &pWrk->pMan->Mutex );
+    pWrk->pMan->nJobsLeft++;
+    pWrk->pMan->nPushes++;
+    pthread_cond_broadcast( &pWrk->pMan->Cond );
+    pthread_mutex_unlock( &pWrk->pMan->Mutex );
+}
+static inline Cec_ParJob_t * Cec_GiaParPop( Cec_ParWrk_t * pWrk )
+{
+    Cec_ParJob_t * pJob = NULL;
+    pthread_mutex_lock( &pWrk->Mutex );
+    if ( Vec_PtrSize(pWrk->vDeque) > 0 )
+        pJob = (Cec_ParJob_t *)Vec_PtrPop( pWrk->vDeque );
+    pthread_mutex_unlock( &pWrk->Mutex );
+    return pJob;
+}
+static inline Cec_ParJob_t * Cec_GiaParSteal( Cec_ParWrk_t * pWrk )
+{
+    Cec_ParMan_t * p = pWrk->pMan;
+    Cec_ParJob_t * pJob = NULL;
+    int i, k;
+    for ( k = 1; k < p->nWrks && pJob == NULL; k++ )
+    {
+        Cec_ParWrk_t * pVictim = p->pWrks + (pWrk->iThread + k) % p->nWrks;
+        pthread_mutex_lock( &pVictim->Mutex );
+        if ( Vec_PtrSize(pVictim->vDeque) > 0 )
+        {
+            pJob = (Cec_ParJob_t *)Vec_PtrEntry( pVictim->vDeque, 0 );
+            for ( i = 1; i < Vec_PtrSize(pVictim->vDeque); i++ )
+                Vec_PtrWriteEntry( pVictim->vDeque, i-1, Vec_PtrEntry(pVictim->vDeque, i) );
+            Vec_PtrShrink( pVictim->vDeque, Vec_PtrSize(pVictim->vDeque)-1 );
+        }
+        pthread_mutex_unlock( &pVictim->Mutex );
+    }
+    if ( pJob )
+        pWrk->nStolen++;
+    return pJob;
+}
+static inline void Cec_GiaParJobFree( Cec_ParJob_t * pJob )
+{
+    if ( pJob->p )
+        Gia_ManStop( pJob->p );
+    ABC_FREE( pJob );
+}
+static inline void Cec_GiaParStop( Cec_ParMan_t * p )
+{
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+}
+// completes the counter-example of the cofactored part and checks it on the original part
+static Abc_Cex_t * Cec_GiaParDeriveCex( Cec_ParMan_t * p, Cec_ParJob_t * pJob, Abc_Cex_t * pCexPart )
+{
+    Gia_Man_t * pPart = (Gia_Man_t *)Vec_PtrEntry( p->vParts, pJob->iPart );
+    Abc_Cex_t * pCex;
+    int i, iLit, iPo, * pModel;
+    if ( pCexPart == NULL || pCexPart->nPis != Gia_ManPiNum(pPart) )
+        return NULL;
+    pModel = ABC_CALLOC( int, Gia_ManPiNum(pPart) );
+    for ( i = 0; i < Gia_ManPiNum(pPart); i++ )
+        pModel[i] = Abc_InfoHasBit( pCexPart->pData, pCexPart->nRegs + i );
+    if ( pJob->p->vCofVars )
+        Vec_IntForEachEntry( pJob->p->vCofVars, iLit, i )
+            pModel[Abc_Lit2Var(iLit)] = !Abc_LitIsCompl(iLit);
+    pCex = Abc_CexCreate( 0, Gia_ManPiNum(pPart), pModel, 0, 0, 0 );
+    ABC_FREE( pModel );
+    // the original parts are shared, so simulation (using fMark0) is serialized
+    pthread_mutex_lock( &p->Mutex );
+    iPo = Gia_ManFindFailedPoCex( pPart, pCex, 0 );
+    pthread_mutex_unlock( &p->Mutex );
+    if ( iPo == -1 )
+    {
+        Abc_CexFree( pCex );
+        return NULL;
+    }
+    pCex->iPo = iPo;
+    return pCex;
+}
+static int Cec_GiaParSolveJob( Cec_ParWrk_t * pWrk, Cec_ParJob_t * pJob, int nConfLimit )
+{
+    Cec_ParMan_t * p = pWrk->pMan;
+    Cec_ParFra_t ParsFra, * pParsFra = &ParsFra;
+    Gia_Man_t * pNew;
+    Cnf_Dat_t * pCnf;
+    sat_solver * pSat;
+    int i, status;
+    // reduce the miter by SAT sweeping
+    Cec_ManFraSetDefaultParams( pParsFra );
+    pParsFra->nBTLimit    = 1000;
+    pParsFra->fCheckMiter = 1;
+    pNew = Cec_ManSatSweeping( pJob->p, pParsFra, 1 );
+    if ( pNew == NULL )
+    {
+        Abc_Cex_t * pCex = Cec_GiaParDeriveCex( p, pJob, pJob->p->pCexComb );
+        Abc_CexFreeP( &pJob->p->pCexComb );
+        pJob->p->pCexComb = pCex;
+        return pCex ? 0 : -1;
+    }
+    for ( i = 0; i < Gia_ManPoNum(pNew); i++ )
+        if ( !Gia_ManPoIsConst0(pNew, i) )
+            break;
+    if ( i == Gia_ManPoNum(pNew) )
+    {
+        Gia_ManStop( pNew );
+        return 1;
+    }
+    // continue with the reduced miter
+    pNew->vCofVars = pJob->p->vCofVars; pJob->p->vCofVars = NULL;
+    Gia_ManStop( pJob->p );
+    pJob->p = pNew;
+    // CNF derivation uses a global manager
+    pthread_mutex_lock( &p->Mutex );
+    pCnf = Cec_GiaDeriveGiaRemapped( pJob->p );
+    pthread_mutex_unlock( &p->Mutex );
+    pSat = Cec_GiaDeriveSolver( pJob->p, pCnf, 0 );
+    if ( pSat == NULL )
+    {
+        Cnf_DataFree( pCnf );
+        return 1;
+    }
+    // the solver measures the CPU time of this thread
+    if ( p->TimeStop )
+        sat_solver_set_runtime_limit( pSat, Abc_Clock() + Abc_MaxInt(1, (int)(p->TimeStop - Abc_ClockWall())) );
+    sat_solver_set_runid( pSat, pWrk->iThread );
+    sat_solver_set_stop_flag( pSat, &p->fStop );
+    status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    if ( status == l_True )
+    {
+        Abc_Cex_t * pCexPart = Cec_SplitDeriveModel( pJob->p, pCnf, pSat );
+        pJob->p->pCexComb = Cec_GiaParDeriveCex( p, pJob, pCexPart );
+        Abc_CexFree( pCexPart );
+        if ( pJob->p->pCexComb == NULL )
+            status = l_Undef;
+    }
+    sat_solver_delete( pSat );
+    Cnf_DataFree( pCnf );
+    if ( status == l_Undef )
+        return -1;
+    return status == l_False;
+}
+static void Cec_GiaParSplitJob( Cec_ParWrk_t * pWrk, Cec_ParJob_t * pJob )
+{
+    Gia_Man_t * pLast = pJob->p, * pPart;
+    int iVar, Value;
+    if ( pLast->vCofVars == NULL )
+        pLast->vCofVars = Vec_IntAlloc( 100 );
+    iVar = Gia_SplitCofVar( pLast, pWrk->pMan->LookAhead, NULL, NULL );
+    for ( Value = 0; Value < 2; Value++ )
+    {
+        pPart = Gia_ManDupCofactorVar( pLast, iVar, Value );
+        pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+        Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+        Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, !Value) );
+        Cec_GiaParPush( pWrk, pPart, pJob->iPart, pJob->Depth + 1 );
+    }
+    pWrk->nSplits++;
+}
+void * Cec_GiaParWorkerThread( void * pArg )
+{
+    Cec_ParWrk_t * pWrk = (Cec_ParWrk_t *)pArg;
+    Cec_ParMan_t * p = pWrk->pMan;
+    Cec_ParJob_t * pJob;
+    int Result, nPushes, fDone, fCanSplit;
+    while ( 1 )
+    {
+        if ( p->fStop )
+            break;
+        if ( p->TimeStop && Abc_ClockWall() > p->TimeStop )
+        {
+            Cec_GiaParStop( p );
+            break;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        nPushes = p->nPushes;
+        pthread_mutex_unlock( &p->Mutex );
+        pJob = Cec_GiaParPop( pWrk );
+        if ( pJob == NULL )
+            pJob = Cec_GiaParSteal( pWrk );
+        if ( pJob == NULL )
+        {
+            // sleep until a job is pushed, all jobs are finished, or the run is stopped
+            pthread_mutex_lock( &p->Mutex );
+            while ( !p->fStop && p->nJobsLeft > 0 && p->nPushes == nPushes )
+                pthread_cond_wait( &p->Cond, &p->Mutex );
+            fDone = (p->fStop || p->nJobsLeft == 0);
+            pthread_mutex_unlock( &p->Mutex );
+            if ( fDone )
+                break;
+            continue;
+        }
+        fCanSplit = p->nConfLimit && pJob->Depth < p->nDepthMax && Gia_ManPiNum(pJob->p) > 0;
+        Result = Cec_GiaParSolveJob( pWrk, pJob, fCanSplit ? p->nConfLimit : 0 );
+        pWrk->nSolved++;
+        if ( Result == -1 && fCanSplit && !p->fStop )
+            Cec_GiaParSplitJob( pWrk, pJob );
+        pthread_mutex_lock( &p->Mutex );
+        if ( Result == 0 && p->pCex == NULL )
+        {
+            // report the first counter-example and cancel the others
+            p->pCex = pJob->p->pCexComb; pJob->p->pCexComb = NULL;
+            p->iFailed = pJob->iPart;
+            p->fStop = 1;
+        }
+        if ( Result == -1 && (!fCanSplit || p->fStop) )
+            p->fUndec = 1;
+        p->nJobsLeft--;
+        if ( p->fStop || p->nJobsLeft == 0 )
+            pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        Cec_GiaParJobFree( pJob );
+    }
+    return NULL;
+}
+int Cec_GiaProvePartsPar( Vec_Ptr_t * vParts, int nProcs, int nConfLimit, int nDepthMax, int nTimeOut, int fVerbose, int * piFailed )
+{
+    abctime clkTotal = Abc_ClockWall();
+    Cec_ParMan_t Man, * p = &Man;
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Gia_Man_t * pPart;
+    int i, status, RetValue, nSolved = 0, nStolen = 0, nSplits = 0;
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    *piFailed = -1;
+    memset( p, 0, sizeof(Cec_ParMan_t) );
+    p->nWrks      = Abc_MinInt( nProcs, Abc_MaxInt(1, Vec_PtrSize(vParts)) );
+    p->nConfLimit = nConfLimit;
+    p->nDepthMax  = nDepthMax;
+    p->LookAhead  = 1;
+    p->TimeStop   = nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_ClockWall() : 0;
+    p->iFailed    = -1;
+    p->vParts     = vParts;
+    p->pWrks      = ABC_CALLOC( Cec_ParWrk_t, p->nWrks );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );    assert( status == 0 );
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        p->pWrks[i].pMan    = p;
+        p->pWrks[i].vDeque  = Vec_PtrAlloc( 100 );
+        p->pWrks[i].iThread = i;
+        status = pthread_mutex_init( &p->pWrks[i].Mutex, NULL );  assert( status == 0 );
+    }
+    // distribute the parts round-robin; the cofactoring info is kept in copies
+    Vec_PtrForEachEntry( Gia_Man_t *, vParts, pPart, i )
+        Cec_GiaParPush( p->pWrks + i % p->nWrks, Gia_ManDup(pPart), i, 0 );
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaParWorkerThread, (void *)(p->pWrks + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    // collect the results
+    if ( p->pCex )
+    {
+        pPart = (Gia_Man_t *)Vec_PtrEntry( vParts, p->iFailed );
+        Abc_CexFreeP( &pPart->pCexComb );
+        pPart->pCexComb = p->pCex;
+        *piFailed = p->iFailed;
+        RetValue = 0;
+    }
+    else 
+        RetValue = (p->fUndec || p->nJobsLeft > 0) ? -1 : 1;
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        Cec_ParJob_t * pJob;
+        int k;
+        Vec_PtrForEachEntry( Cec_ParJob_t *, p->pWrks[i].vDeque, pJob, k )
+            Cec_GiaParJobFree( pJob );
+        Vec_PtrFree( p->pWrks[i].vDeque );
+        pthread_mutex_destroy( &p->pWrks[i].Mutex );
+        nSolved += p->pWrks[i].nSolved;
+        nStolen += p->pWrks[i].nStolen;
+        nSplits += p->pWrks[i].nSplits;
+    }
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p->pWrks );
+    if ( fVerbose )
+    {
+        printf( "Parts = %d. Threads = %d. Jobs solved = %d. Stolen = %d. Split = %d.  ", 
+            Vec_PtrSize(vParts), p->nWrks, nSolved, nStolen, nSplits );
+        Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer solver for combinational miters.]
+
+  Description [All workers load the same CNF of the miter, in which at
+  least one output should be 1. The search space is partitioned into cubes 
+  over the primary inputs, which are solved as assumptions. The cubes are 
+  produced by lookahead: the candidate inputs with the largest fanout are 
+  propagated in both polarities and the input maximizing the product of 
+  implication counts is selected. Failed literals found by lookahead are 
+  added to the cube. The initial cubes are generated before the workers 
+  start; afterwards, a cube that exceeds the conflict limit is split again 
+  by its worker and the two children are returned to the shared queue. 
+  After each call, the workers publish their top-level units and learned 
+  binary clauses, which are imported by other workers before their next call.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_CncJob_t_ Cec_CncJob_t;
+struct Cec_CncJob_t_
+{
+    Vec_Int_t *       vCube;      // assumptions in terms of SAT variables
+    int               Depth;      // the number of splits
+};
+typedef struct Cec_CncMan_t_ Cec_CncMan_t;
+typedef struct Cec_CncWrk_t_ Cec_CncWrk_t;
+struct Cec_CncWrk_t_
+{
+    Cec_CncMan_t *    pMan;       // shared manager
+    sat_solver *      pSat;       // the solver of this worker
+    int               iThread;    // thread ID
+    int               iUnitsIn;   // shared units imported
+    int               iBinsIn;    // shared binary clauses imported
+    int               nUnitsOut;  // top-level units exported
+    int               iPageOut;   // the learned clause page exported so far
+    int               iLimitOut;  // the limit of this page exported so far
+    int               nCompacts;  // the number of learned clause compactions seen
+    int               nSolved;    // cubes solved
+    int               nSplits;    // cubes split
+    abctime           clkTotal;   // runtime of this worker
+};
+struct Cec_CncMan_t_
+{
+    Gia_Man_t *       p;          // the miter
+    Cnf_Dat_t *       pCnf;       // the CNF of the miter
+    Cec_CncWrk_t *    pWrks;      // workers
+    int               nWrks;      // the number of workers
+    int               nConfLimit; // conflict limit before splitting
+    int               nDepthMax;  // max number of splits
+    int               LookAhead;  // the number of lookahead candidates
+    abctime           TimeStop;   // wall-clock deadline (0 if none)
+    Vec_Int_t *       vOuts;      // output literals
+    Vec_Int_t *       vCands;     // lookahead candidates (SAT variables)
+    pthread_mutex_t   Mutex;      // protects the fields below
+    pthread_cond_t    Cond;       // signals new cubes or the end of work
+    volatile int      fStop;      // stop flag polled by the solvers
+    Vec_Ptr_t *       vQueue;     // cubes to be solved
+    int               nJobsLeft;  // cubes pushed but not finished
+    int               nRefuted;   // cubes refuted by lookahead
+    int               fUndec;     // some cube remained undecided
+    int               fProved;    // the shared clauses are contradictory
+    Abc_Cex_t *       pCex;       // counter-example
+    Vec_Int_t *       vUnits;     // shared units
+    Vec_Str_t *       vUnitSeen;  // literals already in the shared units
+    Vec_Int_t *       vBins;      // shared binary clauses (pairs of literals)
+    Hsh_IntMan_t *    pBinHash;   // hash table for the binary clauses
+};
+static inline void Cec_GiaCncPush( Cec_CncMan_t * p, Vec_Int_t * vCube, int Depth )
+{
+    Cec_CncJob_t * pJob = ABC_CALLOC( Cec_CncJob_t, 1 );
+    pJob->vCube = vCube; pJob->Depth = Depth;
+    pthread_mutex_lock( &p->Mutex );
+    Vec_PtrPush( p->vQueue, pJob );
+    p->nJobsLeft++;
+    pthread_cond_signal( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+}
+static inline Cec_CncJob_t * Cec_GiaCncPop( Cec_CncMan_t * p )
+{
+    Cec_CncJob_t * pJob = NULL;
+    pthread_mutex_lock( &p->Mutex );
+    // idle workers wait until a cube is split or all cubes are finished
+    while ( Vec_PtrSize(p->vQueue) == 0 && p->nJobsLeft > 0 && !p->fStop )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+    if ( Vec_PtrSize(p->vQueue) > 0 && !p->fStop )
+        pJob = (Cec_CncJob_t *)Vec_PtrPop( p->vQueue );
+    pthread_mutex_unlock( &p->Mutex );
+    return pJob;
+}
+static inline void Cec_GiaCncStop( Cec_CncMan_t * p )
+{
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+}
+static inline void Cec_GiaCncJobFree( Cec_CncJob_t * pJob )
+{
+    Vec_IntFree( pJob->vCube );
+    ABC_FREE( pJob );
+}
+static Cnf_Dat_t * Cec_GiaCncDeriveCnf( Gia_Man_t * p, Vec_Int_t * vOuts )
+{
+    Cnf_Dat_t * pCnf;
+    Aig_Obj_t * pObj;
+    Aig_Man_t * pAig = Gia_ManToAigSimple( p );
+    int i;
+    pAig->nRegs = 0;
+    // the outputs are not asserted in this CNF
+    pCnf = Cnf_Derive( pAig, Aig_ManCoNum(pAig) );
+    Aig_ManForEachCo( pAig, pObj, i )
+        Vec_IntPush( vOuts, toLit(pCnf->pVarNums[pObj->Id]) );
+    Aig_ManStop( pAig );
+    return pCnf;
+}
+static Vec_Int_t * Cec_GiaCncCands( Gia_Man_t * p, Cnf_Dat_t * pCnf, int LookAhead )
+{
+    Vec_Int_t * vCands = Vec_IntAlloc( LookAhead );
+    int * pOrder = Gia_PermuteSpecialOrder( p ), i;
+    for ( i = 0; i < Abc_MinInt(LookAhead, Gia_ManPiNum(p)); i++ )
+        Vec_IntPush( vCands, pCnf->pVarNums[Gia_ObjId(p, Gia_ManPi(p, pOrder[i]))] );
+    ABC_FREE( pOrder );
+    return vCands;
+}
+static sat_solver * Cec_GiaCncDeriveSolver( Cec_CncMan_t * p )
+{
+    sat_solver * pSat = Cec_GiaDeriveSolver( p->p, p->pCnf, 0 );
+    if ( pSat == NULL )
+        return NULL;
+    // at least one of the outputs is 1
+    if ( Vec_IntSize(p->vOuts) == 0 || !sat_solver_addclause( pSat, Vec_IntArray(p->vOuts), Vec_IntLimit(p->vOuts) ) )
+    {
+        sat_solver_delete( pSat );
+        return NULL;
+    }
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extends the cube using lookahead.]
+
+  Description [Returns 1 if the cube is refuted. Otherwise, adds failed 
+  literals to the cube and returns the best variable for splitting, 
+  or -1 if all candidates are assigned. The splitting procedure returns 
+  1 if the cube is refuted or split, and 0 if it cannot be split.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_GiaCncLookahead( sat_solver * pSat, Vec_Int_t * vCube, Vec_Int_t * vCands, int * piVarBest )
+{
+    int i, Lit, iVar, nPushed = 0, n0, n1, RetValue = 0;
+    word Score, ScoreBest = 0;
+    *piVarBest = -1;
+    Vec_IntForEachEntry( vCube, Lit, i )
+    {
+        nPushed++;
+        if ( !sat_solver_push(pSat, Lit) )
+        {
+            RetValue = 1;
+            goto finish;
+        }
+    }
+    Vec_IntForEachEntry( vCands, iVar, i )
+    {
+        n1 = sat_solver_lookahead( pSat, toLit(iVar) );
+        n0 = sat_solver_lookahead( pSat, lit_neg(toLit(iVar)) );
+        if ( n0 == 0 || n1 == 0 ) // assigned
+            continue;
+        if ( n0 == -1 && n1 == -1 )
+        {
+            RetValue = 1;
+            goto finish;
+        }
+        if ( n0 == -1 || n1 == -1 ) // failed literal
+        {
+            Lit = n1 == -1 ? lit_neg(toLit(iVar)) : toLit(iVar);
+            Vec_IntPush( vCube, Lit );
+            nPushed++;
+            if ( !sat_solver_push(pSat, Lit) )
+            {
+                RetValue = 1;
+                goto finish;
+            }
+            continue;
+        }
+        Score = (word)n0 * (word)n1;
+        if ( ScoreBest < Score )
+            ScoreBest = Score, *piVarBest = iVar;
+    }
+    // the best candidate may have been assigned by a failed literal found later
+    if ( *piVarBest >= 0 && sat_solver_lookahead(pSat, toLit(*piVarBest)) <= 0 )
+        *piVarBest = -1;
+finish:
+    for ( i = 0; i < nPushed; i++ )
+        sat_solver_pop( pSat );
+    return RetValue;
+}
+static int Cec_GiaCncSplit( Cec_CncMan_t * p, sat_solver * pSat, Cec_CncJob_t * pJob, Vec_Ptr_t * vChildren )
+{
+    Vec_Int_t * vCube;
+    int iVar, Value;
+    if ( Cec_GiaCncLookahead( pSat, pJob->vCube, p->vCands, &iVar ) )
+        return 1;
+    if ( iVar == -1 )
+        return 0;
+    for ( Value = 0; Value < 2; Value++ )
+    {
+        vCube = Vec_IntDup( pJob->vCube );
+        Vec_IntPush( vCube, toLitCond(iVar, !Value) );
+        Vec_PtrPush( vChildren, vCube );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges top-level units and learned binary clauses.]
+
+  Description [Returns 0 if the solver became UNSAT after importing.
+  Learned clauses are appended to the memory of the solver, so export 
+  scans only the clauses added after the previous export, unless the 
+  learned clause memory was compacted since then.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cec_GiaCncExport( Cec_CncWrk_t * pWrk )
+{
+    Cec_CncMan_t * p = pWrk->pMan;
+    sat_solver * pSat = pWrk->pSat;
+    Sat_Mem_t * pMem = &pSat->Mem;
+    clause * c;
+    int i, k, Lit0, Lit1, nBins;
+    if ( pWrk->nCompacts != pSat->nDBreduces + pSat->nInproRounds )
+    {
+        pWrk->nCompacts = pSat->nDBreduces + pSat->nInproRounds;
+        pWrk->iPageOut  = 1;
+        pWrk->iLimitOut = 2;
+    }
+    pthread_mutex_lock( &p->Mutex );
+    for ( i = pWrk->nUnitsOut; i < pSat->qtail; i++ )
+        if ( !Vec_StrEntry(p->vUnitSeen, pSat->trail[i]) )
+        {
+            Vec_StrWriteEntry( p->vUnitSeen, pSat->trail[i], 1 );
+            Vec_IntPush( p->vUnits, pSat->trail[i] );
+        }
+    pWrk->nUnitsOut = pSat->qtail;
+    for ( i = pWrk->iPageOut; i <= pMem->iPage[1]; i += 2 )
+    for ( k = (i == pWrk->iPageOut ? pWrk->iLimitOut : 2); k < Sat_MemLimit(pMem->pPages[i]); k += Sat_MemClauseSize(c) )
+    {
+        c = Sat_MemClause( pMem, i, k );
+        if ( c->size != 2 )
+            continue;
+        Lit0 = Abc_MinInt( c->lits[0], c->lits[1] );
+        Lit1 = Abc_MaxInt( c->lits[0], c->lits[1] );
+        nBins = Vec_IntSize(p->vBins) / 2;
+        Vec_IntPushTwo( p->vBins, Lit0, Lit1 );
+        if ( Hsh_IntManAdd(p->pBinHash, nBins) < nBins )
+            Vec_IntShrink( p->vBins, 2 * nBins );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    pWrk->iPageOut  = pMem->iPage[1];
+    pWrk->iLimitOut = Sat_MemLimit( pMem->pPages[pMem->iPage[1]] );
+    return 1;
+}
+static int Cec_GiaCncImport( Cec_CncWrk_t * pWrk )
+{
+    Cec_CncMan_t * p = pWrk->pMan;
+    int Lits[2], RetValue = 1;
+    pthread_mutex_lock( &p->Mutex );
+    for ( ; RetValue && pWrk->iUnitsIn < Vec_IntSize(p->vUnits); pWrk->iUnitsIn++ )
+    {
+        Lits[0] = Vec_IntEntry( p->vUnits, pWrk->iUnitsIn );
+        RetValue = sat_solver_addclause( pWrk->pSat, Lits, Lits + 1 );
+    }
+    for ( ; RetValue && 2 * pWrk->iBinsIn < Vec_IntSize(p->vBins); pWrk->iBinsIn++ )
+    {
+        Lits[0] = Vec_IntEntry( p->vBins, 2 * pWrk->iBinsIn + 0 );
+        Lits[1] = Vec_IntEntry( p->vBins, 2 * pWrk->iBinsIn + 1 );
+        RetValue = sat_solver_addclause( pWrk->pSat, Lits, Lits + 2 );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread of the cube-and-conquer solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Cec_GiaCncDeriveCex( Cec_CncMan_t * p, sat_solver * pSat )
+{
+    Abc_Cex_t * pCex;
+    Gia_Obj_t * pObj;
+    int i;
+    pCex = Abc_CexAlloc( 0, Gia_ManPiNum(p->p), 1 );
+    Gia_ManForEachPi( p->p, pObj, i )
+        if ( sat_solver_var_value(pSat, p->pCnf->pVarNums[Gia_ObjId(p->p, pObj)]) )
+            Abc_InfoSetBit( pCex->pData, i );
+    pCex->iPo = Gia_ManFindFailedPoCex( p->p, pCex, 0 );
+    return pCex;
+}
+void * Cec_GiaCncWorkerThread( void * pArg )
+{
+    Cec_CncWrk_t * pWrk = (Cec_CncWrk_t *)pArg;
+    Cec_CncMan_t * p = pWrk->pMan;
+    Vec_Ptr_t * vChildren = Vec_PtrAlloc( 2 );
+    Cec_CncJob_t * pJob;
+    Vec_Int_t * vCube;
+    abctime clk = Abc_Clock();
+    int i, status, fCanSplit, fDone;
+    sat_solver_set_runid( pWrk->pSat, pWrk->iThread );
+    sat_solver_set_stop_flag( pWrk->pSat, &p->fStop );
+    while ( 1 )
+    {
+        if ( p->TimeStop && Abc_ClockWall() > p->TimeStop )
+            Cec_GiaCncStop( p );
+        pJob = Cec_GiaCncPop( p );
+        if ( pJob == NULL )
+            break;
+        if ( !Cec_GiaCncImport(pWrk) )
+        {
+            // the shared clauses are contradictory
+            pthread_mutex_lock( &p->Mutex );
+            p->fProved = 1;
+            p->nJobsLeft--;
+            pthread_mutex_unlock( &p->Mutex );
+            Cec_GiaCncJobFree( pJob );
+            Cec_GiaCncStop( p );
+            break;
+        }
+        fCanSplit = pJob->Depth < p->nDepthMax;
+        // the solver measures the CPU time of this thread
+        if ( p->TimeStop )
+            sat_solver_set_runtime_limit( pWrk->pSat, Abc_Clock() + Abc_MaxInt(1, (int)(p->TimeStop - Abc_ClockWall())) );
+        status = sat_solver_solve( pWrk->pSat, Vec_IntArray(pJob->vCube), Vec_IntLimit(pJob->vCube), 
+            (ABC_INT64_T)(fCanSplit ? p->nConfLimit : 0), (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+        pWrk->nSolved++;
+        fDone = 0;
+        if ( status == l_Undef && fCanSplit && !p->fStop )
+        {
+            Vec_PtrClear( vChildren );
+            fDone = Cec_GiaCncSplit( p, pWrk->pSat, pJob, vChildren );
+            Vec_PtrForEachEntry( Vec_Int_t *, vChildren, vCube, i )
+                Cec_GiaCncPush( p, vCube, pJob->Depth + 1 );
+            if ( Vec_PtrSize(vChildren) )
+                pWrk->nSplits++;
+            else if ( fDone ) // refuted by lookahead
+            {
+                pthread_mutex_lock( &p->Mutex );
+                p->nRefuted++;
+                pthread_mutex_unlock( &p->Mutex );
+            }
+            else 
+            {
+                // no variable to split on; solve this cube without the limit
+                Cec_GiaCncPush( p, Vec_IntDup(pJob->vCube), p->nDepthMax );
+                fDone = 1;
+            }
+        }
+        if ( status != l_True )
+            Cec_GiaCncExport( pWrk );
+        pthread_mutex_lock( &p->Mutex );
+        if ( status == l_True && p->pCex == NULL )
+        {
+            // report the first counter-example and cancel the others
+            p->pCex = Cec_GiaCncDeriveCex( p, pWrk->pSat );
+            p->fStop = 1;
+        }
+        if ( status == l_Undef && !fDone )
+            p->fUndec = 1;
+        if ( --p->nJobsLeft == 0 || p->fStop )
+            pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        Cec_GiaCncJobFree( pJob );
+    }
+    Vec_PtrFree( vChildren );
+    pWrk->clkTotal = Abc_Clock() - clk;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the miter using cube-and-conquer.]
+
+  Description [Returns 1 if all outputs are constant 0 (UNSAT), 0 if 
+  a counter-example is found and saved in p->pCexComb, and -1 if the 
+  problem is undecided. The conflict limit is used for each cube before 
+  it is split again; cubes are not split beyond the given depth.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaCubeConquer( Gia_Man_t * pGia, int nProcs, int nConfLimit, int nTimeOut, int fVerbose )
+{
+    abctime clkTotal = Abc_Clock(), clkLook, clkWrk = 0;
+    Cec_CncMan_t Man, * p = &Man;
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Vec_Ptr_t * vFront, * vChildren;
+    Cec_CncJob_t * pJob;
+    Vec_Int_t * vCube;
+    int i, k, status, RetValue, fStarted, nSolved = 0, nSplits = 0, nInitial = 0;
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    Abc_CexFreeP( &pGia->pCexComb );
+    memset( p, 0, sizeof(Cec_CncMan_t) );
+    p->p          = pGia;
+    p->nWrks      = nProcs;
+    p->nConfLimit = nConfLimit ? nConfLimit : 10000;
+    p->nDepthMax  = 24;
+    p->LookAhead  = 64;
+    p->vOuts      = Vec_IntAlloc( Gia_ManPoNum(pGia) );
+    p->pCnf       = Cec_GiaCncDeriveCnf( pGia, p->vOuts );
+    p->vCands     = Cec_GiaCncCands( pGia, p->pCnf, p->LookAhead );
+    p->vQueue     = Vec_PtrAlloc( 100 );
+    p->vUnits     = Vec_IntAlloc( 100 );
+    p->vUnitSeen  = Vec_StrStart( 2 * p->pCnf->nVars );
+    p->vBins      = Vec_IntAlloc( 1000 );
+    p->pBinHash   = Hsh_IntManStart( p->vBins, 2, 1000 );
+    p->pWrks      = ABC_CALLOC( Cec_CncWrk_t, p->nWrks );
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->Cond, NULL );  assert( status == 0 );
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        p->pWrks[i].pMan    = p;
+        p->pWrks[i].iThread = i;
+        p->pWrks[i].iPageOut  = 1;
+        p->pWrks[i].iLimitOut = 2;
+        p->pWrks[i].pSat    = Cec_GiaCncDeriveSolver( p );
+        if ( p->pWrks[i].pSat == NULL )
+            p->fProved = 1;
+    }
+    // generate the initial cubes by lookahead in the first solver
+    clkLook = Abc_Clock();
+    vFront    = Vec_PtrAlloc( 100 );
+    vChildren = Vec_PtrAlloc( 100 );
+    if ( !p->fProved )
+        Vec_PtrPush( vFront, Vec_IntAlloc(0) );
+    while ( Vec_PtrSize(vFront) > 0 && Vec_PtrSize(vFront) < 4 * p->nWrks && nInitial < p->nDepthMax / 2 )
+    {
+        Cec_CncJob_t Job;
+        Vec_PtrClear( vChildren );
+        Vec_PtrForEachEntry( Vec_Int_t *, vFront, vCube, i )
+        {
+            Job.vCube = vCube; Job.Depth = nInitial;
+            k = Vec_PtrSize(vChildren);
+            if ( !Cec_GiaCncSplit(p, p->pWrks[0].pSat, &Job, vChildren) )
+                Vec_PtrPush( vChildren, Vec_IntDup(vCube) );
+            else if ( k == Vec_PtrSize(vChildren) )
+                p->nRefuted++;
+            Vec_IntFree( vCube );
+        }
+        ABC_SWAP( Vec_Ptr_t *, vFront, vChildren );
+        nInitial++;
+    }
+    Vec_PtrForEachEntry( Vec_Int_t *, vFront, vCube, i )
+        Cec_GiaCncPush( p, vCube, nInitial );
+    Vec_PtrFree( vFront );
+    Vec_PtrFree( vChildren );
+    if ( fVerbose )
+    {
+        printf( "Cube-and-conquer: Vars = %d. Clauses = %d. Cands = %d. Cubes = %d. Refuted = %d. Depth = %d.  ", 
+            p->pCnf->nVars, p->pCnf->nClauses, Vec_IntSize(p->vCands), Vec_PtrSize(p->vQueue), p->nRefuted, nInitial );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkLook );
+    }
+    // solve the cubes (the runtime of the workers is measured separately)
+    clkTotal = Abc_Clock() - clkTotal;
+    p->TimeStop = nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_ClockWall() : 0;
+    fStarted = !p->fProved;
+    for ( i = 0; i < p->nWrks && fStarted; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaCncWorkerThread, (void *)(p->pWrks + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nWrks && fStarted; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    // collect the results
+    if ( p->pCex )
+    {
+        pGia->pCexComb = p->pCex;
+        RetValue = 0;
+    }
+    else if ( p->fProved )
+        RetValue = 1;
+    else 
+        RetValue = (p->fUndec || p->nJobsLeft > 0) ? -1 : 1;
+    for ( i = 0; i < p->nWrks; i++ )
+    {
+        nSolved += p->pWrks[i].nSolved;
+        nSplits += p->pWrks[i].nSplits;
+        clkWrk = Abc_MaxInt( clkWrk, p->pWrks[i].clkTotal );
+        if ( p->pWrks[i].pSat )
+            sat_solver_delete( p->pWrks[i].pSat );
+    }
+    if ( fVerbose )
+    {
+        printf( "Threads = %d. Cubes solved = %d. Split = %d. Refuted = %d. Shared units = %d. Shared binaries = %d.  ", 
+            p->nWrks, nSolved, nSplits, p->nRefuted, Vec_IntSize(p->vUnits), Vec_IntSize(p->vBins)/2 );
+        Abc_PrintTime( 1, "Time", clkTotal + clkWrk );
+    }
+    Vec_PtrForEachEntry( Cec_CncJob_t *, p->vQueue, pJob, i )
+        Cec_GiaCncJobFree( pJob );
+    Vec_PtrFree( p->vQueue );
+    Hsh_IntManStop( p->pBinHash );
+    Vec_IntFree( p->vBins );
+    Vec_IntFree( p->vUnits );
+    Vec_StrFree( p->vUnitSeen );
+    Vec_IntFree( p->vCands );
+    Vec_IntFree( p->vOuts );
+    Cnf_DataFree( p->pCnf );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p->pWrks );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Print stats about cofactoring variables.]
@@ -123,6 +123,7 @@ struct Fra_Sec_t_
     int              nBddMax;           // the max number of BDD nodes
     int              nBddIterMax;       // the limit on the number of BDD iterations
     int              nPdrTimeout;       // the timeout for PDR in the end
+    int              nCubeProcs;        // the number of cube-and-conquer threads in CEC (0 = not used)
     int              fPhaseAbstract;    // enables phase abstraction
     int              fRetimeFirst;      // enables most-forward retiming at the beginning
     int              fRetimeRegs;       // enables min-register retiming at the beginning
@@ -73,6 +73,7 @@ void Fra_SecSetDefaultParams( Fra_Sec_t * p )
     p->fUseNewProver     =       0;  // enables new prover
     p->fUsePdr           =       1;  // enables PDR
     p->nPdrTimeout       =      60;  // enabled PDR timeout
+    p->nCubeProcs        =       0;  // the number of cube-and-conquer threads in CEC
     p->fSilent           =       0;  // disables all output
     p->fVerbose          =       0;  // enables verbose reporting of statistics
     p->fVeryVerbose      =       0;  // enables very verbose reporting  
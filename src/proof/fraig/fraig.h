@@ -87,6 +87,7 @@ struct Prove_ParamsStruct_t_
     int     fBddReorder;           // enables dynamic BDD variable reordering
     // last-gasp mitering
     int     nMiteringLimitLast;    // final mitering limit
+    int     nCubeProcs;            // the number of cube-and-conquer threads for the last-gasp mitering (0 = not used)
     // global SAT solver limits
     ABC_INT64_T  nTotalBacktrackLimit;  // global limit on the number of backtracks
     ABC_INT64_T  nTotalInspectLimit;    // global limit on the number of clause inspects
@@ -50,6 +50,8 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nInproConfs;      // conflicts between inprocessing rounds (0 = no inprocessing)
+    int nThreads;         // the number of threads
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
@@ -83,6 +85,7 @@ struct Pdr_Par_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
+    char * pCheckFile;    // checkpoint file name
 };
 
 ////////////////////////////////////////////////////////////////////////
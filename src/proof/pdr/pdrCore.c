@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nInproConfs    =       0;  // conflicts between inprocessing rounds
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -990,6 +991,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pShare )
+                Pdr_ManSharePublish( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1012,9 +1015,14 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             Pdr_QueuePush( p, pThis );
         }
 
+        // add the clauses derived by other threads
+        if ( p->pShare )
+            Pdr_ManShareImport( p );
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pShare && Pdr_ManShareStop(p) )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1286,6 +1294,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintClauses( p, 0 );
         }
         // push clauses into this timeframe
+        if ( p->pShare )
+            Pdr_ManShareImport( p );
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
@@ -1331,7 +1341,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pShare && Pdr_ManShareStop(p)) )
         {
             p->pPars->iFrame = iFrame;
             return -1;
@@ -1392,6 +1402,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Vec_Vec_t * vClauses = NULL;
     int k, RetValue;
     abctime clk = Abc_Clock();
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1412,8 +1423,26 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    // the timeframes are not resumed when the outputs are solved separately
+    if ( pPars->pCheckFile && pPars->fSolveAll )
+    {
+        Abc_Print( 1, "Checkpointing is not supported when solving all outputs.\n" );
+        pPars->pCheckFile = NULL;
+    }
+    if ( pPars->nThreads > 1 && !pPars->fSolveAll && !pPars->fUseAbs && !pPars->fUseBridge )
+        return Pdr_ManSolvePar( pAig, pPars );
     p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->pCheckFile )
+        vClauses = IPdr_ManReadCheckpoint( p, pPars->pCheckFile );
+    if ( vClauses )
+    {
+        IPdr_ManRestoreClauses( p, vClauses, NULL );
+        RetValue = IPdr_ManSolveInt( p, 0, 1 );
+    }
+    else
+        RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->pCheckFile && RetValue == -1 )
+        IPdr_ManWriteCheckpoint( p, pPars->pCheckFile );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
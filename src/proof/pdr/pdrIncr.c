@@ -359,6 +359,122 @@ int IPdr_ManRestoreClauses( Pdr_Man_t * p, Vec_Vec_t * vClauses, Vec_Int_t * vMa
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the timeframes into the checkpoint.]
+
+  Description [The flop literals of each cube are sorted and written as
+  the differences between consecutive literals.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void IPdr_ManWriteCheckpoint( Pdr_Man_t * p, char * pFileName )
+{
+    Vec_Str_t * vOut = Aig_ManCheckpointStart( p->pAig, 'P' );
+    Vec_Ptr_t * vArrayK;
+    Pdr_Set_t * pCube;
+    int i, j, k, nCubes = 0;
+    Vec_StrPutI( vOut, Vec_VecSize(p->vClauses) );
+    Vec_VecForEachLevel( p->vClauses, vArrayK, i )
+    {
+        Vec_StrPutI( vOut, Vec_PtrSize(vArrayK) );
+        Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, j )
+        {
+            Vec_IntClear( p->vLits );
+            for ( k = 0; k < pCube->nLits; k++ )
+                if ( pCube->Lits[k] != -1 )
+                    Vec_IntPush( p->vLits, pCube->Lits[k] );
+            Vec_IntSort( p->vLits, 0 );
+            Vec_StrPutI( vOut, Vec_IntSize(p->vLits) );
+            for ( k = 0; k < Vec_IntSize(p->vLits); k++ )
+                Vec_StrPutI( vOut, Vec_IntEntry(p->vLits, k) - (k ? Vec_IntEntry(p->vLits, k-1) : 0) );
+            nCubes++;
+        }
+    }
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Checkpoint: Frames = %d. Cubes = %d. Size = %.2f KB.\n", Vec_VecSize(p->vClauses), nCubes, 1.0*Vec_StrSize(vOut)/(1<<10) );
+    Aig_ManCheckpointWrite( vOut, pFileName );
+    Vec_StrFree( vOut );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the clauses of the timeframes from the checkpoint.]
+
+  Description [Returns NULL if there is nothing to resume from or if the
+  contents are corrupted. Each count is checked against the remaining 
+  length before reading, and the cube literals are checked to be flop 
+  literals in increasing order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Vec_t * IPdr_ManReadCheckpoint( Pdr_Man_t * p, char * pFileName )
+{
+    Vec_Vec_t * vClauses = NULL;
+    Vec_Int_t * vPiLits;
+    Vec_Str_t * vIn;
+    Pdr_Set_t * pCube;
+    int i, j, k, nFrames, nCubes, nLits, Delta, Pos;
+    if ( (vIn = Aig_ManCheckpointRead( p->pAig, pFileName, 'P', &Pos )) == NULL )
+        return NULL;
+    // each timeframe takes at least one byte
+    if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nFrames) || nFrames > Vec_StrSize(vIn) - Pos )
+        goto corrupted;
+    if ( nFrames < 2 )
+    {
+        Vec_StrFree( vIn );
+        return NULL;
+    }
+    vPiLits  = Vec_IntAlloc( 0 );
+    vClauses = Vec_VecStart( nFrames );
+    for ( i = 0; i < nFrames; i++ )
+    {
+        if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nCubes) )
+            break;
+        for ( j = 0; j < nCubes; j++ )
+        {
+            Vec_IntClear( p->vLits );
+            if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nLits) || nLits > Saig_ManRegNum(p->pAig) )
+                break;
+            for ( k = 0; k < nLits; k++ )
+            {
+                if ( !Aig_ManCheckpointGetI(vIn, &Pos, &Delta) || (k && Delta == 0) ||
+                     Delta >= 2 * Saig_ManRegNum(p->pAig) - (k ? Vec_IntEntryLast(p->vLits) : 0) )
+                    break;
+                Vec_IntPush( p->vLits, Delta + (k ? Vec_IntEntryLast(p->vLits) : 0) );
+            }
+            if ( k < nLits )
+                break;
+            Vec_VecPush( vClauses, i, Pdr_SetCreate(p->vLits, vPiLits) );
+        }
+        if ( j < nCubes )
+            break;
+    }
+    Vec_IntFree( vPiLits );
+    if ( i < nFrames || Pos != Vec_StrSize(vIn) )
+        goto corrupted;
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Resuming from the checkpoint with %d timeframes and %d cubes.\n", nFrames, Vec_VecSizeSize(vClauses) );
+    Vec_StrFree( vIn );
+    return vClauses;
+corrupted:
+    printf( "Checkpoint file \"%s\" is corrupted and is ignored.\n", pFileName );
+    if ( vClauses )
+    {
+        Vec_VecForEachEntry( Pdr_Set_t *, vClauses, pCube, i, k )
+            Pdr_SetDeref( pCube );
+        Vec_VecFree( vClauses );
+    }
+    Vec_StrFree( vIn );
+    return NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -731,7 +847,7 @@ int IPdr_ManSolveInt( Pdr_Man_t * p, int fCheckClauses, int fPushClauses )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pShare && Pdr_ManShareStop(p)) )
         {
             p->pPars->iFrame = iFrame;
             return -1;
@@ -0,0 +1,434 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with clause sharing.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem by one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ManSolveSerial( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nThreads = pPars->nThreads;
+    pPars->nThreads = 0;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nThreads = nThreads;
+    return RetValue;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int  Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )          { return Pdr_ManSolveSerial( pAig, pPars ); }
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )  {}
+void Pdr_ManShareImport( Pdr_Man_t * p )                             {}
+int  Pdr_ManShareStop( Pdr_Man_t * p )                               { return 0; }
+
+#else // pthreads are used
+
+#define PDR_PAR_THR_MAX      64   // the largest number of threads
+#define PDR_PAR_CONF_LIMIT  100   // the conflict limit when checking a received clause
+
+typedef struct Pdr_ParWorker_t_ Pdr_ParWorker_t;
+typedef struct Pdr_ParMan_t_ Pdr_ParMan_t;
+struct Pdr_ParMan_t_
+{
+    Pdr_Par_t *       pPars;       // the user parameters
+    Pdr_ParWorker_t * pWorkers;    // the workers
+    int               nWorkers;    // the number of workers
+    Vec_Ptr_t *       vCubes[PDR_PAR_THR_MAX];  // the clauses received by each worker
+    Vec_Int_t *       vLevels[PDR_PAR_THR_MAX]; // the frames of these clauses
+    volatile int      nInbox[PDR_PAR_THR_MAX];  // the number of received clauses
+    int               nSent[PDR_PAR_THR_MAX];   // the number of clauses sent by each worker
+    int               nAdded[PDR_PAR_THR_MAX];  // the number of clauses accepted by each worker
+    int               iWinner;     // the worker that solved the problem
+    abctime           TimeToStop;  // the wall-clock time to stop (0 = no limit)
+    volatile int      fStop;       // stop request
+    pthread_mutex_t   Mutex;       // protects the received clauses
+};
+
+struct Pdr_ParWorker_t_
+{
+    Pdr_ParMan_t *    pMan;        // the shared manager
+    Aig_Man_t *       pAig;        // the copy of the user AIG
+    Pdr_Man_t *       p;           // the PDR manager of this worker
+    Pdr_Par_t         Pars;        // the parameters of this worker
+    Vec_Ptr_t *       vCubes;      // the clauses being imported
+    Vec_Int_t *       vLevels;     // the frames of these clauses
+    int               iWorker;     // the worker number
+    int               RetValue;    // the result of this worker
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Sends the new clause to the other workers.]
+
+  Description [The clause was added to frame k and all frames below.
+  Each worker receives its own copy of the clause.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_ParMan_t * pMan = (Pdr_ParMan_t *)p->pShare;
+    int i;
+    if ( pMan->fStop )
+        return;
+    pthread_mutex_lock( &pMan->Mutex );
+    for ( i = 0; i < pMan->nWorkers; i++ )
+    {
+        if ( i == p->iShare )
+            continue;
+        Vec_PtrPush( pMan->vCubes[i], Pdr_SetDup(pCube) );
+        Vec_IntPush( pMan->vLevels[i], k );
+        pMan->nInbox[i] = Vec_PtrSize( pMan->vCubes[i] );
+    }
+    pMan->nSent[p->iShare]++;
+    pthread_mutex_unlock( &pMan->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses received from the other workers.]
+
+  Description [The mutex is taken only if there are received clauses.
+  A received clause is added to the same frame as in the sending worker
+  (or to the last frame of this worker) only if it is not subsumed and
+  if it is inductive relative to the previous frame of this worker.
+  Otherwise, the clause is dropped. The check is needed because the
+  frames of different workers contain different clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_ParMan_t * pMan = (Pdr_ParMan_t *)p->pShare;
+    Pdr_ParWorker_t * pWork = pMan->pWorkers + p->iShare;
+    Vec_Ptr_t * vTemp;  Vec_Int_t * vTemp2;
+    Pdr_Set_t * pCube;
+    int i, k, j, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( pMan->nInbox[p->iShare] == 0 || pMan->fStop )
+        return;
+    // take the received clauses
+    pthread_mutex_lock( &pMan->Mutex );
+    vTemp  = pMan->vCubes[p->iShare];   pMan->vCubes[p->iShare]  = pWork->vCubes;   pWork->vCubes  = vTemp;
+    vTemp2 = pMan->vLevels[p->iShare];  pMan->vLevels[p->iShare] = pWork->vLevels;  pWork->vLevels = vTemp2;
+    pMan->nInbox[p->iShare] = 0;
+    pthread_mutex_unlock( &pMan->Mutex );
+    // add them to the frames
+    Vec_PtrForEachEntry( Pdr_Set_t *, pWork->vCubes, pCube, i )
+    {
+        k = Abc_MinInt( Vec_IntEntry(pWork->vLevels, i), kMax );
+        if ( k < 1 || pMan->fStop || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, PDR_PAR_CONF_LIMIT, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        p->nCubes++;
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pCube );
+        pMan->nAdded[p->iShare]++;
+    }
+    Vec_PtrClear( pWork->vCubes );
+    Vec_IntClear( pWork->vLevels );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the threads should stop.]
+
+  Description [The runtime limit is checked here using the wall clock,
+  because Abc_Clock() measures the time of the calling thread. When
+  the limit is reached, the other threads are stopped through the flag
+  shared by the SAT solvers of all workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareStop( Pdr_Man_t * p )
+{
+    Pdr_ParMan_t * pMan = (Pdr_ParMan_t *)p->pShare;
+    if ( pMan->TimeToStop && Abc_ClockWall() >= pMan->TimeToStop )
+        pMan->fStop = 1;
+    return pMan->fStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the parameters of the workers different.]
+
+  Description [The first worker uses the user's parameters. Other workers
+  use different random seeds and generalization settings.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManParDiversify( Pdr_Par_t * pPars, int iWorker )
+{
+    if ( iWorker == 0 )
+        return;
+    pPars->nRandomSeed += iWorker;
+    if ( iWorker % 4 == 1 )
+        pPars->fFlopOrder ^= 1;
+    else if ( iWorker % 4 == 2 )
+        pPars->fTwoRounds ^= 1;
+    else if ( iWorker % 4 == 3 )
+        pPars->fFlopPrio ^= 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManParThread( void * pArg )
+{
+    Pdr_ParWorker_t * pWork = (Pdr_ParWorker_t *)pArg;
+    Pdr_ParMan_t * pMan = pWork->pMan;
+    Vec_Vec_t * vClauses = NULL;
+    abctime clk = Abc_Clock();
+    if ( pWork->Pars.pCheckFile )
+        vClauses = IPdr_ManReadCheckpoint( pWork->p, pWork->Pars.pCheckFile );
+    if ( vClauses )
+    {
+        IPdr_ManRestoreClauses( pWork->p, vClauses, NULL );
+        pWork->RetValue = IPdr_ManSolveInt( pWork->p, 0, 1 );
+    }
+    else
+        pWork->RetValue = Pdr_ManSolveInt( pWork->p );
+    pWork->p->tTotal += Abc_Clock() - clk;
+    if ( pWork->RetValue != -1 )
+    {
+        pthread_mutex_lock( &pMan->Mutex );
+        if ( pMan->iWinner == -1 )
+            pMan->iWinner = pWork->iWorker;
+        pMan->fStop = 1;
+        pthread_mutex_unlock( &pMan->Mutex );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded PDR.]
+
+  Description [Each worker runs PDR on its own copy of the AIG with its
+  own frames and SAT solvers, using different random seeds and settings.
+  When a worker blocks a cube, the clause is sent to the other workers,
+  which add it to their frames after checking it. The result of the first
+  worker that solves the problem is returned. The first worker runs in
+  the calling thread and resumes from the checkpoint, if given.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ParMan_t Man, * pMan = &Man;
+    Pdr_ParWorker_t Workers[PDR_PAR_THR_MAX], * pWork;
+    pthread_t WorkerThread[PDR_PAR_THR_MAX];
+    Pdr_Set_t * pCube;
+    int i, k, status, RetValue = -1, nWorkers = Abc_MinInt( pPars->nThreads, PDR_PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    assert( !pPars->fSolveAll && !pPars->fUseAbs );
+    memset( pMan, 0, sizeof(Pdr_ParMan_t) );
+    pMan->pPars      = pPars;
+    pMan->pWorkers   = Workers;
+    pMan->nWorkers   = nWorkers;
+    pMan->iWinner    = -1;
+    pMan->TimeToStop = pPars->nTimeOut ? Abc_ClockWall() + pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    for ( k = 0; k < nWorkers; k++ )
+    {
+        pWork = Workers + k;
+        pWork->pMan     = pMan;
+        pWork->pAig     = Aig_ManDupSimple( pAig );
+        pWork->vCubes   = Vec_PtrAlloc( 100 );
+        pWork->vLevels  = Vec_IntAlloc( 100 );
+        pWork->iWorker  = k;
+        pWork->RetValue = -1;
+        pMan->vCubes[k]  = Vec_PtrAlloc( 100 );
+        pMan->vLevels[k] = Vec_IntAlloc( 100 );
+        // only the first worker prints progress; the results are reported below
+        pWork->Pars              = *pPars;
+        Pdr_ManParDiversify( &pWork->Pars, k );
+        pWork->Pars.fVerbose     = pPars->fVerbose && k == 0;
+        pWork->Pars.fVeryVerbose = 0;
+        pWork->Pars.fNotVerbose  = 1;
+        pWork->Pars.fSilent      = 1;
+        pWork->Pars.fDumpInv     = 0;
+        pWork->Pars.nTimeOutGap  = 0;
+        pWork->Pars.vOutMap      = NULL;
+        pWork->Pars.pCheckFile   = k ? NULL : pPars->pCheckFile;
+        pWork->Pars.pFuncOnFail  = NULL;
+        pWork->p = Pdr_ManStart( pWork->pAig, &pWork->Pars, NULL );
+        pWork->p->pShare = pMan;
+        pWork->p->iShare = k;
+        pWork->p->pStop  = &pMan->fStop;
+    }
+    // run the workers
+    for ( k = 1; k < nWorkers; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Pdr_ManParThread, (void *)(Workers + k) );  assert( status == 0 );
+    }
+    Pdr_ManParThread( (void *)Workers );
+    for ( k = 1; k < nWorkers; k++ )
+        pthread_join( WorkerThread[k], NULL );
+    // the solvers created from now on do not depend on the other workers
+    for ( k = 0; k < nWorkers; k++ )
+        Workers[k].p->pStop = NULL;
+    // report the results
+    if ( pMan->iWinner >= 0 )
+    {
+        pWork    = Workers + pMan->iWinner;
+        RetValue = pWork->RetValue;
+        pPars->iFrame = pWork->Pars.iFrame;
+        if ( RetValue == 0 )
+        {
+            assert( pWork->pAig->pSeqModel != NULL );
+            pAig->pSeqModel = pWork->pAig->pSeqModel;
+            pWork->pAig->pSeqModel = NULL;
+            pPars->nFailOuts = 1;
+        }
+        else
+        {
+            if ( !pPars->fSilent )
+                Pdr_ManReportInvariant( pWork->p );
+            if ( !pPars->fSilent )
+                Pdr_ManVerifyInvariant( pWork->p );
+            pPars->nProveOuts = Saig_ManPoNum(pAig);
+        }
+        if ( pPars->vOutMap )
+            for ( k = 0; k < Saig_ManPoNum(pAig); k++ )
+                Vec_IntWriteEntry( pPars->vOutMap, k, RetValue ? 1 : (k == pAig->pSeqModel->iPo ? 0 : -1) );
+    }
+    else
+    {
+        // all workers explored the same frames or were stopped
+        pWork = Workers;
+        pPars->iFrame = pWork->Pars.iFrame;
+        if ( !pPars->fSilent )
+        {
+            if ( pMan->TimeToStop && Abc_ClockWall() >= pMan->TimeToStop )
+                Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  pPars->nTimeOut, pPars->iFrame );
+            else if ( pPars->nFrameMax && pPars->iFrame >= pPars->nFrameMax )
+                Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", pPars->nFrameMax );
+            else if ( pPars->nConfLimit )
+                Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  pPars->nConfLimit, pPars->iFrame );
+        }
+        if ( pPars->pCheckFile )
+            IPdr_ManWriteCheckpoint( pWork->p, pPars->pCheckFile );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( k = 0; k < nWorkers; k++ )
+            Abc_Print( 1, "Worker %2d : Frames =%5d. Clauses =%7d. Sent =%7d. Accepted =%7d.%s\n", k,
+                Workers[k].Pars.iFrame, Workers[k].p->nCubes, pMan->nSent[k], pMan->nAdded[k], k == pMan->iWinner ? "  Solved." : "" );
+        Abc_PrintTime( 1, "Total runtime", Abc_Clock() - clk );
+    }
+    if ( pPars->fDumpInv )
+    {
+        char * pFileName = Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWork->p, RetValue!=1 ) );
+        Pdr_ManDumpClauses( pWork->p, pFileName, RetValue==1 );
+    }
+    else if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWork->p, RetValue!=1 ) );
+    // clean up
+    for ( k = 0; k < nWorkers; k++ )
+    {
+        Pdr_ManStop( Workers[k].p );
+        Aig_ManStop( Workers[k].pAig );
+        Vec_PtrForEachEntry( Pdr_Set_t *, pMan->vCubes[k], pCube, i )
+            Pdr_SetDeref( pCube );
+        Vec_PtrFree( pMan->vCubes[k] );
+        Vec_IntFree( pMan->vLevels[k] );
+        Vec_PtrFree( Workers[k].vCubes );
+        Vec_IntFree( Workers[k].vLevels );
+    }
+    pthread_mutex_destroy( &pMan->Mutex );
+    pPars->iFrame--;
+    fflush( stdout );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
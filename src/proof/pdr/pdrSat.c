@@ -53,6 +53,8 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     // create new solver
 //    pSat = sat_solver_new();
     pSat = zsat_solver_new_seed(p->pPars->nRandomSeed);
+    if ( p->pPars->nInproConfs )
+        sat_solver_set_inprocessing( pSat, p->pPars->nInproConfs );
     pSat = Pdr_ManNewSolver( pSat, p, k, (int)(k == 0) );
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
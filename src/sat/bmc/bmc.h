@@ -66,9 +66,11 @@ struct Saig_ParBmc_t_
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
+    int         nInproConfs;    // conflicts between inprocessing rounds (0 = no inprocessing)
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     char *      pLogFileName;   // log file name
+    char *      pCheckFile;     // checkpoint file name
     int         fSilent;        // completely silent
     int         iFrame;         // explored up to this frame
     int         nFailOuts;      // the number of failed outputs
@@ -77,6 +79,8 @@ struct Saig_ParBmc_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     int         RunId;          // BMC id in this run 
     int(*pFuncStop)(int);       // callback to terminate
+    int         nThreads;       // the number of threads solving groups of outputs
+    void *      pPartData;      // the group of outputs solved by this thread
 };
 
  
@@ -152,6 +156,17 @@ struct Bmc_ParFf_t_
     int        fVerbose;
 };
 
+typedef struct Bmc_PortPar_t_ Bmc_PortPar_t;
+struct Bmc_PortPar_t_
+{
+    int         nProcs;         // the number of threads (0 = portfolio is disabled)
+    int         nConfLimit;     // conflict limit of each engine
+    int         TimeOut;        // runtime limit of each engine in seconds
+    int         fVerbose;       // verbose output
+};
+
+struct sat_solver_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -181,12 +196,23 @@ extern Gia_Man_t *       Bmc_GiaTargetStates( Gia_Man_t * p, Abc_Cex_t * pCex, i
 extern Aig_Man_t *       Bmc_AigTargetStates( Aig_Man_t * p, Abc_Cex_t * pCex, int iFrBeg, int iFrEnd, int fCombOnly, int fGenAll, int fAllFrames, int fVerbose );
 /*=== bmcCexMin.c ==========================================================*/
 extern Abc_Cex_t *       Saig_ManCexMinPerform( Aig_Man_t * pAig, Abc_Cex_t * pCex );
+/*=== bmcCexTer.c ==========================================================*/
+extern Vec_Wrd_t *       Bmc_CexTerStart( Gia_Man_t * p );
+extern void              Bmc_CexTerSimFrame( Gia_Man_t * p, Vec_Wrd_t * vSims );
+extern word              Bmc_CexTerVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t ** ppCexCare, int nCexes );
+extern Abc_Cex_t *       Bmc_CexTerEssentialBits( Gia_Man_t * p, Abc_Cex_t * pCexState, Abc_Cex_t * pCexCare );
 /*=== bmcCexTool.c ==========================================================*/
 extern void              Bmc_CexPrint( Abc_Cex_t * pCex, int nRealPis, int fVerbose );
 extern int               Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcPort.c ==========================================================*/
+extern void              Bmc_PortSetParams( Bmc_PortPar_t * pPars );
+extern Bmc_PortPar_t *   Bmc_PortReadParams();
+extern void              Bmc_PortPrintStats();
+extern void              Bmc_PortResetStats();
+extern int               Bmc_PortSolve( struct sat_solver_t * pSat, int * pBeg, int * pEnd, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
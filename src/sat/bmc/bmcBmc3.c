@@ -27,6 +27,17 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -68,8 +79,15 @@ struct Gia_ManBmc_t_
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    // checkpointing
+    Vec_Int_t *       vDepths;     // the number of frames proved for each output
 };
 
+static int  Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+static void Saig_ManBmcParReport( Gia_ManBmc_t * p, int f, int i );
+static abctime Saig_ManBmcParStart( Gia_ManBmc_t * p, abctime nTimeToStop );
+static int  Saig_ManBmcParStop( Gia_ManBmc_t * p, int f );
+
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
 
 void Gia_ManReportProgress( FILE * pFile, int prop_no, int depth )
@@ -89,6 +107,8 @@ void Gia_ManReportProgress( FILE * pFile, int prop_no, int depth )
 #define SAIG_TER_ONE 2
 #define SAIG_TER_UND 3
 
+#define BMC3_CHECK_LITS_MAX  8  // the largest learned clause saved in the checkpoint
+
 static inline int Saig_ManBmcSimInfoNot( int Value )
 {
     if ( Value == SAIG_TER_ZER )
@@ -775,6 +795,7 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p->vData = Vec_IntAlloc( 5 * 10000 );
     p->vHash = Hsh_IntManStart( p->vData, 5, 10000 );
     p->vId2Lit = Vec_IntAlloc( 10000 );
+    p->vDepths = Vec_IntStart( Saig_ManPoNum(pAig) );
     // time spent on each outputs
     if ( nTimeOutOne )
     {
@@ -834,6 +855,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
     Vec_IntFree( p->vId2Lit );
+    Vec_IntFree( p->vDepths );
     ABC_FREE( p->pSopSizes );
     ABC_FREE( p->pSops[1] );
     ABC_FREE( p->pSops );
@@ -1347,6 +1369,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->nInproConfs    =     0;    // conflicts between inprocessing rounds
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1443,8 +1466,326 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         bmcg_sat_solver_set_conflict_budget( p->pSat3, p->pPars->nConfLimit );
         return bmcg_sat_solver_solve( p->pSat3, &Lit, 1 );
     }
+    else if ( p->pPars->pPartData ) // the threads solving groups of outputs do not start the portfolio
+        return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
     else
-        return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+        return Bmc_PortSolve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the unit clause to the SAT solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcAddUnit( Gia_ManBmc_t * p, int Lit )
+{
+    if ( p->pSat2 )
+        return satoko_add_clause( p->pSat2, &Lit, 1 );
+    if ( p->pSat3 )
+        return bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
+    return sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of frames explored for all outputs.]
+
+  Description [The failed outputs are not considered.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcFramesDone( Gia_ManBmc_t * p )
+{
+    int i, Depth, nFrames = ABC_INFINITY;
+    Vec_IntForEachEntry( p->vDepths, Depth, i )
+        if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) )
+            nFrames = Abc_MinInt( nFrames, Depth );
+    return nFrames == ABC_INFINITY ? 0 : nFrames;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the resumable state into the checkpoint file.]
+
+  Description [The state includes the number of frames proved for each
+  output, the failed outputs with their counter-examples, and (for the
+  default SAT solver)
+  the top-level assignments and the short learned clauses. A SAT literal
+  is recorded as the frame and the literal of the object number, which
+  do not depend on the order in which the unrolling was constructed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcWriteCheckpoint( Gia_ManBmc_t * p )
+{
+    Vec_Str_t * vOut = Aig_ManCheckpointStart( p->pAig, 'B' );
+    Vec_Int_t * vVar2Obj, * vVar2Frame, * vFrame, * vLits;
+    Abc_Cex_t * pCex;
+    Sat_Mem_t * pMem;
+    clause * c;
+    int i, k, f, Lit, iVar, Entry, nClauses = 0;
+    // write the outputs
+    Vec_StrPutI( vOut, Saig_ManPoNum(p->pAig) );
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        pCex = p->vCexes ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, i) : NULL;
+        Vec_StrPutI( vOut, Vec_IntEntry(p->vDepths, i) );
+        Vec_StrPutI( vOut, pCex == NULL ? 0 : pCex == (Abc_Cex_t *)(ABC_PTRINT_T)1 ? 1 : 2 );
+        if ( pCex <= (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+            continue;
+        Vec_StrPutI( vOut, pCex->iFrame );
+        for ( k = 0; k < Abc_BitWordNum(pCex->nBits); k++ )
+            Vec_StrPutI_ne( vOut, (int)pCex->pData[k] );
+    }
+    if ( p->pSat == NULL )
+    {
+        Vec_StrPutI( vOut, 0 );
+        Aig_ManCheckpointWrite( vOut, p->pPars->pCheckFile );
+        Vec_StrFree( vOut );
+        return;
+    }
+    // map SAT variables into object numbers and frames
+    vVar2Obj   = Vec_IntStartFull( sat_solver_nvars(p->pSat) );
+    vVar2Frame = Vec_IntStartFull( sat_solver_nvars(p->pSat) );
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vId2Var, vFrame, f )
+        Vec_IntForEachEntry( vFrame, Entry, k )
+            if ( Entry != ~0 && Entry > 1 && Vec_IntEntry(vVar2Obj, lit_var(Entry)) == -1 )
+            {
+                Vec_IntWriteEntry( vVar2Obj, lit_var(Entry), Abc_Var2Lit(k, lit_sign(Entry)) );
+                Vec_IntWriteEntry( vVar2Frame, lit_var(Entry), f );
+            }
+    // collect the top-level assignments followed by the learned clauses
+    vLits = Vec_IntAlloc( 1000 );
+    k = veci_size(&p->pSat->trail_lim) ? veci_begin(&p->pSat->trail_lim)[0] : p->pSat->qtail;
+    for ( i = 0; i < k; i++ )
+        if ( Vec_IntEntry(vVar2Obj, lit_var(p->pSat->trail[i])) >= 0 )
+            Vec_IntPushTwo( vLits, 1, p->pSat->trail[i] ), nClauses++;
+    pMem = &p->pSat->Mem;
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        if ( c->mark || clause_size(c) > BMC3_CHECK_LITS_MAX )
+            continue;
+        for ( f = 0; f < clause_size(c); f++ )
+            if ( Vec_IntEntry(vVar2Obj, lit_var(clause_begin(c)[f])) == -1 )
+                break;
+        if ( f < clause_size(c) )
+            continue;
+        Vec_IntPush( vLits, clause_size(c) );
+        for ( f = 0; f < clause_size(c); f++ )
+            Vec_IntPush( vLits, clause_begin(c)[f] );
+        nClauses++;
+    }
+    // write the clauses
+    Vec_StrPutI( vOut, nClauses );
+    for ( i = 0; i < Vec_IntSize(vLits); i += 1 + Vec_IntEntry(vLits, i) )
+    {
+        Vec_StrPutI( vOut, Vec_IntEntry(vLits, i) );
+        for ( k = 1; k <= Vec_IntEntry(vLits, i); k++ )
+        {
+            Lit  = Vec_IntEntry( vLits, i + k );
+            iVar = lit_var( Lit );
+            Vec_StrPutI( vOut, Vec_IntEntry(vVar2Frame, iVar) );
+            Vec_StrPutI( vOut, Abc_LitNotCond(Vec_IntEntry(vVar2Obj, iVar), lit_sign(Lit)) );
+        }
+    }
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Checkpoint: Frames = %d. Clauses = %d. Size = %.2f KB.\n", Saig_ManBmcFramesDone(p), nClauses, 1.0*Vec_StrSize(vOut)/(1<<10) );
+    Aig_ManCheckpointWrite( vOut, p->pPars->pCheckFile );
+    Vec_StrFree( vOut );
+    Vec_IntFree( vVar2Obj );
+    Vec_IntFree( vVar2Frame );
+    Vec_IntFree( vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the contents of the checkpoint.]
+
+  Description [Walks through the contents written by Saig_ManBmcWriteCheckpoint()
+  and checks each count and size against the remaining length before 
+  reading it, as well as the ranges of the numbers. Returns 1 if the 
+  contents can be loaded by Saig_ManBmcReadCheckpoint() and 
+  Saig_ManBmcLoadCheckpoint() without further checks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcCheckCheckpoint( Gia_ManBmc_t * p, Vec_Str_t * vIn, int Pos )
+{
+    word nBytes;
+    int i, k, nPos, Depth, Status, iFrame, nClauses, nLits, f, Num;
+    if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nPos) || nPos != Saig_ManPoNum(p->pAig) )
+        return 0;
+    for ( i = 0; i < nPos; i++ )
+    {
+        if ( !Aig_ManCheckpointGetI(vIn, &Pos, &Depth) || !Aig_ManCheckpointGetI(vIn, &Pos, &Status) || Status > 2 )
+            return 0;
+        if ( Status < 2 )
+            continue;
+        if ( !Aig_ManCheckpointGetI(vIn, &Pos, &iFrame) )
+            return 0;
+        // the counter-example is stored as 4 bytes per word of bit data
+        nBytes = (word)Saig_ManRegNum(p->pAig) + (word)Saig_ManPiNum(p->pAig) * ((word)iFrame + 1);
+        if ( nBytes >= 0x7FFFFFFF )
+            return 0;
+        nBytes = 4 * (word)Abc_BitWordNum( (int)nBytes );
+        if ( nBytes > (word)(Vec_StrSize(vIn) - Pos) )
+            return 0;
+        Pos += (int)nBytes;
+    }
+    if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nClauses) )
+        return 0;
+    for ( i = 0; i < nClauses; i++ )
+    {
+        if ( !Aig_ManCheckpointGetI(vIn, &Pos, &nLits) || nLits == 0 || nLits > BMC3_CHECK_LITS_MAX )
+            return 0;
+        for ( k = 0; k < nLits; k++ )
+            if ( !Aig_ManCheckpointGetI(vIn, &Pos, &f) || !Aig_ManCheckpointGetI(vIn, &Pos, &Num) || Abc_Lit2Var(Num) >= p->nObjNums )
+                return 0;
+    }
+    return Pos == Vec_StrSize(vIn);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the checkpoint and restores the failed outputs.]
+
+  Description [The failed outputs are restored only when all outputs are
+  solved; otherwise, they are solved again in the frame where they fail.
+  The remaining contents are loaded by Saig_ManBmcLoadCheckpoint() after
+  the explored frames are unrolled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Saig_ManBmcReadCheckpoint( Gia_ManBmc_t * p, int * pPos )
+{
+    Vec_Str_t * vIn = Aig_ManCheckpointRead( p->pAig, p->pPars->pCheckFile, 'B', pPos );
+    Abc_Cex_t * pCex;
+    int i, k, Status;
+    if ( vIn == NULL )
+        return NULL;
+    if ( !Saig_ManBmcCheckCheckpoint( p, vIn, *pPos ) )
+    {
+        printf( "Checkpoint file \"%s\" is corrupted and is ignored.\n", p->pPars->pCheckFile );
+        Vec_StrFree( vIn );
+        return NULL;
+    }
+    Vec_StrGetI( vIn, pPos );
+    for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+    {
+        Vec_IntWriteEntry( p->vDepths, i, Vec_StrGetI(vIn, pPos) );
+        Status = Vec_StrGetI( vIn, pPos );
+        if ( Status == 0 )
+            continue;
+        pCex = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+        if ( Status == 2 )
+        {
+            k = Vec_StrGetI( vIn, pPos );
+            pCex = Abc_CexAlloc( Saig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), k + 1 );
+            pCex->iFrame = k;
+            pCex->iPo    = i;
+            for ( k = 0; k < Abc_BitWordNum(pCex->nBits); k++ )
+                pCex->pData[k] = (unsigned)Vec_StrGetI_ne( vIn, pPos );
+        }
+        if ( !p->pPars->fSolveAll || (Status == 1 && p->pPars->fStoreCex) )
+        {
+            if ( pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+                Abc_CexFree( pCex );
+            continue;
+        }
+        Vec_PtrWriteEntry( p->vCexes, i, pCex );
+        p->pPars->nFailOuts++;
+    }
+    return vIn;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of the checkpoint to the SAT solver.]
+
+  Description [Should be called when the unrolling has all the explored
+  frames. The outputs are asserted to be 0 in the proved frames.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcLoadCheckpoint( Gia_ManBmc_t * p, Vec_Str_t * vIn, int Pos )
+{
+    Vec_Int_t * vNum2Id = Vec_IntStartFull( p->nObjNums );
+    Vec_Int_t * vLits = Vec_IntAlloc( BMC3_CHECK_LITS_MAX );
+    Aig_Obj_t * pObj;
+    int i, k, f, Lit, Num, nLits, fSat, nClauses, nAdded = 0, status;
+    Vec_IntForEachEntry( p->vId2Num, Num, i )
+        if ( Num >= 0 )
+            Vec_IntWriteEntry( vNum2Id, Num, i );
+    // assert the outputs in the proved frames
+    Saig_ManForEachPo( p->pAig, pObj, i )
+        for ( f = 0; f < Vec_IntEntry(p->vDepths, i); f++ )
+        {
+            Lit = Saig_ManBmcCreateCnf( p, pObj, f );
+            if ( Lit == 0 )
+                continue;
+            status = Saig_ManBmcAddUnit( p, lit_neg(Lit) );
+            assert( status );
+        }
+    // add the clauses
+    nClauses = Vec_StrGetI( vIn, &Pos );
+    for ( i = 0; i < nClauses; i++ )
+    {
+        Vec_IntClear( vLits );
+        nLits = Vec_StrGetI( vIn, &Pos );
+        for ( fSat = k = 0; k < nLits; k++ )
+        {
+            f   = Vec_StrGetI( vIn, &Pos );
+            Num = Vec_StrGetI( vIn, &Pos );
+            // skip the clauses of the frames that are not unrolled yet
+            if ( f >= Vec_PtrSize(p->vId2Var) )
+                fSat = 1;
+            if ( fSat )
+                continue;
+            pObj = Aig_ManObj( p->pAig, Vec_IntEntry(vNum2Id, Abc_Lit2Var(Num)) );
+            Lit  = Abc_LitNotCond( Saig_ManBmcCreateCnf(p, pObj, f), Abc_LitIsCompl(Num) );
+            if ( Lit == 1 )
+                fSat = 1;
+            else if ( Lit != 0 )
+                Vec_IntPush( vLits, Lit );
+        }
+        if ( fSat || Vec_IntSize(vLits) == 0 )
+            continue;
+        if ( p->pSat2 )
+            status = satoko_add_clause( p->pSat2, Vec_IntArray(vLits), Vec_IntSize(vLits) );
+        else if ( p->pSat3 )
+            status = bmcg_sat_solver_addclause( p->pSat3, Vec_IntArray(vLits), Vec_IntSize(vLits) );
+        else
+            status = sat_solver_addclause( p->pSat, Vec_IntArray(vLits), Vec_IntLimit(vLits) );
+        assert( status );
+        nAdded++;
+    }
+    if ( p->pSat )
+        sat_solver_compress( p->pSat );
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Resuming from the checkpoint with %d explored frames and %d clauses.\n", Vec_PtrSize(p->vId2Var) - 1, nAdded );
+    Vec_IntFree( vNum2Id );
+    Vec_IntFree( vLits );
 }
 
 /**Function*************************************************************
@@ -1464,13 +1805,16 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
+    Vec_Str_t * vCheck = NULL;
     unsigned * pInfo;
-    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
+    int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0, nFramesDone = 0, iCheckPos = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
     int i, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    if ( pPars->nThreads > 1 && pPars->pPartData == NULL && Saig_ManPoNum(pAig) > 1 )
+        return Saig_ManBmcScalablePar( pAig, pPars );
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1491,6 +1835,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         p->pSat->fNoRestarts  = p->pPars->fNoRestarts;
         p->pSat->RunId        = p->pPars->RunId;
         p->pSat->pFuncStop    = p->pPars->pFuncStop;
+        if ( p->pPars->nInproConfs )
+            sat_solver_set_inprocessing( p->pSat, p->pPars->nInproConfs );
     }
     else if ( p->pSat3 )
     {
@@ -1504,6 +1850,14 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    // skip the frames explored before the checkpoint was written
+    if ( pPars->pCheckFile && (vCheck = Saig_ManBmcReadCheckpoint( p, &iCheckPos )) )
+    {
+        nFramesDone = Saig_ManBmcFramesDone( p );
+        pPars->nStart = Abc_MaxInt( pPars->nStart, nFramesDone );
+        if ( pPars->nFailOuts )
+            RetValue = 0;
+    }
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",// Sect =%3d.\n", 
@@ -1513,6 +1867,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
             pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
     } 
     pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    if ( pPars->pPartData )
+        nTimeToStop = Saig_ManBmcParStart( p, nTimeToStop );
     // set runtime limit
     if ( nTimeToStop )
     {
@@ -1531,7 +1887,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
-            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
                     if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) && !(p->pTime4Outs && p->pTime4Outs[i] == 0) ) // not SAT and not timed out
@@ -1542,12 +1899,13 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC if all targets are solved
         if ( pPars->fSolveAll && pPars->nFailOuts + pPars->nDropOuts >= Saig_ManPoNum(pAig) )
         {
-            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
             RetValue = pPars->nFailOuts ? 0 : 1;
             goto finish;
         }
         // consider the next timeframe
-        if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
+        if ( (RetValue == -1 || pPars->fSolveAll) && (pPars->nStart == 0 || pPars->nStart == nFramesDone) && !nJumpFrame )
             pPars->iFrame = f-1;
         // map nodes of this section
         Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
@@ -1575,6 +1933,11 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                 Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
             }
         }
+        if ( vCheck && f == nFramesDone )
+        {
+            Saig_ManBmcLoadCheckpoint( p, vCheck, iCheckPos );
+            Vec_StrFreeP( &vCheck );
+        }
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
@@ -1632,6 +1995,8 @@ clkOther += Abc_Clock() - clk2;
                     Abc_Print( 1, "Bmc3 got callbacks.\n" );
                 goto finish;
             }
+            if ( pPars->pPartData && Saig_ManBmcParStop(p, f) )
+                goto finish;
             // skip solved outputs
             if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
                 continue;
@@ -1674,6 +2039,8 @@ clkSatRun = Abc_Clock() - clk2;
             if ( status == l_False )
             {
 nTimeUnsat += clkSatRun;
+                if ( Vec_IntEntry(p->vDepths, i) == f )
+                    Vec_IntWriteEntry( p->vDepths, i, f+1 );
                 if ( Lit != 0 )
                 {
                     // add final unit clause
@@ -1732,12 +2099,16 @@ nTimeSat += clkSatRun;
                     }
                     ABC_FREE( pAig->pSeqModel );
                     pAig->pSeqModel = Saig_ManGenerateCex( p, f, i );
+                    if ( pPars->pPartData )
+                        Saig_ManBmcParReport( p, f, i );
                     goto finish;
                 }
                 pPars->nFailOuts++;
                 if ( !pPars->fNotVerbose )
                     Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
                         nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                if ( pPars->pPartData )
+                    Saig_ManBmcParReport( p, f, i );
                 if ( p->vCexes == NULL )
                     p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
                 pCexNew = (p->pPars->fUseBridge || pPars->fStoreCex) ? Saig_ManGenerateCex( p, f, i ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
@@ -1799,6 +2170,8 @@ nTimeSat += clkSatRun;
                     if ( !pPars->fNotVerbose )
                         Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
                             nOutDigits, k, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                    if ( pPars->pPartData )
+                        Saig_ManBmcParReport( p, f, k );
                     // report to the bridge
                     if ( p->pPars->fUseBridge )
                     {
@@ -1864,10 +2237,13 @@ nTimeUndec += clkSatRun;
     // consider the next timeframe
     if ( nJumpFrame && pPars->nStart == 0 )
         pPars->iFrame = nJumpFrame - pPars->nFramesJump;
-    else if ( RetValue == -1 && pPars->nStart == 0 )
+    else if ( RetValue == -1 && (pPars->nStart == 0 || pPars->nStart == nFramesDone) )
         pPars->iFrame = f-1;
 //ABC_PRT( "CNF generation runtime", clkOther );
 finish:
+    if ( pPars->pCheckFile )
+        Saig_ManBmcWriteCheckpoint( p );
+    Vec_StrFreeP( &vCheck );
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Runtime:  " );
@@ -1884,6 +2260,472 @@ finish:
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves all outputs by one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcScalableSerial( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    int RetValue, nThreads = pPars->nThreads;
+    pPars->nThreads = 0;
+    RetValue = Saig_ManBmcScalable( pAig, pPars );
+    pPars->nThreads = nThreads;
+    return RetValue;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+static int  Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars ) { return Saig_ManBmcScalableSerial( pAig, pPars ); }
+static void Saig_ManBmcParReport( Gia_ManBmc_t * p, int f, int i )            {}
+static abctime Saig_ManBmcParStart( Gia_ManBmc_t * p, abctime nTimeToStop )   { return nTimeToStop; }
+static int  Saig_ManBmcParStop( Gia_ManBmc_t * p, int f )                     { return 0; }
+
+#else // pthreads are used
+
+#define BMC3_PAR_THR_MAX  64   // the largest number of threads
+
+typedef struct Bmc3_ParMan_t_ Bmc3_ParMan_t;
+typedef struct Bmc3_ParGroup_t_ Bmc3_ParGroup_t;
+struct Bmc3_ParMan_t_
+{
+    Aig_Man_t *       pAig;        // the user AIG
+    Saig_ParBmc_t *   pPars;       // the user parameters
+    Bmc3_ParGroup_t * pGroups;     // the groups
+    int               nGroups;     // the number of groups
+    Vec_Ptr_t *       vCexes;      // counter-examples of the user outputs
+    Abc_Cex_t *       pCex;        // the shallowest counter-example
+    int               nFailOuts;   // the number of failed outputs
+    abctime           TimeToStop;  // the wall-clock time to stop (0 = no limit)
+    pthread_mutex_t   Mutex;       // serializes reporting
+};
+
+struct Bmc3_ParGroup_t_
+{
+    Bmc3_ParMan_t *   pMan;        // the shared manager
+    Aig_Man_t *       pAig;        // the cones of the outputs in this group
+    Vec_Int_t *       vOuts;       // the user output of each output
+    Vec_Int_t *       vPis;        // the user PI of each PI
+    Saig_ParBmc_t     Pars;        // the parameters of this group
+    int               iGroup;      // the group number
+    int               iFrame;      // the frame being solved
+    volatile int      fStop;       // stop request for this group
+    int               RetValue;    // the result of this group
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the groups solving frames after the given one.]
+
+  Description [Should be called with the mutex taken. The groups solving
+  the given frame or the frames before it are not stopped. If iFrame is
+  -1, all groups are stopped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_ManBmcParStopGroups( Bmc3_ParMan_t * pMan, int iFrame )
+{
+    int k;
+    for ( k = 0; k < pMan->nGroups; k++ )
+        if ( pMan->pGroups[k].iFrame > iFrame )
+            pMan->pGroups[k].fStop = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the outputs into groups with overlapping cones.]
+
+  Description [Outputs are considered in the order of decreasing support
+  size. Each output is added to the group whose support (primary inputs
+  and flop outputs) overlaps most with its own support, as long as the
+  group does not exceed the average size by more than a quarter. This way,
+  the outputs sharing logic are solved by the same thread and this logic
+  is unrolled and translated into CNF only once.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Saig_ManBmcPartition( Aig_Man_t * pAig, int nParts )
+{
+    Vec_Ptr_t * vSupps, * vParts, * vMarks;
+    Vec_Int_t * vSupp, * vPart, * vCosts;
+    Vec_Bit_t * vMark;
+    int i, k, j, iPo, iCi, Cost, CostAll = 0, Limit, Overlap, OverlapBest, iBest;
+    vSupps = Aig_ManSupports( pAig );
+    // restore the CI/CO numbers overwritten while computing the supports
+    Aig_ManSetCioIds( pAig );
+    Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSupp, i )
+        if ( Vec_IntEntryLast(vSupp) < Saig_ManPoNum(pAig) )
+            CostAll += Vec_IntSize(vSupp);
+    Limit  = 5 * CostAll / (4 * nParts) + 1;
+    vParts = Vec_PtrAlloc( nParts );
+    vMarks = Vec_PtrAlloc( nParts );
+    vCosts = Vec_IntStart( nParts );
+    for ( k = 0; k < nParts; k++ )
+    {
+        Vec_PtrPush( vParts, Vec_IntAlloc(100) );
+        Vec_PtrPush( vMarks, Vec_BitStart(Aig_ManCiNum(pAig)) );
+    }
+    Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSupp, i )
+    {
+        iPo = Vec_IntPop( vSupp );
+        if ( iPo >= Saig_ManPoNum(pAig) )
+            continue;
+        Cost = Vec_IntSize(vSupp) + 1;
+        // find the most overlapping group, which is not too large
+        iBest = -1; OverlapBest = -1;
+        Vec_PtrForEachEntry( Vec_Bit_t *, vMarks, vMark, k )
+        {
+            if ( Vec_IntEntry(vCosts, k) > 0 && Vec_IntEntry(vCosts, k) + Cost > Limit )
+                continue;
+            Overlap = 0;
+            Vec_IntForEachEntry( vSupp, iCi, j )
+                Overlap += Vec_BitEntry( vMark, iCi );
+            if ( OverlapBest < Overlap || (OverlapBest == Overlap && Vec_IntEntry(vCosts, k) < Vec_IntEntry(vCosts, iBest)) )
+                OverlapBest = Overlap, iBest = k;
+        }
+        // otherwise, take the smallest group
+        if ( iBest == -1 )
+            for ( iBest = 0, k = 1; k < nParts; k++ )
+                if ( Vec_IntEntry(vCosts, iBest) > Vec_IntEntry(vCosts, k) )
+                    iBest = k;
+        // add the output to the group
+        vMark = (Vec_Bit_t *)Vec_PtrEntry( vMarks, iBest );
+        Vec_IntForEachEntry( vSupp, iCi, j )
+            Vec_BitWriteEntry( vMark, iCi, 1 );
+        Vec_IntPush( (Vec_Int_t *)Vec_PtrEntry(vParts, iBest), iPo );
+        Vec_IntAddToEntry( vCosts, iBest, Cost );
+    }
+    Vec_PtrForEachEntry( Vec_Bit_t *, vMarks, vMark, k )
+        Vec_BitFree( vMark );
+    Vec_PtrFree( vMarks );
+    Vec_IntFree( vCosts );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    // remove empty groups
+    k = 0;
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vPart, i )
+        if ( Vec_IntSize(vPart) == 0 )
+            Vec_IntFree( vPart );
+        else
+        {
+            Vec_IntSort( vPart, 0 );
+            Vec_PtrWriteEntry( vParts, k++, vPart );
+        }
+    Vec_PtrShrink( vParts, k );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Translates the counter-example of the group into the user AIG.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Saig_ManBmcParCex( Bmc3_ParGroup_t * pGroup, Abc_Cex_t * pCexGroup, int iPo )
+{
+    Aig_Man_t * pAig = pGroup->pMan->pAig;
+    Abc_Cex_t * pCex = Abc_CexAlloc( Aig_ManRegNum(pAig), Saig_ManPiNum(pAig), pCexGroup->iFrame + 1 );
+    int i, f, iPi;
+    pCex->iPo    = iPo;
+    pCex->iFrame = pCexGroup->iFrame;
+    for ( i = pCexGroup->nRegs; i < pCexGroup->nBits; i++ )
+        if ( Abc_InfoHasBit(pCexGroup->pData, i) )
+        {
+            f   = (i - pCexGroup->nRegs) / pCexGroup->nPis;
+            iPi = Vec_IntEntry( pGroup->vPis, (i - pCexGroup->nRegs) % pCexGroup->nPis );
+            Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + iPi );
+        }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reports the output of the group failed in the given frame.]
+
+  Description [Called by the thread solving the group, while the SAT
+  solver still holds the satisfying assignment. With "-a", the failure 
+  is printed right away using the user numbering of the outputs.
+  Otherwise, the counter-example is kept if it is shallower than the one
+  found before, and only the groups solving deeper frames are stopped, 
+  so that, as in the serial run, the shallowest counter-example is 
+  returned (the one with the smallest output number in that frame).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_ManBmcParReport( Gia_ManBmc_t * p, int f, int i )
+{
+    Bmc3_ParGroup_t * pGroup = (Bmc3_ParGroup_t *)p->pPars->pPartData;
+    Bmc3_ParMan_t * pMan = pGroup->pMan;
+    Saig_ParBmc_t * pPars = pMan->pPars;
+    Abc_Cex_t * pCex = NULL, * pCexGroup;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pMan->pAig) );
+    int iPo = Vec_IntEntry( pGroup->vOuts, i );
+    if ( !pPars->fSolveAll || pPars->fStoreCex )
+    {
+        pCexGroup = Saig_ManGenerateCex( p, f, i );
+        pCex = Saig_ManBmcParCex( pGroup, pCexGroup, iPo );
+        Abc_CexFree( pCexGroup );
+    }
+    pthread_mutex_lock( &pMan->Mutex );
+    if ( !pPars->fSolveAll )
+    {
+        if ( pMan->pCex == NULL || pMan->pCex->iFrame > f || (pMan->pCex->iFrame == f && pMan->pCex->iPo > iPo) )
+        {
+            Abc_CexFreeP( &pMan->pCex );
+            pMan->pCex = pCex, pCex = NULL;
+            pMan->nFailOuts = 1;
+            Saig_ManBmcParStopGroups( pMan, f );
+        }
+    }
+    else if ( Vec_PtrEntry(pMan->vCexes, iPo) == NULL )
+    {
+        pMan->nFailOuts++;
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                nOutDigits, iPo, f, nOutDigits, pMan->nFailOuts, nOutDigits, Saig_ManPoNum(pMan->pAig) );
+        Vec_PtrWriteEntry( pMan->vCexes, iPo, pCex ? pCex : (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+        pCex = NULL;
+        if ( pPars->pFuncOnFail && pPars->pFuncOnFail(iPo, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(pMan->vCexes, iPo) : NULL) )
+        {
+            Abc_Print( 1, "Quitting due to callback on fail.\n" );
+            Saig_ManBmcParStopGroups( pMan, -1 );
+        }
+    }
+    fflush( stdout );
+    pthread_mutex_unlock( &pMan->Mutex );
+    Abc_CexFreeP( &pCex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Connects the solver of the group to its stop flag.]
+
+  Description [The wall-clock runtime limit of the run is converted into
+  the time of the calling thread, which is measured by Abc_Clock().
+  Returns the earliest of the two limits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static abctime Saig_ManBmcParStart( Gia_ManBmc_t * p, abctime nTimeToStop )
+{
+    Bmc3_ParGroup_t * pGroup = (Bmc3_ParGroup_t *)p->pPars->pPartData;
+    Bmc3_ParMan_t * pMan = pGroup->pMan;
+    abctime nTimeToStopPar;
+    if ( p->pSat2 )
+        satoko_set_stop( p->pSat2, (int *)&pGroup->fStop );
+    else if ( p->pSat3 )
+        bmcg_sat_solver_set_stop( p->pSat3, (int *)&pGroup->fStop );
+    else
+        sat_solver_set_stop_flag( p->pSat, &pGroup->fStop );
+    if ( pMan->TimeToStop == 0 )
+        return nTimeToStop;
+    nTimeToStopPar = Abc_Clock() + Abc_MaxInt( 1, (int)(pMan->TimeToStop - Abc_ClockWall()) );
+    return (nTimeToStop && nTimeToStop < nTimeToStopPar) ? nTimeToStop : nTimeToStopPar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the threads should stop.]
+
+  Description [Called before solving each output in frame f. Records
+  the frame of the group. Checks the runtime limit using the wall clock 
+  and stops the other threads when it is reached. Without "-a", returns 
+  1 if a counter-example was found in an earlier frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcParStop( Gia_ManBmc_t * p, int f )
+{
+    Bmc3_ParGroup_t * pGroup = (Bmc3_ParGroup_t *)p->pPars->pPartData;
+    Bmc3_ParMan_t * pMan = pGroup->pMan;
+    pthread_mutex_lock( &pMan->Mutex );
+    pGroup->iFrame = f;
+    if ( pMan->TimeToStop && Abc_ClockWall() >= pMan->TimeToStop )
+        Saig_ManBmcParStopGroups( pMan, -1 );
+    if ( pMan->pCex && pMan->pCex->iFrame < f )
+        pGroup->fStop = 1;
+    pthread_mutex_unlock( &pMan->Mutex );
+    return pGroup->fStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one group of outputs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Saig_ManBmcParThread( void * pArg )
+{
+    Bmc3_ParGroup_t * pGroup = (Bmc3_ParGroup_t *)pArg;
+    Bmc3_ParMan_t * pMan = pGroup->pMan;
+    abctime clk = Abc_ClockWall();
+    pGroup->RetValue = Saig_ManBmcScalable( pGroup->pAig, &pGroup->Pars );
+    if ( pMan->pPars->fVerbose )
+    {
+        pthread_mutex_lock( &pMan->Mutex );
+        Abc_Print( 1, "Group %2d finished : Outputs =%6d. Failed =%6d. Frames =%6d. ", 
+            pGroup->iGroup, Saig_ManPoNum(pGroup->pAig), pGroup->Pars.nFailOuts, pGroup->Pars.iFrame + 1 );
+        Abc_Print( 1, "%9.2f sec\n", 1.0*(Abc_ClockWall() - clk)/CLOCKS_PER_SEC );
+        fflush( stdout );
+        pthread_mutex_unlock( &pMan->Mutex );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking of groups of outputs in parallel.]
+
+  Description [The outputs are partitioned into groups with overlapping
+  cones. The cones of each group are extracted and solved by a separate
+  thread running the same engine with its own SAT solver. Failed outputs
+  are reported as soon as they are found. Without "-a", a failure stops
+  the threads solving deeper frames, while the other threads finish the 
+  frames up to it, so that the shallowest failure is returned. The first 
+  group is solved by the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Bmc3_ParMan_t Man, * pMan = &Man;
+    Bmc3_ParGroup_t Groups[BMC3_PAR_THR_MAX];
+    pthread_t WorkerThread[BMC3_PAR_THR_MAX];
+    Vec_Ptr_t * vParts;
+    Vec_Int_t * vPart;
+    Aig_Obj_t * pObj;
+    int i, k, status, nGroups, RetValue = -1, fAllProved = 1, iFrameMin = ABC_INFINITY, iFrameMax = -1;
+    // partition the outputs
+    vParts = Saig_ManBmcPartition( pAig, Abc_MinInt(pPars->nThreads, BMC3_PAR_THR_MAX) );
+    nGroups = Vec_PtrSize( vParts );
+    if ( nGroups < 2 )
+    {
+        Vec_VecFree( (Vec_Vec_t *)vParts );
+        return Saig_ManBmcScalableSerial( pAig, pPars );
+    }
+    memset( pMan, 0, sizeof(Bmc3_ParMan_t) );
+    pMan->pAig   = pAig;
+    pMan->pPars  = pPars;
+    pMan->pGroups = Groups;
+    pMan->nGroups = nGroups;
+    pMan->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    pMan->TimeToStop = pPars->nTimeOut ? Abc_ClockWall() + pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+    pthread_mutex_init( &pMan->Mutex, NULL );
+    // extract the cones of each group
+    Vec_PtrForEachEntry( Vec_Int_t *, vParts, vPart, k )
+    {
+        Bmc3_ParGroup_t * pGroup = Groups + k;
+        Aig_ManCleanData( pAig );
+        pGroup->pMan     = pMan;
+        pGroup->pAig     = Saig_ManDupCones( pAig, Vec_IntArray(vPart), Vec_IntSize(vPart) );
+        pGroup->vOuts    = vPart;
+        pGroup->vPis     = Vec_IntStartFull( Saig_ManPiNum(pGroup->pAig) );
+        Saig_ManForEachPi( pAig, pObj, i )
+            if ( pObj->pData )
+                Vec_IntWriteEntry( pGroup->vPis, Aig_ObjCioId((Aig_Obj_t *)pObj->pData), i );
+        pGroup->iGroup   = k;
+        pGroup->iFrame   = 0;
+        pGroup->fStop    = 0;
+        pGroup->RetValue = -1;
+        // each thread works silently and reports through the shared manager
+        pGroup->Pars              = *pPars;
+        pGroup->Pars.fVerbose     = 0;
+        pGroup->Pars.fNotVerbose  = 1;
+        pGroup->Pars.fSilent      = 1;
+        pGroup->Pars.fUseBridge   = 0;
+        pGroup->Pars.nTimeOut     = 0;
+        pGroup->Pars.pLogFileName = NULL;
+        pGroup->Pars.pCheckFile   = NULL;
+        pGroup->Pars.pFuncOnFail  = NULL;
+        pGroup->Pars.pPartData    = pGroup;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Group %2d : PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n", k,
+                Saig_ManPiNum(pGroup->pAig), Saig_ManPoNum(pGroup->pAig), Saig_ManRegNum(pGroup->pAig),
+                Aig_ManNodeNum(pGroup->pAig), Aig_ManLevelNum(pGroup->pAig) );
+    }
+    Aig_ManCleanData( pAig );
+    Vec_PtrFree( vParts );
+    // solve the groups
+    for ( k = 1; k < nGroups; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Saig_ManBmcParThread, (void *)(Groups + k) );  assert( status == 0 );
+    }
+    Saig_ManBmcParThread( (void *)Groups );
+    for ( k = 1; k < nGroups; k++ )
+        pthread_join( WorkerThread[k], NULL );
+    if ( pMan->TimeToStop && Abc_ClockWall() >= pMan->TimeToStop && !pPars->fSilent )
+        Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+    // collect the results; the groups without unsolved outputs do not limit the explored frames
+    pPars->nDropOuts = 0;
+    for ( k = 0; k < nGroups; k++ )
+    {
+        fAllProved &= (Groups[k].RetValue == 1);
+        if ( Groups[k].Pars.nFailOuts + Groups[k].Pars.nDropOuts < Saig_ManPoNum(Groups[k].pAig) )
+            iFrameMin = Abc_MinInt( iFrameMin, Groups[k].Pars.iFrame );
+        iFrameMax = Abc_MaxInt( iFrameMax, Groups[k].Pars.iFrame );
+        pPars->nDropOuts += Groups[k].Pars.nDropOuts;
+        Vec_IntFree( Groups[k].vOuts );
+        Vec_IntFree( Groups[k].vPis );
+        Aig_ManStop( Groups[k].pAig );
+    }
+    pPars->iFrame    = iFrameMin < ABC_INFINITY ? iFrameMin : iFrameMax;
+    pPars->nFailOuts = pMan->nFailOuts;
+    if ( pMan->nFailOuts )
+        RetValue = 0;
+    else if ( fAllProved )
+        RetValue = 1;
+    if ( pMan->pCex )
+    {
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = pMan->pCex;
+    }
+    if ( pPars->fSolveAll )
+    {
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = pMan->vCexes;
+    }
+    else
+        Vec_PtrFree( pMan->vCexes );
+    pthread_mutex_destroy( &pMan->Mutex );
+    fflush( stdout );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -255,7 +255,8 @@ Abc_Cex_t * Bmc_CexCareMinimizeAig( Gia_Man_t * p, int nRealPis, Abc_Cex_t * pCe
 {
     //int nTryCexes = 4; // belongs to range [1;4]
     Abc_Cex_t * pCexBest, * pCexMin[4] = {NULL};
-    int k, f, i, nOnesBest, nOnesCur, Counter = 0;
+    int k, f, i, iBest, nOnesBest, nOnesCur, Counter = 0;
+    word Mask;
     Vec_Int_t * vPriosIn, * vPriosFf;
     if ( pCex->nPis != Gia_ManPiNum(p) )
     {
@@ -390,20 +391,22 @@ Abc_Cex_t * Bmc_CexCareMinimizeAig( Gia_Man_t * p, int nRealPis, Abc_Cex_t * pCe
     }
     Vec_IntFree( vPriosIn );
     Vec_IntFree( vPriosFf );
-    // select the best one
-    pCexBest  = pCexMin[0];
+    // verify all of them at once and select the best verified one
+    Mask      = Bmc_CexTerVerify( p, pCex, pCexMin, nTryCexes );
+    iBest     = 0;
     nOnesBest = Abc_CexCountOnes(pCexMin[0]);
     for ( k = 1; k < nTryCexes; k++ )
     {
         if ( pCexMin[k] == NULL )
             continue;
         nOnesCur = Abc_CexCountOnes(pCexMin[k]);
-        if ( nOnesBest > nOnesCur )
+        if ( ((Mask >> iBest) & 1) == ((Mask >> k) & 1) ? nOnesBest > nOnesCur : ((Mask >> k) & 1) )
         {
             nOnesBest = nOnesCur;
-            pCexBest  = pCexMin[k];
+            iBest     = k;
         }
     }
+    pCexBest = pCexMin[iBest];
     if ( fVerbose )
     {
         //Abc_Cex_t * pTotal = Bmc_CexCareTotal( pCexMin, nTryCexes );
@@ -416,8 +419,8 @@ Abc_Cex_t * Bmc_CexCareMinimizeAig( Gia_Man_t * p, int nRealPis, Abc_Cex_t * pCe
     for ( k = 0; k < nTryCexes; k++ )
         if ( pCexMin[k] && pCexBest != pCexMin[k] )
             Abc_CexFreeP( &pCexMin[k] );
-    // verify and return
-    if ( !Bmc_CexVerify( p, pCex, pCexBest ) )
+    // report verification and return
+    if ( !((Mask >> iBest) & 1) )
         printf( "Counter-example verification has failed.\n" );
     else if ( fCheck ) 
         printf( "Counter-example verification succeeded.\n" );
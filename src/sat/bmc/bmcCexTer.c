@@ -0,0 +1,240 @@
+/**CFile****************************************************************
+
+  FileName    [bmcCexTer.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Bit-parallel ternary simulation of counter-examples.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: bmcCexTer.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// each object has two words: the lanes where it can be 0 and the lanes where it can be 1
+// (lanes where it can be both are X; lanes where it can be neither do not occur)
+static inline word * Bmc_TerSim( Vec_Wrd_t * vSims, int iObj )           { return Vec_WrdEntryP( vSims, 2 * iObj );       }
+static inline word   Bmc_TerSimX( Vec_Wrd_t * vSims, int iObj )          { word * pSim = Bmc_TerSim(vSims, iObj); return pSim[0] & pSim[1]; }
+static inline word   Bmc_TerSim1( Vec_Wrd_t * vSims, int iObj )          { word * pSim = Bmc_TerSim(vSims, iObj); return ~pSim[0] & pSim[1]; }
+
+static inline void Bmc_TerSimSet( Vec_Wrd_t * vSims, int iObj, int Value, word Xs )
+{
+    word * pSim = Bmc_TerSim( vSims, iObj );
+    pSim[0] = (Value ? 0 : ~(word)0) | Xs;
+    pSim[1] = (Value ? ~(word)0 : 0) | Xs;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes and the COs of one frame.]
+
+  Description [The CIs should be assigned before calling this procedure.
+  Each AND gate is computed using three bitwise operations for 64 lanes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_CexTerSimFrame( Gia_Man_t * p, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1;
+    int k;
+    Gia_ManForEachAnd( p, pObj, k )
+    {
+        pSim  = Bmc_TerSim( vSims, k );
+        pSim0 = Bmc_TerSim( vSims, Gia_ObjFaninId0(pObj, k) );
+        pSim1 = Bmc_TerSim( vSims, Gia_ObjFaninId1(pObj, k) );
+        pSim[0] = pSim0[Gia_ObjFaninC0(pObj)] | pSim1[Gia_ObjFaninC1(pObj)];
+        pSim[1] = pSim0[!Gia_ObjFaninC0(pObj)] & pSim1[!Gia_ObjFaninC1(pObj)];
+    }
+    Gia_ManForEachCo( p, pObj, k )
+    {
+        pSim  = Bmc_TerSim( vSims, Gia_ObjId(p, pObj) );
+        pSim0 = Bmc_TerSim( vSims, Gia_ObjFaninId0p(p, pObj) );
+        pSim[0] = pSim0[Gia_ObjFaninC0(pObj)];
+        pSim[1] = pSim0[!Gia_ObjFaninC0(pObj)];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the simulation info.]
+
+  Description [Assigns constant 0 to the constant node and to the flop
+  inputs, which represent the initial state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Bmc_CexTerStart( Gia_Man_t * p )
+{
+    Vec_Wrd_t * vSims = Vec_WrdStart( 2 * Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj;
+    int k;
+    Bmc_TerSimSet( vSims, 0, 0, 0 );
+    Gia_ManForEachRi( p, pObj, k )
+        Bmc_TerSimSet( vSims, Gia_ObjId(p, pObj), 0, 0 );
+    return vSims;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies several care sets of the counter-example.]
+
+  Description [Simulates the counter-example, in which the bits not
+  in the care set are replaced by X, with one lane for each care set.
+  Returns the mask of lanes in which the failed output is 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Bmc_CexTerVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t ** ppCexCare, int nCexes )
+{
+    Vec_Wrd_t * vSims = Bmc_CexTerStart( p );
+    Gia_Obj_t * pObj, * pObjRi, * pObjRo;
+    word Xs, Res;
+    int i, k, c, iBit;
+    assert( nCexes >= 1 && nCexes <= 64 );
+    for ( i = 0; i <= pCex->iFrame; i++ )
+    {
+        Gia_ManForEachPi( p, pObj, k )
+        {
+            Xs = 0;
+            for ( c = 0; c < nCexes; c++ )
+            {
+                iBit = ppCexCare[c]->nRegs + i * ppCexCare[c]->nPis + k;
+                if ( !Abc_InfoHasBit( ppCexCare[c]->pData, iBit ) )
+                    Xs |= (word)1 << c;
+            }
+            Bmc_TerSimSet( vSims, Gia_ObjId(p, pObj), Abc_InfoHasBit(pCex->pData, pCex->nRegs + i * pCex->nPis + k), Xs );
+        }
+        Gia_ManForEachRiRo( p, pObjRi, pObjRo, k )
+        {
+            word * pSimRi = Bmc_TerSim( vSims, Gia_ObjId(p, pObjRi) );
+            word * pSimRo = Bmc_TerSim( vSims, Gia_ObjId(p, pObjRo) );
+            pSimRo[0] = pSimRi[0];
+            pSimRo[1] = pSimRi[1];
+        }
+        Bmc_CexTerSimFrame( p, vSims );
+    }
+    Res = Bmc_TerSim1( vSims, Gia_ObjId(p, Gia_ManPo(p, pCex->iPo)) );
+    Vec_WrdFree( vSims );
+    return nCexes == 64 ? Res : Res & ((((word)1) << nCexes) - 1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes essential bits of the CEX.]
+
+  Description [The CEX is given by the values of all CIs in each frame
+  (pCexState). A care PI bit is essential if the failed output becomes
+  X when this bit is replaced by X. The bits are checked in groups of 64,
+  one bit per lane. Simulation of a group starts in the earliest frame
+  of its bits and stops as soon as the flops do not have X-values after
+  the last frame of its bits. The state bits of the care set are copied
+  into the result.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Bmc_CexTerEssentialBits( Gia_Man_t * p, Abc_Cex_t * pCexState, Abc_Cex_t * pCexCare )
+{
+    Abc_Cex_t * pNew;
+    Vec_Wrd_t * vSims = Vec_WrdStart( 2 * Gia_ManObjNum(p) );
+    Vec_Int_t * vBits = Vec_IntAlloc( 64 );
+    Gia_Obj_t * pObj, * pObjRi;
+    word Xs, XsRo, Res;
+    int b, c, i, k, iStart, iStop, iLane, nPis = Gia_ManPiNum(p);
+    assert( pCexState->nRegs == 0 );
+    assert( pCexState->nPis == Gia_ManCiNum(p) );
+    assert( pCexState->nBits == pCexCare->nBits );
+    // start the counter-example
+    pNew = Abc_CexAlloc( 0, Gia_ManCiNum(p), pCexState->iFrame + 1 );
+    pNew->iFrame = pCexState->iFrame;
+    pNew->iPo    = pCexState->iPo;
+    Bmc_TerSimSet( vSims, 0, 0, 0 );
+    for ( b = 0; b < pCexState->nBits; )
+    {
+        // collect the next group of care PI bits
+        Vec_IntClear( vBits );
+        for ( ; b < pCexState->nBits && Vec_IntSize(vBits) < 64; b++ )
+        {
+            if ( !Abc_InfoHasBit(pCexCare->pData, b) )
+                continue;
+            if ( b % pCexState->nPis >= nPis )
+                Abc_InfoSetBit( pNew->pData, b );
+            else
+                Vec_IntPush( vBits, b );
+        }
+        if ( Vec_IntSize(vBits) == 0 )
+            break;
+        iStart = Vec_IntEntry( vBits, 0 ) / pCexState->nPis;
+        iStop  = Vec_IntEntryLast( vBits ) / pCexState->nPis;
+        // simulate the frames
+        Gia_ManForEachRi( p, pObjRi, k )
+            Bmc_TerSimSet( vSims, Gia_ObjId(p, pObjRi), 0, 0 );
+        for ( iLane = 0, i = iStart; i <= pCexState->iFrame; i++ )
+        {
+            XsRo = 0;
+            Gia_ManForEachCi( p, pObj, k )
+            {
+                Xs = k < nPis ? 0 : Bmc_TerSimX( vSims, Gia_ObjId(p, Gia_ObjRoToRi(p, pObj)) );
+                for ( ; iLane < Vec_IntSize(vBits) && Vec_IntEntry(vBits, iLane) == i * pCexState->nPis + k; iLane++ )
+                    Xs |= (word)1 << iLane;
+                XsRo |= k < nPis ? 0 : Xs;
+                Bmc_TerSimSet( vSims, Gia_ObjId(p, pObj), Abc_InfoHasBit(pCexState->pData, i * pCexState->nPis + k), Xs );
+            }
+            // the remaining frames cannot produce an X at the output
+            if ( i > iStop && XsRo == 0 )
+                break;
+            Bmc_CexTerSimFrame( p, vSims );
+        }
+        assert( iLane == Vec_IntSize(vBits) );
+        if ( i <= pCexState->iFrame )
+            continue;
+        // record the bits for which the output became X
+        Res = Bmc_TerSimX( vSims, Gia_ObjId(p, Gia_ManPo(p, pCexState->iPo)) );
+        for ( c = 0; c < Vec_IntSize(vBits); c++ )
+            if ( (Res >> c) & 1 )
+                Abc_InfoSetBit( pNew->pData, Vec_IntEntry(vBits, c) );
+    }
+    Vec_IntFree( vBits );
+    Vec_WrdFree( vSims );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
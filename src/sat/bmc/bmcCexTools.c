@@ -345,33 +345,7 @@ void Bmc_CexPrint( Abc_Cex_t * pCex, int nRealPis, int fVerbose )
 ***********************************************************************/
 int Bmc_CexVerify( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare )
 {
-    Gia_Obj_t * pObj;
-    int i, k;
-//    assert( pCex->nRegs > 0 );
-//    assert( pCexCare->nRegs == 0 );
-    Gia_ObjTerSimSet0( Gia_ManConst0(p) );
-    Gia_ManForEachRi( p, pObj, k )
-        Gia_ObjTerSimSet0( pObj );
-    for ( i = 0; i <= pCex->iFrame; i++ )
-    {
-        Gia_ManForEachPi( p, pObj, k )
-        {
-            if ( !Abc_InfoHasBit( pCexCare->pData, pCexCare->nRegs + i * pCexCare->nPis + k ) )
-                Gia_ObjTerSimSetX( pObj );
-            else if ( Abc_InfoHasBit( pCex->pData, pCex->nRegs + i * pCex->nPis + k ) )
-                Gia_ObjTerSimSet1( pObj );
-            else
-                Gia_ObjTerSimSet0( pObj );
-        }
-        Gia_ManForEachRo( p, pObj, k )
-            Gia_ObjTerSimRo( p, pObj );
-        Gia_ManForEachAnd( p, pObj, k )
-            Gia_ObjTerSimAnd( pObj );
-        Gia_ManForEachCo( p, pObj, k )
-            Gia_ObjTerSimCo( pObj );
-    }
-    pObj = Gia_ManPo( p, pCex->iPo );
-    return Gia_ObjTerSimGet1(pObj);
+    return (int)(Bmc_CexTerVerify( p, pCex, &pCexCare, 1 ) & 1);
 }
 
 /**Function*************************************************************
@@ -754,47 +728,11 @@ void Bmc_CexEssentialBitTest( Gia_Man_t * p, Abc_Cex_t * pCexState )
 ***********************************************************************/
 Abc_Cex_t * Bmc_CexEssentialBits( Gia_Man_t * p, Abc_Cex_t * pCexState, Abc_Cex_t * pCexCare, int fVerbose )
 {
-    Abc_Cex_t * pNew, * pTemp, * pPrev = NULL;
-    int b, fEqual = 0, fPrevStatus = 0;
+    Abc_Cex_t * pNew;
 //    abctime clk = Abc_Clock();
     assert( pCexState->nBits == pCexCare->nBits );
-    // start the counter-example
-    pNew = Abc_CexAlloc( 0, Gia_ManCiNum(p), pCexState->iFrame + 1 );
-    pNew->iFrame = pCexState->iFrame;
-    pNew->iPo    = pCexState->iPo;
-    // iterate through care-bits
-    for ( b = 0; b < pCexState->nBits; b++ )
-    {
-        // skip don't-care bits
-        if ( !Abc_InfoHasBit(pCexCare->pData, b) )
-            continue;
-
-        // skip state bits
-        if ( b % pCexCare->nPis >= Gia_ManPiNum(p) )
-        {
-            Abc_InfoSetBit( pNew->pData, b );
-            continue;
-        }
-
-        // check if this is an essential bit
-        pTemp = Bmc_CexEssentialBitOne( p, pCexState, b, pPrev, &fEqual );
-//        pTemp = Bmc_CexEssentialBitOne( p, pCexState, b, NULL, &fEqual );
-        if ( pTemp == NULL )
-        {
-            if ( fEqual && fPrevStatus )
-                Abc_InfoSetBit( pNew->pData, b );
-            continue;
-        }
-//        Bmc_CexPrint( pTemp, Gia_ManPiNum(p), fVerbose );
-        Abc_CexFree( pPrev );
-        pPrev = pTemp;
-
-        // record essential bit
-        fPrevStatus = !Gia_ManPo(p, pCexState->iPo)->fMark1;
-        if ( !Gia_ManPo(p, pCexState->iPo)->fMark1 )
-            Abc_InfoSetBit( pNew->pData, b );
-    }
-    Abc_CexFreeP( &pPrev );
+    // check 64 care bits at a time
+    pNew = Bmc_CexTerEssentialBits( p, pCexState, pCexCare );
 //    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     printf( "Essentials:   " );
     Bmc_CexPrint( pNew, Gia_ManPiNum(p), fVerbose );
@@ -0,0 +1,494 @@
+/**CFile****************************************************************
+
+  FileName    [bmcPort.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio of SAT solvers for hard queries.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: bmcPort.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define BMC_PORT_ENGS    3      // the number of different engines
+#define BMC_PORT_PROCS  64      // the largest number of threads
+
+static char * s_PortEngNames[BMC_PORT_ENGS] = { "bsat", "satoko", "glucose" };
+
+// portfolio parameters (the portfolio is disabled when nProcs is 0)
+static Bmc_PortPar_t s_PortPars = { 0, 0, 0, 0 };
+
+// statistics collected over all queries
+typedef struct Bmc_PortStats_t_ Bmc_PortStats_t;
+struct Bmc_PortStats_t_
+{
+    int            nCalls;      // queries undecided by the primary solver
+    int            nSolved;     // queries solved by the portfolio
+    int            nSat;        // satisfiable queries
+    int            nUnsat;      // unsatisfiable queries
+    int            nWins[BMC_PORT_ENGS]; // the number of wins of each engine
+    abctime        timeTotal;   // wall-clock time of the portfolio
+};
+static Bmc_PortStats_t s_PortStats;
+
+#ifdef ABC_USE_PTHREADS
+
+// protects the statistics
+static pthread_mutex_t s_PortMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// the problem shared by the threads
+typedef struct Bmc_PortRun_t_ Bmc_PortRun_t;
+struct Bmc_PortRun_t_
+{
+    int            nVars;       // the number of variables
+    Vec_Int_t *    vCnf;        // clauses (the size followed by the literals)
+    Vec_Int_t *    vStarts;     // the beginning of each clause in vCnf
+    volatile int   fStop;       // the stop flag of this run
+    int            nConfLimit;  // conflict limit of each engine
+    abctime        TimeOut;     // runtime limit of each engine
+    int            Status;      // the answer of the winner
+    int            iWinner;     // the thread that produced the answer
+    int *          pModel;      // the satisfying assignment
+    abctime        timeMax;     // the largest runtime of a thread
+    pthread_mutex_t Mutex;      // protects the answer
+};
+
+// the data of one thread
+typedef struct Bmc_PortThData_t_ Bmc_PortThData_t;
+struct Bmc_PortThData_t_
+{
+    Bmc_PortRun_t * pRun;       // the shared problem
+    int            iThread;     // the thread number
+    int            iEngine;     // the engine used
+    int            iConfig;     // the configuration of the engine
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets and reads the portfolio parameters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortSetParams( Bmc_PortPar_t * pPars )
+{
+    s_PortPars = *pPars;
+    if ( s_PortPars.nProcs > BMC_PORT_PROCS )
+        s_PortPars.nProcs = BMC_PORT_PROCS;
+}
+Bmc_PortPar_t * Bmc_PortReadParams()
+{
+    return &s_PortPars;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints and resets the portfolio statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_PortPrintStats()
+{
+    int i;
+    printf( "Portfolio: Procs = %d. Conf = %d. Time = %d sec.  ", s_PortPars.nProcs, s_PortPars.nConfLimit, s_PortPars.TimeOut );
+    printf( "Queries = %d. Solved = %d. (Sat = %d. Unsat = %d.)\n", s_PortStats.nCalls, s_PortStats.nSolved, s_PortStats.nSat, s_PortStats.nUnsat );
+    for ( i = 0; i < BMC_PORT_ENGS; i++ )
+        printf( "Engine %-8s : Wins = %6d.\n", s_PortEngNames[i], s_PortStats.nWins[i] );
+    ABC_PRT( "Time", s_PortStats.timeTotal );
+}
+void Bmc_PortResetStats()
+{
+    memset( &s_PortStats, 0, sizeof(Bmc_PortStats_t) );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Bmc_PortSolve( sat_solver * pSat, lit * pBeg, lit * pEnd, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit )
+{
+    return sat_solver_solve( pSat, pBeg, pEnd, nConfLimit, nInsLimit, 0, 0 );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the CNF of the solver.]
+
+  Description [Includes the original clauses, the two-literal clauses
+  kept only in the watch lists, the zero-level assignments and the
+  assumptions as unit clauses.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_PortCollectCnf( sat_solver * pSat, lit * pBeg, lit * pEnd, Vec_Int_t * vCnf, Vec_Int_t * vStarts )
+{
+    Sat_Mem_t * pMem = &pSat->Mem;
+    clause * c;
+    lit * pLit;
+    int i, k, m, * pWatch;
+    Sat_MemForEachClause( pMem, c, i, k )
+    {
+        Vec_IntPush( vStarts, Vec_IntSize(vCnf) );
+        Vec_IntPush( vCnf, clause_size(c) );
+        for ( m = 0; m < clause_size(c); m++ )
+            Vec_IntPush( vCnf, clause_begin(c)[m] );
+    }
+    for ( i = 0; i < 2 * pSat->size; i++ )
+    {
+        // the clause (!i + Lit) is in the watch list of literal i
+        pWatch = veci_begin( &pSat->wlists[i] );
+        for ( k = 0; k < veci_size( &pSat->wlists[i] ); k++ )
+            if ( clause_is_lit(pWatch[k]) && lit_neg(i) < clause_read_lit(pWatch[k]) )
+            {
+                Vec_IntPush( vStarts, Vec_IntSize(vCnf) );
+                Vec_IntPush( vCnf, 2 );
+                Vec_IntPush( vCnf, lit_neg(i) );
+                Vec_IntPush( vCnf, clause_read_lit(pWatch[k]) );
+            }
+    }
+    for ( i = 0; i < pSat->size; i++ )
+        if ( pSat->levels[i] == 0 && pSat->assigns[i] != 3 )
+        {
+            Vec_IntPush( vStarts, Vec_IntSize(vCnf) );
+            Vec_IntPush( vCnf, 1 );
+            Vec_IntPush( vCnf, Abc_Var2Lit(i, pSat->assigns[i] == 1) );
+        }
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+    {
+        Vec_IntPush( vStarts, Vec_IntSize(vCnf) );
+        Vec_IntPush( vCnf, 1 );
+        Vec_IntPush( vCnf, *pLit );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the clause added in the given order.]
+
+  Description [Configurations differ in the order of clauses, which
+  changes the watch lists and the initial variable order. The literals
+  are copied because the solvers sort them in place.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Bmc_PortClause( Bmc_PortRun_t * p, int iConfig, int i, Vec_Int_t * vLits )
+{
+    int nClauses = Vec_IntSize(p->vStarts);
+    int iClause  = (iConfig & 1) ? nClauses - 1 - i : i;
+    int * pClause = Vec_IntEntryP( p->vCnf, Vec_IntEntry(p->vStarts, iClause) );
+    int k;
+    Vec_IntClear( vLits );
+    for ( k = 1; k <= pClause[0]; k++ )
+        Vec_IntPush( vLits, pClause[k] );
+    return Vec_IntArray( vLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine on the problem.]
+
+  Description [Returns the status and fills in the model if satisfiable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortRunBsat( Bmc_PortRun_t * p, int iConfig, int * pModel )
+{
+    sat_solver * pSat = sat_solver_new();
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    int i, * pLits, status = l_Undef;
+    sat_solver_setnvars( pSat, p->nVars );
+    pSat->random_seed = 91648253 + 7919 * iConfig;
+    for ( i = 0; i < Vec_IntSize(p->vStarts); i++ )
+    {
+        pLits = Bmc_PortClause( p, iConfig, i, vLits );
+        if ( !sat_solver_addclause( pSat, pLits, pLits + Vec_IntSize(vLits) ) )
+            break;
+    }
+    if ( i < Vec_IntSize(p->vStarts) )
+        status = l_False;
+    else
+    {
+        sat_solver_set_stop_flag( pSat, &p->fStop );
+        if ( p->TimeOut )
+            sat_solver_set_runtime_limit( pSat, p->TimeOut + Abc_Clock() );
+        status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+    }
+    if ( status == l_True )
+        for ( i = 0; i < p->nVars; i++ )
+            pModel[i] = sat_solver_var_value( pSat, i );
+    Vec_IntFree( vLits );
+    sat_solver_delete( pSat );
+    return status == l_True ? 1 : (status == l_False ? -1 : 0);
+}
+static int Bmc_PortRunSatoko( Bmc_PortRun_t * p, int iConfig, int * pModel )
+{
+    satoko_opts_t opts;
+    satoko_t * pSat = satoko_create();
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    int i, * pLits, status = SATOKO_UNDEC;
+    satoko_default_opts( &opts );
+    if ( iConfig & 2 )
+        opts.var_decay = 0.90;
+    if ( iConfig & 4 )
+        opts.f_rst = 0.9;
+    satoko_configure( pSat, &opts );
+    satoko_setnvars( pSat, p->nVars );
+    for ( i = 0; i < Vec_IntSize(p->vStarts); i++ )
+    {
+        pLits = Bmc_PortClause( p, iConfig, i, vLits );
+        if ( !satoko_add_clause( pSat, pLits, Vec_IntSize(vLits) ) )
+            break;
+    }
+    if ( i < Vec_IntSize(p->vStarts) )
+        status = SATOKO_UNSAT;
+    else
+    {
+        satoko_set_stop( pSat, (int *)&p->fStop );
+        if ( p->TimeOut )
+            satoko_set_runtime_limit( pSat, p->TimeOut + Abc_Clock() );
+        status = satoko_solve_assumptions_limit( pSat, NULL, 0, p->nConfLimit );
+    }
+    if ( status == SATOKO_SAT )
+        for ( i = 0; i < p->nVars; i++ )
+            pModel[i] = satoko_read_cex_varvalue( pSat, i );
+    Vec_IntFree( vLits );
+    satoko_destroy( pSat );
+    return status;
+}
+static int Bmc_PortRunGlucose( Bmc_PortRun_t * p, int iConfig, int * pModel )
+{
+    bmcg_sat_solver * pSat = bmcg_sat_solver_start();
+    Vec_Int_t * vLits = Vec_IntAlloc( 100 );
+    int i, * pLits, status = 0;
+    bmcg_sat_solver_set_nvars( pSat, p->nVars );
+    for ( i = 0; i < Vec_IntSize(p->vStarts); i++ )
+    {
+        pLits = Bmc_PortClause( p, iConfig, i, vLits );
+        if ( !bmcg_sat_solver_addclause( pSat, pLits, Vec_IntSize(vLits) ) )
+            break;
+    }
+    if ( i < Vec_IntSize(p->vStarts) )
+        status = -1;
+    else
+    {
+        bmcg_sat_solver_set_stop( pSat, (int *)&p->fStop );
+        bmcg_sat_solver_set_conflict_budget( pSat, p->nConfLimit );
+        if ( p->TimeOut )
+            bmcg_sat_solver_set_runtime_limit( pSat, p->TimeOut + Abc_Clock() );
+        status = bmcg_sat_solver_solve( pSat, NULL, 0 );
+    }
+    if ( status == 1 )
+        for ( i = 0; i < p->nVars; i++ )
+            pModel[i] = bmcg_sat_solver_read_cex_varvalue( pSat, i );
+    Vec_IntFree( vLits );
+    bmcg_sat_solver_stop( pSat );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Thread procedure.]
+
+  Description [The first thread with a definite answer records it
+  and raises the stop flag, which cancels the other threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Bmc_PortWorkerThread( void * pArg )
+{
+    Bmc_PortThData_t * pThData = (Bmc_PortThData_t *)pArg;
+    Bmc_PortRun_t * p = pThData->pRun;
+    int * pModel = ABC_CALLOC( int, p->nVars ), status;
+    abctime clk = Abc_Clock();
+    if ( pThData->iEngine == 0 )
+        status = Bmc_PortRunBsat( p, pThData->iConfig, pModel );
+    else if ( pThData->iEngine == 1 )
+        status = Bmc_PortRunSatoko( p, pThData->iConfig, pModel );
+    else
+        status = Bmc_PortRunGlucose( p, pThData->iConfig, pModel );
+    pthread_mutex_lock( &p->Mutex );
+    if ( status != 0 && p->iWinner == -1 )
+    {
+        p->iWinner = pThData->iThread;
+        p->Status  = status;
+        if ( status == 1 )
+            memcpy( p->pModel, pModel, sizeof(int) * p->nVars );
+        p->fStop   = 1;
+    }
+    if ( p->timeMax < Abc_Clock() - clk )
+        p->timeMax = Abc_Clock() - clk;
+    pthread_mutex_unlock( &p->Mutex );
+    ABC_FREE( pModel );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Races the engines on the problem.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT) or 0 (undecided).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_PortRace( Bmc_PortRun_t * p, int * piEngine )
+{
+    Bmc_PortThData_t ThData[BMC_PORT_PROCS];
+    pthread_t WorkerThread[BMC_PORT_PROCS];
+    int i, status, nProcs = s_PortPars.nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pRun    = p;
+        ThData[i].iThread = i;
+        ThData[i].iEngine = i % BMC_PORT_ENGS;
+        ThData[i].iConfig = i / BMC_PORT_ENGS;
+        status = pthread_create( WorkerThread + i, NULL, Bmc_PortWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    *piEngine = p->iWinner >= 0 ? ThData[p->iWinner].iEngine : -1;
+    return p->Status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem with escalation to the portfolio.]
+
+  Description [Has the same interface as sat_solver_solve() with local
+  resource limits. If the solver gives up because of the limits and the
+  portfolio is enabled, the problem (original clauses, zero-level
+  assignments and assumptions) is solved by several engines running
+  in parallel. If the portfolio finds a satisfying assignment, it is
+  written into the solver, so that sat_solver_var_value() can be used.
+  The final conflict clause is not available when the portfolio
+  proves the problem unsatisfiable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_PortSolve( sat_solver * pSat, lit * pBeg, lit * pEnd, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit )
+{
+    Bmc_PortRun_t Run, * p = &Run;
+    int i, status, iEngine;
+    status = sat_solver_solve( pSat, pBeg, pEnd, nConfLimit, nInsLimit, 0, 0 );
+    if ( status != l_Undef || s_PortPars.nProcs == 0 )
+        return status;
+    // escalate only if the resource limit is reached
+    if ( !(pSat->nConfLimit && pSat->stats.conflicts > pSat->nConfLimit) &&
+         !(pSat->nInsLimit  && pSat->stats.propagations > pSat->nInsLimit) )
+        return status;
+    if ( pSat->nRuntimeLimit && Abc_Clock() > pSat->nRuntimeLimit )
+        return status;
+    // collect the problem
+    memset( p, 0, sizeof(Bmc_PortRun_t) );
+    p->nVars      = pSat->size;
+    p->vCnf       = Vec_IntAlloc( 4 * pSat->size );
+    p->vStarts    = Vec_IntAlloc( 2 * pSat->size );
+    p->nConfLimit = s_PortPars.nConfLimit;
+    p->TimeOut    = s_PortPars.TimeOut * CLOCKS_PER_SEC;
+    if ( pSat->nRuntimeLimit && (p->TimeOut == 0 || p->TimeOut > pSat->nRuntimeLimit - Abc_Clock()) )
+        p->TimeOut = pSat->nRuntimeLimit - Abc_Clock();
+    p->iWinner    = -1;
+    p->pModel     = ABC_CALLOC( int, p->nVars );
+    Bmc_PortCollectCnf( pSat, pBeg, pEnd, p->vCnf, p->vStarts );
+    pthread_mutex_init( &p->Mutex, NULL );
+    // race the engines
+    status = Bmc_PortRace( p, &iEngine );
+    if ( status == 1 )
+        for ( i = 0; i < p->nVars; i++ )
+            pSat->model[i] = p->pModel[i] ? l_True : l_False;
+    // update statistics
+    pthread_mutex_lock( &s_PortMutex );
+    s_PortStats.nCalls++;
+    s_PortStats.nSolved += (status != 0);
+    s_PortStats.nSat    += (status == 1);
+    s_PortStats.nUnsat  += (status == -1);
+    if ( iEngine >= 0 )
+        s_PortStats.nWins[iEngine]++;
+    s_PortStats.timeTotal += p->timeMax;
+    pthread_mutex_unlock( &s_PortMutex );
+    if ( s_PortPars.fVerbose )
+    {
+        printf( "Portfolio: Vars = %7d. Clauses = %8d. ", p->nVars, Vec_IntSize(p->vStarts) );
+        printf( "Result = %s", status == 1 ? "SAT  " : (status == -1 ? "UNSAT" : "UNDEC") );
+        printf( " by %-8s", iEngine >= 0 ? s_PortEngNames[iEngine] : "none" );
+        ABC_PRT( "  Time", p->timeMax );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    Vec_IntFree( p->vCnf );
+    Vec_IntFree( p->vStarts );
+    ABC_FREE( p->pModel );
+    return status == 1 ? l_True : (status == -1 ? l_False : l_Undef);
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
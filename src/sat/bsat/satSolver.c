@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "satSolver.h"
 #include "satStore.h"
+#include "misc/util/utilSatStat.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1382,6 +1383,9 @@ void sat_solver_restart( sat_solver* s )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nInproNext = s->nInproConfs;
+    s->nInproProps = 0;
+    s->iInproLearnt = 0;
 
     // initialize other vars
     s->size                   = 0;
@@ -1428,6 +1432,9 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nInproNext = s->nInproConfs;
+    s->nInproProps = 0;
+    s->iInproLearnt = 0;
 
     // initialize other vars
     s->size                   = 0;
@@ -1502,6 +1509,73 @@ int sat_solver_simplify(sat_solver* s)
     return true;
 }
 
+// removes learned clauses marked for deletion and compacts the learned clause memory
+static void sat_solver_remove_marked(sat_solver* s)
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    int * act_clas = veci_begin(&s->act_clas);
+    int * pArray;
+    int i, k, j, Counter;
+    clause * c;
+
+    // compact clause activities
+    j = 0;
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        if ( !c->mark )
+            act_clas[j++] = act_clas[clause_id(c)];
+        else
+        {
+            s->stats.learnts_literals -= clause_size(c);
+            s->stats.learnts--;
+        }
+    }
+    assert( s->stats.learnts == (unsigned)j );
+    veci_resize(&s->act_clas,j);
+
+    // update ID of each clause to be its new handle
+    Counter = Sat_MemCompactLearned( pMem, 0 );
+    assert( Counter == (int)s->stats.learnts );
+
+    // update reasons
+    for ( i = 0; i < s->size; i++ )
+    {
+        if ( !s->reasons[i] ) // no reason
+            continue;
+        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
+            continue;
+        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
+            continue;
+        c = clause_read( s, s->reasons[i] );
+        assert( c->mark == 0 );
+        s->reasons[i] = clause_id(c); // updating handle here!!!
+    }
+
+    // update watches
+    for ( i = 0; i < s->size*2; i++ )
+    {
+        pArray = veci_begin(&s->wlists[i]);
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        {
+            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
+                pArray[j++] = pArray[k];
+            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+                pArray[j++] = pArray[k];
+            else 
+            {
+                c = clause_read(s, pArray[k]);
+                if ( !c->mark ) // useful learned clause
+                   pArray[j++] = clause_id(c); // updating handle here!!!
+            }
+        }
+        veci_resize(&s->wlists[i],j);
+    }
+
+    // perform final move of the clauses
+    Counter = Sat_MemCompactLearned( pMem, 1 );
+    assert( Counter == (int)s->stats.learnts );
+}
+
 void sat_solver_reducedb(sat_solver* s)
 {
     static abctime TimeTotal = 0;
@@ -1509,8 +1583,8 @@ void sat_solver_reducedb(sat_solver* s)
     Sat_Mem_t * pMem = &s->Mem;
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
-    int * pPerm, * pArray, * pSortValues, nCutoffValue;
-    int i, k, j, Id, Counter, CounterStart, nSelected;
+    int * pPerm, * pSortValues, nCutoffValue;
+    int i, k, Id, Counter, CounterStart, nSelected;
     clause * c;
 
     assert( s->nLearntMax > 0 );
@@ -1550,74 +1624,316 @@ void sat_solver_reducedb(sat_solver* s)
 //    ActCutOff = ABC_INFINITY;
 
     // mark learned clauses to remove
-    Counter = j = 0;
+    Counter = 0;
     Sat_MemForEachLearned( pMem, c, i, k )
     {
         assert( c->mark == 0 );
         if ( Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k) )
-            act_clas[j++] = act_clas[clause_id(c)];
-        else // delete
-        {
-            c->mark = 1;
-            s->stats.learnts_literals -= clause_size(c);
-            s->stats.learnts--;
-        }
+            continue;
+        c->mark = 1; // delete
     }
-    assert( s->stats.learnts == (unsigned)j );
     assert( Counter == nLearnedOld );
-    veci_resize(&s->act_clas,j);
     ABC_FREE( pSortValues );
 
-    // update ID of each clause to be its new handle
-    Counter = Sat_MemCompactLearned( pMem, 0 );
-    assert( Counter == (int)s->stats.learnts );
+    // remove the marked clauses
+    sat_solver_remove_marked( s );
 
-    // update reasons
-    for ( i = 0; i < s->size; i++ )
+    // report the results
+    TimeTotal += Abc_Clock() - clk;
+    if ( s->fVerbose )
     {
-        if ( !s->reasons[i] ) // no reason
-            continue;
-        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
-            continue;
-        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
-            continue;
-        c = clause_read( s, s->reasons[i] );
-        assert( c->mark == 0 );
-        s->reasons[i] = clause_id(c); // updating handle here!!!
+    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
+        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
+    Abc_PrintTime( 1, "Time", TimeTotal );
     }
+}
 
-    // update watches
+
+//=================================================================================================
+// Inprocessing:
+
+// returns 1 if the clause is satisfied by the top-level assignment
+static inline int sat_solver_clause_is_sat0(sat_solver* s, clause* c)
+{
+    int i;
+    for ( i = 0; i < clause_size(c); i++ )
+        if ( var_value(s, lit_var(c->lits[i])) == lit_sign(c->lits[i]) )
+            return 1;
+    return 0;
+}
+
+// detaches the clauses satisfied at the top level from the watch lists and marks
+// the satisfied learned clauses for deletion; this also releases the watch lists 
+// of the variables assigned at the top level (for example, in the retired cones)
+static int sat_solver_inpro_detach(sat_solver* s)
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    int i, j, k, Lit, Counter = 0;
+    cla * pArray;
+    clause * c;
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
         for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
         {
-            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
-                pArray[j++] = pArray[k];
-            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
-                pArray[j++] = pArray[k];
-            else 
+            if ( clause_is_lit(pArray[k]) ) // 2-lit clause (!i + Lit)
             {
-                c = clause_read(s, pArray[k]);
-                if ( !c->mark ) // useful learned clause
-                   pArray[j++] = clause_id(c); // updating handle here!!!
+                Lit = clause_read_lit(pArray[k]);
+                if ( var_value(s, lit_var(i)) == varX && var_value(s, lit_var(Lit)) == varX )
+                    pArray[j++] = pArray[k];
+                else if ( lit_neg(i) < Lit )
+                    Counter++;
+                continue;
             }
+            c = clause_read(s, pArray[k]);
+            if ( c->mark ) // learned clause to be deleted
+                continue;
+            if ( !sat_solver_clause_is_sat0(s, c) )
+            {
+                pArray[j++] = pArray[k];
+                continue;
+            }
+            if ( clause_learnt_h(pMem, pArray[k]) )
+                c->mark = 1;
+            else if ( c->lits[0] == lit_neg(i) )
+                Counter++;
         }
         veci_resize(&s->wlists[i],j);
+        if ( j == 0 && s->wlists[i].cap > 16 )
+        {
+            veci_delete(&s->wlists[i]);
+            veci_new(&s->wlists[i]);
+        }
     }
+    return Counter;
+}
 
-    // perform final move of the clauses
-    Counter = Sat_MemCompactLearned( pMem, 1 );
-    assert( Counter == (int)s->stats.learnts );
+// shortens the learned clauses by propagating the negation of their literals;
+// a shortened clause is added as a new learned clause and the old one is marked;
+// the literals are copied because propagation reorders the literals of the clause;
+// returns 0 if the problem is found unsatisfiable at the top level
+static int sat_solver_inpro_vivify(sat_solver* s, veci* vHandles, ABC_INT64_T nPropLimit)
+{
+    char * pPolarOld = ABC_ALLOC( char, s->size );
+    veci vLits, vNew;
+    clause * c;
+    int i, k, h, Lit, Value, Lbd, RetValue = 1;
+    memcpy( pPolarOld, s->polarity, sizeof(char) * s->size );
+    veci_new(&vLits);
+    veci_new(&vNew);
+    for ( i = 0; i < veci_size(vHandles); i++ )
+    {
+        if ( s->stats.propagations > nPropLimit )
+            break;
+        h = veci_begin(vHandles)[i];
+        c = clause_read(s, h);
+        if ( c->mark || clause_size(c) < 3 )
+            continue;
+        veci_resize(&vLits,0);
+        for ( k = 0; k < clause_size(c); k++ )
+            veci_push(&vLits, c->lits[k]);
+        veci_resize(&vNew,0);
+        for ( k = 0; k < veci_size(&vLits); k++ )
+        {
+            Lit = veci_begin(&vLits)[k];
+            Value = var_value(s, lit_var(Lit));
+            if ( Value == lit_sign(Lit) ) // implied literal
+            {
+                veci_push(&vNew, Lit);
+                break;
+            }
+            if ( Value != varX ) // redundant literal
+                continue;
+            veci_push(&vNew, Lit);
+            sat_solver_decision(s, lit_neg(Lit));
+            if ( sat_solver_propagate(s) )
+                break;
+        }
+        sat_solver_canceluntil(s, 0);
+        if ( veci_size(&vNew) == clause_size(c) )
+            continue;
+        // replace the clause
+        Lbd = c->lbd;
+        c->mark = 1;
+        s->nInproVivified++;
+        s->nInproLitsRemoved += clause_size(c) - veci_size(&vNew);
+        Lit = veci_size(&vNew) ? veci_begin(&vNew)[veci_size(&vNew)-1] : lit_Undef;
+        if ( Lit != lit_Undef && var_value(s, lit_var(Lit)) == lit_sign(Lit) ) // satisfied at the top level
+            continue;
+        if ( veci_size(&vNew) == 0 || (veci_size(&vNew) == 1 && (!sat_solver_enqueue(s, Lit, 0) || sat_solver_propagate(s))) )
+        {
+            RetValue = 0;
+            break;
+        }
+        if ( veci_size(&vNew) > 1 )
+        {
+            h = sat_solver_clause_new(s, veci_begin(&vNew), veci_begin(&vNew) + veci_size(&vNew), 1);
+            c = clause_read(s, h);
+            c->lbd = Abc_MinInt( Lbd, veci_size(&vNew) );
+        }
+    }
+    veci_delete(&vLits);
+    veci_delete(&vNew);
+    // restore the saved phases changed by the decisions
+    memcpy( s->polarity, pPolarOld, sizeof(char) * s->size );
+    ABC_FREE( pPolarOld );
+    return RetValue;
+}
 
-    // report the results
-    TimeTotal += Abc_Clock() - clk;
+// marks the learned clauses subsumed by other learned clauses
+static int sat_solver_inpro_subsume(sat_solver* s, veci* vHandles, int nEffortLimit)
+{
+    int nClauses = veci_size(vHandles);
+    int * pHandles = veci_begin(vHandles);
+    int * pSizes = ABC_ALLOC( int, nClauses );
+    unsigned * pSigns = ABC_ALLOC( unsigned, nClauses );
+    int * pStart = ABC_CALLOC( int, 2*s->size + 1 );
+    int * pStamp = ABC_CALLOC( int, 2*s->size );
+    int * pOccurs, * pPerm;
+    int i, k, m, a, b, Lit, Best, nFound, nEffort = 0, Counter = 0;
+    clause * c, * d;
+    if ( nClauses == 0 )
+    {
+        ABC_FREE( pStamp );
+        ABC_FREE( pStart );
+        ABC_FREE( pSigns );
+        ABC_FREE( pSizes );
+        return 0;
+    }
+    // count occurrences and compute signatures
+    for ( i = 0; i < nClauses; i++ )
+    {
+        c = clause_read(s, pHandles[i]);
+        pSizes[i] = clause_size(c);
+        pSigns[i] = 0;
+        for ( k = 0; k < clause_size(c); k++ )
+        {
+            pStart[c->lits[k]+1]++;
+            pSigns[i] |= 1 << (c->lits[k] & 31);
+        }
+    }
+    for ( i = 0; i < 2*s->size; i++ )
+        pStart[i+1] += pStart[i];
+    pOccurs = ABC_ALLOC( int, pStart[2*s->size] );
+    for ( i = 0; i < nClauses; i++ )
+    {
+        c = clause_read(s, pHandles[i]);
+        for ( k = 0; k < clause_size(c); k++ )
+            pOccurs[pStart[c->lits[k]]++] = i;
+    }
+    for ( i = 2*s->size; i > 0; i-- )
+        pStart[i] = pStart[i-1];
+    pStart[0] = 0;
+    // try shorter clauses first
+    pPerm = Abc_MergeSortCost( pSizes, nClauses );
+    for ( i = 0; i < nClauses && nEffort < nEffortLimit; i++ )
+    {
+        a = pPerm[i];
+        c = clause_read(s, pHandles[a]);
+        if ( c->mark )
+            continue;
+        Best = c->lits[0];
+        for ( k = 0; k < clause_size(c); k++ )
+        {
+            pStamp[c->lits[k]] = a + 1;
+            if ( pStart[c->lits[k]+1] - pStart[c->lits[k]] < pStart[Best+1] - pStart[Best] )
+                Best = c->lits[k];
+        }
+        for ( m = pStart[Best]; m < pStart[Best+1]; m++ )
+        {
+            b = pOccurs[m];
+            if ( b == a || pSizes[b] < pSizes[a] || (pSigns[a] & ~pSigns[b]) )
+                continue;
+            d = clause_read(s, pHandles[b]);
+            if ( d->mark )
+                continue;
+            nFound = 0;
+            for ( k = 0; k < clause_size(d); k++ )
+            {
+                Lit = d->lits[k];
+                nFound += (pStamp[Lit] == a + 1);
+            }
+            nEffort += clause_size(d);
+            if ( nFound < clause_size(c) )
+                continue;
+            d->mark = 1;
+            Counter++;
+        }
+    }
+    ABC_FREE( pPerm );
+    ABC_FREE( pOccurs );
+    ABC_FREE( pStamp );
+    ABC_FREE( pStart );
+    ABC_FREE( pSigns );
+    ABC_FREE( pSizes );
+    return Counter;
+}
+
+// performs one round of inprocessing at the top level: detaches satisfied clauses,
+// vivifies recent learned clauses, removes subsumed learned clauses and compacts
+// the learned clause memory; returns 0 if the problem is unsatisfiable
+int sat_solver_inprocess(sat_solver* s)
+{
+    abctime clk = Abc_Clock();
+    Sat_Mem_t * pMem = &s->Mem;
+    ABC_INT64_T nPropLimit;
+    int i, k, Id, RetValue = 1;
+    int nLearnedOld = s->stats.learnts;
+    int nVivifiedOld = s->nInproVivified;
+    int nDetached, nSubsumed = 0;
+    veci vHandles;
+    clause * c;
+    assert( sat_solver_dl(s) == 0 );
+    s->nInproNext = s->stats.conflicts + s->nInproConfs;
+    // skip the solvers with proof logging or rollback
+    if ( s->pStore || s->iVarPivot > 0 )
+        return 1;
+    if ( sat_solver_propagate(s) )
+        return 0;
+    s->nInproRounds++;
+    nDetached = sat_solver_inpro_detach(s);
+    s->nInproDetached += nDetached;
+    // vivify the learned clauses added after the last round
+    nPropLimit = s->stats.propagations + (s->stats.propagations - s->nInproProps) / 10 + 10000;
+    veci_new(&vHandles);
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        Id = clause_id(c);
+        if ( !c->mark && Id >= s->iInproLearnt && c->lbd <= 8 )
+            veci_push(&vHandles, Sat_MemHand(pMem, i, k));
+    }
+    RetValue = sat_solver_inpro_vivify(s, &vHandles, nPropLimit);
+    // remove subsumed learned clauses
+    if ( RetValue )
+    {
+        veci_resize(&vHandles, 0);
+        Sat_MemForEachLearned( pMem, c, i, k )
+            if ( !c->mark )
+                veci_push(&vHandles, Sat_MemHand(pMem, i, k));
+        nSubsumed = sat_solver_inpro_subsume(s, &vHandles, 100 * veci_size(&vHandles) + 100000);
+        s->nInproSubsumed += nSubsumed;
+    }
+    veci_delete(&vHandles);
+    // the top-level assignments, including those derived while vivifying,
+    // do not need reasons, which may point to the clauses marked above
+    for ( i = 0; i < s->qtail; i++ )
+        s->reasons[lit_var(s->trail[i])] = 0;
+    // compact the learned clause memory
+    sat_solver_remove_marked(s);
+    s->iInproLearnt = s->stats.learnts;
+    s->nInproProps  = s->stats.propagations;
+    if ( !RetValue )
+    {
+        veci_resize(&s->conf_final, 0);
+        s->fSolved = 1;
+    }
     if ( s->fVerbose )
     {
-    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
-        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
-    Abc_PrintTime( 1, "Time", TimeTotal );
+        Abc_Print(1, "inprocess: Learned %7d -> %7d.  Vivified = %6d.  Subsumed = %6d.  Detached = %6d.  ",
+            nLearnedOld, s->stats.learnts, s->nInproVivified - nVivifiedOld, nSubsumed, nDetached );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
+    return RetValue;
 }
 
 
@@ -1955,6 +2271,11 @@ int sat_solver_solve_internal(sat_solver* s)
                 s->progress_estimate*100);
             fflush(stdout);
         }
+        if ( s->nInproConfs && s->root_level == 0 && s->stats.conflicts >= s->nInproNext && !sat_solver_inprocess(s) )
+        {
+            status = l_False;
+            break;
+        }
         nof_conflicts = (ABC_INT64_T)( 100 * luby(2, restart_iter++) );
         status = sat_solver_search(s, nof_conflicts);
         // quit the loop if reached an external limit
@@ -1966,6 +2287,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2031,6 +2354,20 @@ void sat_solver_pop(sat_solver* s)
     sat_solver_canceluntil(s, --s->root_level);
 }
 
+// counting the literals implied by one assumption (0 if it is already true; -1 if it leads to a conflict)
+int sat_solver_lookahead(sat_solver* s, int p)
+{
+    int nImps = s->qtail;
+    if (var_value(s, lit_var(p)) != varX)
+        return var_value(s, lit_var(p)) == lit_sign(p) ? 0 : -1;
+    if (!sat_solver_push(s, p)){
+        sat_solver_pop(s);
+        return -1; }
+    nImps = s->qtail - nImps;
+    sat_solver_pop(s);
+    return nImps;
+}
+
 void sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
 {
     // set the external limits
@@ -2048,7 +2385,7 @@ void sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nConfLimit, ABC_I
         s->nInsLimit = nInsLimitGlobal;
 }
 
-int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+static int sat_solver_solve_limited(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
 {
     lbool status;
     lit * i;
@@ -2068,6 +2405,10 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
     if ( s->fVerbose )
         printf( "Running SAT solver with parameters %d and %d and %d.\n", s->nLearntStart, s->nLearntDelta, s->nLearntRatio );
 
+    // perform inprocessing before the assumptions are asserted
+    if ( s->nInproConfs && s->stats.conflicts >= s->nInproNext && !sat_solver_inprocess(s) )
+        return l_False;
+
     sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
 
 #ifdef SAT_USE_ANALYZE_FINAL
@@ -2114,6 +2455,22 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
         (void) RetValue;
     }
     ////////////////////////////////////////////////
+    return status;
+}
+int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+{
+    stats_t Stats;
+    abctime clk;
+    int status;
+    if ( !Abc_SatStatIsOn() )
+        return sat_solver_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    // record the call
+    Stats  = s->stats;
+    clk    = Abc_Clock();
+    status = sat_solver_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    Abc_SatStatAdd( ABC_SAT_BSAT, status == l_True ? 1 : (status == l_False ? 0 : -1), s->size, s->stats.clauses, (int)(end - begin),
+        s->stats.conflicts - Stats.conflicts, s->stats.propagations - Stats.propagations, s->stats.decisions - Stats.decisions,
+        s->stats.tot_literals - Stats.tot_literals, Abc_Clock() - clk );
     return status;
 }
 
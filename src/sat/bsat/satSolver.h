@@ -54,10 +54,12 @@ extern int         sat_solver_minimize_assumptions( sat_solver* s, int * pLits,
 extern int         sat_solver_minimize_assumptions2( sat_solver* s, int * pLits, int nLits, int nConfLimit );
 extern int         sat_solver_push(sat_solver* s, int p);
 extern void        sat_solver_pop(sat_solver* s);
+extern int         sat_solver_lookahead(sat_solver* s, int p);
 extern void        sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal);
 extern void        sat_solver_restart( sat_solver* s );
 extern void        zsat_solver_restart_seed( sat_solver* s, double seed );
 extern void        sat_solver_rollback( sat_solver* s );
+extern int         sat_solver_inprocess( sat_solver* s );
 
 extern int         sat_solver_nvars(sat_solver* s);
 extern int         sat_solver_nclauses(sat_solver* s);
@@ -166,6 +168,17 @@ struct sat_solver_t
     int         nLearntRatio;  // ratio percentage of learned clauses
     int         nDBreduces;    // number of DB reductions
 
+    // inprocessing
+    int         nInproConfs;   // conflicts between inprocessing rounds (0 = no inprocessing)
+    ABC_INT64_T nInproNext;    // conflict count triggering the next round
+    ABC_INT64_T nInproProps;   // propagation count after the last round
+    int         iInproLearnt;  // the first learned clause not yet vivified
+    int         nInproRounds;  // the number of rounds
+    int         nInproVivified;    // the number of shortened learned clauses
+    int         nInproLitsRemoved; // the number of literals removed by vivification
+    int         nInproSubsumed;    // the number of subsumed learned clauses
+    int         nInproDetached;    // the number of detached satisfied problem clauses
+
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
     abctime     nRuntimeLimit; // external limit on runtime
@@ -205,6 +218,7 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    volatile int * pStop;       // flag to terminate
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -301,6 +315,12 @@ static int sat_solver_set_random(sat_solver* s, int fNotUseRandom)
     return fNotUseRandomOld;
 }
 
+static void sat_solver_set_inprocessing(sat_solver* s, int nConfs)
+{
+    s->nInproConfs = nConfs;
+    s->nInproNext  = s->stats.conflicts + nConfs;
+}
+
 static inline void sat_solver_bookmark(sat_solver* s)
 {
     assert( s->qhead == s->qtail );
@@ -338,6 +358,10 @@ static void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static void sat_solver_set_stop_flag( sat_solver *s, volatile int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
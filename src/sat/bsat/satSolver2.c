@@ -25,6 +25,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include <math.h>
 
 #include "satSolver2.h"
+#include "misc/util/utilSatStat.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1832,7 +1833,7 @@ int sat_solver2_check_watched( sat_solver2* s )
     return 0;
 }
 
-int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+static int sat_solver2_solve_limited(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
 {
     int restart_iter = 0;
     ABC_INT64_T  nof_conflicts;
@@ -1981,6 +1982,22 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
 //        sat_solver2_verify( s );
     return status;
 }
+int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+{
+    stats_t Stats;
+    abctime clk;
+    int status;
+    if ( !Abc_SatStatIsOn() )
+        return sat_solver2_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    // record the call
+    Stats  = s->stats;
+    clk    = Abc_Clock();
+    status = sat_solver2_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    Abc_SatStatAdd( ABC_SAT_BSAT2, status == l_True ? 1 : (status == l_False ? 0 : -1), s->size, s->stats.clauses, (int)(end - begin),
+        s->stats.conflicts - Stats.conflicts, s->stats.propagations - Stats.propagations, s->stats.decisions - Stats.decisions,
+        s->stats.tot_literals - Stats.tot_literals, Abc_Clock() - clk );
+    return status;
+}
 
 void * Sat_ProofCore( sat_solver2 * s )
 {
@@ -25,6 +25,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include <math.h>
 
 #include "satSolver3.h"
+#include "misc/util/utilSatStat.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -2010,7 +2011,7 @@ void sat_solver3_set_resource_limits(sat_solver3* s, ABC_INT64_T nConfLimit, ABC
         s->nInsLimit = nInsLimitGlobal;
 }
 
-int sat_solver3_solve(sat_solver3* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+static int sat_solver3_solve_limited(sat_solver3* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
 {
     lbool status;
     lit * i;
@@ -2059,6 +2060,22 @@ int sat_solver3_solve(sat_solver3* s, lit* begin, lit* end, ABC_INT64_T nConfLim
     s->root_level = 0;
     return status;
 }
+int sat_solver3_solve(sat_solver3* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal)
+{
+    stats_t Stats;
+    abctime clk;
+    int status;
+    if ( !Abc_SatStatIsOn() )
+        return sat_solver3_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    // record the call
+    Stats  = s->stats;
+    clk    = Abc_Clock();
+    status = sat_solver3_solve_limited( s, begin, end, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
+    Abc_SatStatAdd( ABC_SAT_BSAT3, status == l_True ? 1 : (status == l_False ? 0 : -1), s->size, s->stats.clauses, (int)(end - begin),
+        s->stats.conflicts - Stats.conflicts, s->stats.propagations - Stats.propagations, s->stats.decisions - Stats.decisions,
+        s->stats.tot_literals - Stats.tot_literals, Abc_Clock() - clk );
+    return status;
+}
 
 // This LEXSAT procedure should be called with a set of literals (pLits, nLits),
 // which defines both (1) variable order, and (2) assignment to begin search from.
@@ -198,6 +198,12 @@ void Sat_SolverPrintStats( FILE * pFile, sat_solver * p )
     printf( "propagations  : %16.0f\n", Sat_Wrd2Dbl(p->stats.propagations) );
 //    printf( "inspects      : %10d\n", (int)p->stats.inspects );
 //    printf( "inspects2     : %10d\n", (int)p->stats.inspects2 );
+    if ( p->nInproRounds == 0 )
+        return;
+    printf( "inprocessing  : %16d\n", p->nInproRounds );
+    printf( "  vivified    : %16d  (%d literals)\n", p->nInproVivified, p->nInproLitsRemoved );
+    printf( "  subsumed    : %16d\n", p->nInproSubsumed );
+    printf( "  detached    : %16d\n", p->nInproDetached );
 }
 
 /**Function*************************************************************
@@ -167,6 +167,102 @@ Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
     Cnf_ManPrepare();
     return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into the SAT solver using several threads.]
+
+  Description [Produces the same CNF as Cnf_DeriveWithMan(). The cuts 
+  are computed concurrently for the nodes of the same level, and the clauses 
+  are written concurrently into the preallocated literal array. The mapping
+  itself is still computed by the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveWithManPar( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs, int nThreads )
+{
+    Cnf_Dat_t * pCnf;
+    Vec_Ptr_t * vMapped;
+    Aig_MmFixed_t * pMemCuts;
+    abctime clk;
+    if ( nThreads < 2 )
+        return Cnf_DeriveWithMan( p, pAig, nOutputs );
+    // connect the managers
+    p->pManAig = pAig;
+
+    // generate cuts for all nodes, assign cost, and find best cuts
+clk = Abc_Clock();
+    pMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, nThreads );
+p->timeCuts = Abc_Clock() - clk;
+
+    // find the mapping
+clk = Abc_Clock();
+    Cnf_DeriveMapping( p );
+p->timeMap = Abc_Clock() - clk;
+
+    // convert it into CNF
+clk = Abc_Clock();
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    pCnf = Cnf_ManWriteCnfPar( p, vMapped, nOutputs, nThreads );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+p->timeSave = Abc_Clock() - clk;
+
+   // reset reference counters
+    Aig_ManResetRefs( pAig );
+    return pCnf;
+}
+Cnf_Dat_t * Cnf_DerivePar( Aig_Man_t * pAig, int nOutputs, int nThreads )
+{
+    Cnf_ManPrepare();
+    return Cnf_DeriveWithManPar( s_pManCnf, pAig, nOutputs, nThreads );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the sequential and the multi-threaded CNF generation.]
+
+  Description [Derives CNF both ways, checks that the results are identical
+  and prints the wall-clock runtimes. Returns 1 if the CNFs are identical.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveParTest( Aig_Man_t * pAig, int nOutputs, int nThreads, int fVerbose )
+{
+    Cnf_Dat_t * pCnf1, * pCnf2;
+    abctime clk1, clk2, clk;
+    int RetValue;
+    // create the manager in advance to exclude its runtime
+    Cnf_ManPrepare();
+    clk = Abc_ClockWall();
+    pCnf1 = Cnf_Derive( pAig, nOutputs );
+    clk1 = Abc_ClockWall() - clk;
+    if ( fVerbose )
+    {
+        ABC_PRT( "Cuts   ", s_pManCnf->timeCuts );
+        ABC_PRT( "Map    ", s_pManCnf->timeMap  );
+        ABC_PRT( "Saving ", s_pManCnf->timeSave );
+    }
+    clk = Abc_ClockWall();
+    pCnf2 = Cnf_DerivePar( pAig, nOutputs, nThreads );
+    clk2 = Abc_ClockWall() - clk;
+    RetValue = Cnf_DataIsEqual( pCnf1, pCnf2 );
+    printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.  ", pCnf1->nVars, pCnf1->nClauses, pCnf1->nLiterals );
+    printf( "The CNFs are %s.\n", RetValue ? "identical" : "DIFFERENT" );
+    ABC_PRT( "Serial wall time       ", clk1 );
+    printf( "Parallel wall time (%2d) =%9.2f sec  (speedup = %.2f)\n", 
+        nThreads, 1.0*clk2/CLOCKS_PER_SEC, clk2 ? 1.0*clk1/clk2 : 0.0 );
+    Cnf_DataFree( pCnf1 );
+    Cnf_DataFree( pCnf2 );
+    return RetValue;
+}
  
 /**Function*************************************************************
 
@@ -166,6 +166,33 @@ Cnf_Dat_t * Cnf_DataDup( Cnf_Dat_t * p )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two CNFs are identical.]
+
+  Description [Compares the variable numbers, the literals, and the 
+  positions of the clauses in the literal array.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DataIsEqual( Cnf_Dat_t * p1, Cnf_Dat_t * p2 )
+{
+    int i;
+    if ( p1->pMan != p2->pMan || p1->nVars != p2->nVars || p1->nClauses != p2->nClauses || p1->nLiterals != p2->nLiterals )
+        return 0;
+    if ( memcmp( p1->pVarNums, p2->pVarNums, sizeof(int) * Aig_ManObjNumMax(p1->pMan) ) )
+        return 0;
+    if ( memcmp( p1->pClauses[0], p2->pClauses[0], sizeof(int) * p1->nLiterals ) )
+        return 0;
+    for ( i = 1; i <= p1->nClauses; i++ )
+        if ( p1->pClauses[i] - p1->pClauses[0] != p2->pClauses[i] - p2->pClauses[0] )
+            return 0;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -20,6 +20,7 @@
 
 #include "cnf.h"
 #include "sat/bsat/satSolver.h"
+#include "misc/util/utilDimacs.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -303,77 +304,42 @@ unsigned char * Cnf_DataDeriveLitPolarities( Cnf_Dat_t * p )
 ***********************************************************************/
 Cnf_Dat_t * Cnf_DataReadFromFile( char * pFileName )
 {
-    int MaxLine = 1000000;
-    int Var, Lit, nVars = -1, nClas = -1, i, Entry, iLine = 0;
+    Abc_Dim_t * pDim;
     Cnf_Dat_t * pCnf = NULL;
     Vec_Int_t * vClas = NULL;
     Vec_Int_t * vLits = NULL;
-    char * pBuffer, * pToken;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
-    {
-        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+    int i, Entry, iStart;
+    pDim = Abc_DimStart( pFileName );
+    if ( pDim == NULL )
         return NULL;
+    if ( pDim->fError )
+        goto finish;
+    if ( pDim->nVars <= 0 || pDim->nClauses <= 0 )
+    {
+        printf( "Incorrect parameters.\n" );
+        goto finish;
     }
-    pBuffer = ABC_ALLOC( char, MaxLine );
-    while ( fgets(pBuffer, MaxLine, pFile) != NULL )
+    // the literals are decoded directly into the array used by the CNF
+    vClas = Vec_IntAlloc( pDim->nClauses+1 );
+    vLits = Vec_IntAlloc( pDim->nClauses*8 );
+    for ( iStart = 0; Abc_DimReadClauseAppend(pDim, vLits) == 1; iStart = Vec_IntSize(vLits) )
     {
-        iLine++;
-        if ( pBuffer[0] == 'c' )
-            continue;
-        if ( pBuffer[0] == 'p' )
-        {
-            pToken = strtok( pBuffer+1, " \t" );
-            if ( strcmp(pToken, "cnf") )
-            {
-                printf( "Incorrect input file.\n" );
-                goto finish;
-            }
-            pToken = strtok( NULL, " \t" );
-            nVars = atoi( pToken );
-            pToken = strtok( NULL, " \t" );
-            nClas = atoi( pToken );
-            if ( nVars <= 0 || nClas <= 0 )
-            {
-                printf( "Incorrect parameters.\n" );
-                goto finish;
-            }
-            // temp storage
-            vClas = Vec_IntAlloc( nClas+1 );
-            vLits = Vec_IntAlloc( nClas*8 );
-            continue;
-        }
-        pToken = strtok( pBuffer, " \t\r\n" );
-        if ( pToken == NULL )
-            continue;
-        Vec_IntPush( vClas, Vec_IntSize(vLits) );
-        while ( pToken )
-        {
-            Var = atoi( pToken );
-            if ( Var == 0 )
-                break;
-            Lit = (Var > 0) ? Abc_Var2Lit(Var-1, 0) : Abc_Var2Lit(-Var-1, 1);
-            if ( Lit >= 2*nVars )
-            {
-                printf( "Literal %d is out-of-bound for %d variables.\n", Lit, nVars );
-                goto finish;
-            }
-            Vec_IntPush( vLits, Lit );
-            pToken = strtok( NULL, " \t\r\n" );
-        }
-        if ( Var != 0 )
+        if ( pDim->nVarsMax > pDim->nVars )
         {
-            printf( "There is no zero-terminator in line %d.\n", iLine );
-            goto finish;
+            printf( "Literal %d is out-of-bound for %d variables.\n", Abc_Var2Lit(pDim->nVarsMax-1, 0), pDim->nVars );
+            break;
         }
+        Vec_IntPush( vClas, iStart );
     }
+    if ( pDim->fError || pDim->nVarsMax > pDim->nVars )
+        goto finish;
     // finalize
-    if ( Vec_IntSize(vClas) != nClas )
-        printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", Vec_IntSize(vClas), nClas );
+    if ( Vec_IntSize(vClas) != pDim->nClauses )
+        printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", Vec_IntSize(vClas), pDim->nClauses );
     Vec_IntPush( vClas, Vec_IntSize(vLits) );
     // create
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
-    pCnf->nVars     = nVars;
+    pCnf->nVars     = pDim->nVars;
     pCnf->nClauses  = Vec_IntSize(vClas)-1;
     pCnf->nLiterals = Vec_IntSize(vLits);
     pCnf->pClauses  = ABC_ALLOC( int *, Vec_IntSize(vClas) );
@@ -381,10 +347,9 @@ Cnf_Dat_t * Cnf_DataReadFromFile( char * pFileName )
     Vec_IntForEachEntry( vClas, Entry, i )
         pCnf->pClauses[i] = pCnf->pClauses[0] + Entry;
 finish:
-    fclose( pFile );
+    Abc_DimStop( pDim );
     Vec_IntFreeP( &vClas );
     Vec_IntFreeP( &vLits );
-    ABC_FREE( pBuffer );
     return pCnf;
 }
 
@@ -20,6 +20,17 @@
 
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -185,65 +196,129 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives CNF for the mapping.]
+  Synopsis    [Counts the literals and clauses of the mapped node.]
 
-  Description [The last argument shows the number of last outputs
-  of the manager, which will not be converted into clauses but the
-  new variables for which will be introduced.]
+  Description []
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+static inline void Cnf_ManCountNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pnLiterals, int * pnClauses )
 {
-    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
-    Aig_Obj_t * pObj;
-    Cnf_Dat_t * pCnf;
-    Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
+    assert( Aig_ObjIsNode(pObj) );
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        *pnClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
+        *pnClauses += Vec_IntSize(pCut->vIsop[1]);
+    }
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        *pnLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        *pnClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
+        *pnClauses += Vec_IntSize(pCut->vIsop[0]);
+    }
+}
 
-    // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the mapped node.]
+
+  Description [Writes the clause beginnings into *ppClas and the literals
+  into *ppLits. Advances both pointers past the written entries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_ManWriteNode( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Aig_Obj_t * pObj, Vec_Int_t * vSopTemp, int *** ppClas, int ** ppLits )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    int ** pClas = *ppClas, * pLits = *ppLits;
+    Vec_Int_t * vCover;
+    int OutVar, pVars[32];
+    unsigned uTruth;
+    int k, Cube;
+
+    // save variables of this cut
+    OutVar = pCnf->pVarNums[ pObj->Id ];
+    for ( k = 0; k < (int)pCut->nFanins; k++ )
     {
-        assert( Aig_ObjIsNode(pObj) );
-        pCut = Cnf_ObjBestCut( pObj );
+        pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
+        assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+    }
 
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
-        }
-        else
-        {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
-            nClauses += Vec_IntSize(pCut->vIsop[1]);
-        }
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
-        }
-        else
-        {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
-            nClauses += Vec_IntSize(pCut->vIsop[0]);
-        }
-//printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[1];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
     }
-//printf( "\n" );
+
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[0];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar + 1; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+    *ppClas = pClas;
+    *ppLits = pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates CNF and assigns variables.]
+
+  Description [The literal array of the CNF is allocated in one piece
+  and can be filled by the callers in any order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Dat_t * Cnf_ManWriteCnfStart( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int nLiterals, int nClauses, int fChangeVariableOrder )
+{
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    int i, Number;
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -316,57 +391,25 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
         pCnf->pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number--;
         assert( Number >= 0 );
     }
+    return pCnf;
+}
 
-    // assign the clauses
-    vSopTemp = Vec_IntAlloc( 1 << 16 );
-    pLits = pCnf->pClauses[0];
-    pClas = pCnf->pClauses;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
-    {
-        pCut = Cnf_ObjBestCut( pObj );
+/**Function*************************************************************
 
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
+  Synopsis    [Writes the constant clause and the clauses of the COs.]
 
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ManWriteCnfStop( Cnf_Man_t * p, Cnf_Dat_t * pCnf, int nOutputs, int ** pClas, int * pLits )
+{
+    Aig_Obj_t * pObj;
+    int i, OutVar, PoVar;
 
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-    }
-    Vec_IntFree( vSopTemp );
- 
     // write the constant literal
     OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
     assert( OutVar <= Aig_ManObjNumMax(p->pManAig) );
@@ -397,12 +440,177 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     }
 
     // verify that the correct number of literals and clauses was written
-    assert( pLits - pCnf->pClauses[0] == nLiterals );
-    assert( pClas - pCnf->pClauses == nClauses );
+    assert( pLits - pCnf->pClauses[0] == pCnf->nLiterals );
+    assert( pClas - pCnf->pClauses == pCnf->nClauses );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping.]
+
+  Description [The last argument shows the number of last outputs
+  of the manager, which will not be converted into clauses but the
+  new variables for which will be introduced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vSopTemp;
+    int * pLits, ** pClas;
+    int i, nLiterals, nClauses;
+
+    // count the number of literals and clauses
+    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        Cnf_ManCountNode( p, pObj, &nLiterals, &nClauses );
+
+    // allocate CNF and assign variables
+    pCnf = Cnf_ManWriteCnfStart( p, vMapped, nOutputs, nLiterals, nClauses, fChangeVariableOrder );
+
+    // assign the clauses
+    vSopTemp = Vec_IntAlloc( 1 << 16 );
+    pLits = pCnf->pClauses[0];
+    pClas = pCnf->pClauses;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        Cnf_ManWriteNode( p, pCnf, pObj, vSopTemp, &pClas, &pLits );
+    Vec_IntFree( vSopTemp );
+    Cnf_ManWriteCnfStop( p, pCnf, nOutputs, pClas, pLits );
 //Cnf_DataPrint( pCnf, 1 );
     return pCnf;
 }
 
+#ifndef ABC_USE_PTHREADS
+
+Cnf_Dat_t * Cnf_ManWriteCnfPar( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int nThreads )
+{
+    return Cnf_ManWriteCnf( p, vMapped, nOutputs );
+}
+
+#else // pthreads are used
+
+#define CNF_PAR_THR_MAX  64   // the largest number of threads
+
+typedef struct Cnf_ParWrite_t_ Cnf_ParWrite_t;
+struct Cnf_ParWrite_t_
+{
+    Cnf_Man_t *      p;          // the CNF manager
+    Cnf_Dat_t *      pCnf;       // the CNF being written
+    Vec_Ptr_t *      vMapped;    // the mapped nodes
+    int *            pLitStarts; // the first literal of each node
+    int *            pClaStarts; // the first clause of each node
+    int              iStart;     // the first node of this thread
+    int              iStop;      // the node after the last one of this thread
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of a range of mapped nodes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_ManWriteCnfParThread( void * pArg )
+{
+    Cnf_ParWrite_t * pThData = (Cnf_ParWrite_t *)pArg;
+    Cnf_Dat_t * pCnf = pThData->pCnf;
+    Vec_Int_t * vSopTemp = Vec_IntAlloc( 1 << 16 );
+    int ** pClas = pCnf->pClauses + pThData->pClaStarts[pThData->iStart];
+    int * pLits = pCnf->pClauses[0] + pThData->pLitStarts[pThData->iStart];
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+        Cnf_ManWriteNode( pThData->p, pCnf, (Aig_Obj_t *)Vec_PtrEntry(pThData->vMapped, i), vSopTemp, &pClas, &pLits );
+    assert( pClas - pCnf->pClauses == pThData->pClaStarts[pThData->iStop] );
+    assert( pLits - pCnf->pClauses[0] == pThData->pLitStarts[pThData->iStop] );
+    Vec_IntFree( vSopTemp );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping using several threads.]
+
+  Description [Produces the same CNF as Cnf_ManWriteCnf(). The positions
+  of the clauses and literals of each node in the preallocated arrays are
+  computed in advance, then the nodes are split into contiguous ranges with
+  roughly the same number of literals, which are written concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnfPar( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int nThreads )
+{
+    Cnf_ParWrite_t ThData[CNF_PAR_THR_MAX];
+    pthread_t WorkerThread[CNF_PAR_THR_MAX];
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vLitStarts, * vClaStarts;
+    int i, k, status, nLiterals, nClauses, nNodeLits, nNodeClas;
+    if ( nThreads < 2 || Vec_PtrSize(vMapped) < 1000 )
+        return Cnf_ManWriteCnf( p, vMapped, nOutputs );
+    nThreads = Abc_MinInt( nThreads, CNF_PAR_THR_MAX );
+
+    // find where the clauses of each node begin
+    vLitStarts = Vec_IntAlloc( Vec_PtrSize(vMapped) + 1 );
+    vClaStarts = Vec_IntAlloc( Vec_PtrSize(vMapped) + 1 );
+    nNodeLits = nNodeClas = 0;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        Vec_IntPush( vLitStarts, nNodeLits );
+        Vec_IntPush( vClaStarts, nNodeClas );
+        Cnf_ManCountNode( p, pObj, &nNodeLits, &nNodeClas );
+    }
+    Vec_IntPush( vLitStarts, nNodeLits );
+    Vec_IntPush( vClaStarts, nNodeClas );
+    nLiterals = nNodeLits + 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses  = nNodeClas + 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+
+    // allocate CNF and assign variables
+    pCnf = Cnf_ManWriteCnfStart( p, vMapped, nOutputs, nLiterals, nClauses, 0 );
+
+    // split the nodes into ranges with similar number of literals
+    for ( k = 0, i = 0; k < nThreads; k++ )
+    {
+        ThData[k].p          = p;
+        ThData[k].pCnf       = pCnf;
+        ThData[k].vMapped    = vMapped;
+        ThData[k].pLitStarts = Vec_IntArray( vLitStarts );
+        ThData[k].pClaStarts = Vec_IntArray( vClaStarts );
+        ThData[k].iStart     = i;
+        while ( i < Vec_PtrSize(vMapped) && Vec_IntEntry(vLitStarts, i) < (int)((word)nNodeLits * (k + 1) / nThreads) )
+            i++;
+        ThData[k].iStop      = k == nThreads - 1 ? Vec_PtrSize(vMapped) : i;
+        i = ThData[k].iStop;
+    }
+    // write the clauses
+    for ( k = 1; k < nThreads; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Cnf_ManWriteCnfParThread, (void *)(ThData + k) );  assert( status == 0 );
+    }
+    Cnf_ManWriteCnfParThread( (void *)ThData );
+    for ( k = 1; k < nThreads; k++ )
+        pthread_join( WorkerThread[k], NULL );
+    Cnf_ManWriteCnfStop( p, pCnf, nOutputs, pCnf->pClauses + nNodeClas, pCnf->pClauses[0] + nNodeLits );
+    Vec_IntFree( vLitStarts );
+    Vec_IntFree( vClaStarts );
+    return pCnf;
+}
+
+#endif // pthreads are used
+
 
 /**Function*************************************************************
 
@@ -29,6 +29,8 @@
 #include "aig/gia/gia.h"
 #include "sat/cnf/cnf.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilDimacs.h"
+#include "misc/util/utilSatStat.h"
 
 using namespace Gluco;
 
@@ -102,7 +104,17 @@ int glucose_solver_solve(Gluco::SimpSolver* S, int * plits, int nlits)
         p.x = *plits;
         lits.push(p);
     }
+    if ( !Abc_SatStatIsOn() )
+    {
+        Gluco::lbool res = S->solveLimited(lits, 0);
+        return (res == l_True ? 1 : res == l_False ? -1 : 0);
+    }
+    // record the call
+    int64_t nConfs = S->conflicts, nProps = S->propagations, nDecs = S->decisions, nLits = S->tot_literals;
+    abctime clk = Abc_Clock();
     Gluco::lbool res = S->solveLimited(lits, 0);
+    Abc_SatStatAdd( ABC_SAT_GLUCOSE, res == l_True ? 1 : res == l_False ? 0 : -1, S->nVars(), S->nClauses(), nlits,
+        S->conflicts - nConfs, S->propagations - nProps, S->decisions - nDecs, S->tot_literals - nLits, Abc_Clock() - clk );
     return (res == l_True ? 1 : res == l_False ? -1 : 0);
 }
 
@@ -341,7 +353,17 @@ int glucose_solver_solve(Gluco::Solver* S, int * plits, int nlits)
         p.x = *plits;
         lits.push(p);
     }
+    if ( !Abc_SatStatIsOn() )
+    {
+        Gluco::lbool res = S->solveLimited(lits);
+        return (res == l_True ? 1 : res == l_False ? -1 : 0);
+    }
+    // record the call
+    int64_t nConfs = S->conflicts, nProps = S->propagations, nDecs = S->decisions, nLits = S->tot_literals;
+    abctime clk = Abc_Clock();
     Gluco::lbool res = S->solveLimited(lits);
+    Abc_SatStatAdd( ABC_SAT_GLUCOSE, res == l_True ? 1 : res == l_False ? 0 : -1, S->nVars(), S->nClauses(), nlits,
+        S->conflicts - nConfs, S->propagations - nProps, S->decisions - nDecs, S->tot_literals - nLits, Abc_Clock() - clk );
     return (res == l_True ? 1 : res == l_False ? -1 : 0);
 }
 
@@ -560,52 +582,43 @@ void glucose_print_stats(SimpSolver& s, abctime clk)
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Loads the clauses of a DIMACS file into the solver.]
 
-  Description []
+  Description [Returns 1 if the clauses are loaded, 0 upon immediate 
+  conflict (including an empty clause), and -1 if the file cannot be read.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
+int Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
 {
     vec<Lit> * lits = &s.user_lits;
-    char * pBuffer = Extra_FileReadContents( pFileName );
-    char * pTemp; int fComp, Var, VarMax = 0;
+    Abc_Dim_t * pDim = Abc_DimStart( pFileName );
+    Vec_Int_t * vLits;
+    int i, Lit, RetValue = 1;
+    if ( pDim == NULL )
+        return -1;
+    vLits = Vec_IntAlloc( 100 );
     lits->clear();
-    for ( pTemp = pBuffer; *pTemp; pTemp++ )
+    Abc_DimForEachClause( pDim, vLits )
     {
-        if ( *pTemp == 'c' || *pTemp == 'p' ) {
-            while ( *pTemp != '\n' )
-                pTemp++;
-            continue;
-        }
-        while ( *pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n' )
-            pTemp++;
-        fComp = 0;
-        if ( *pTemp == '-' )
-            fComp = 1, pTemp++;
-        if ( *pTemp == '+' )
-            pTemp++;
-        Var = atoi( pTemp );
-        if ( Var == 0 ) {
-            if ( lits->size() > 0 ) {
-                s.addVar( VarMax );
-                s.addClause(*lits);
-                lits->clear();
-            }
-        }
-        else {
-            Var--;
-            VarMax = Abc_MaxInt( VarMax, Var );
-            lits->push( toLit(Abc_Var2Lit(Var, fComp)) );
-        }
-        while ( *pTemp >= '0' && *pTemp <= '9' )
-            pTemp++;
+        Vec_IntForEachEntry( vLits, Lit, i )
+            lits->push( toLit(Lit) );
+        if ( pDim->nVarsMax > 0 )
+            s.addVar( pDim->nVarsMax - 1 );
+        if ( !s.addClause(*lits) )
+            RetValue = 0;
+        lits->clear();
+        if ( RetValue == 0 )
+            break;
     }
-    ABC_FREE( pBuffer );
+    if ( pDim->fError )
+        RetValue = -1;
+    Abc_DimStop( pDim );
+    Vec_IntFree( vLits );
+    return RetValue;
 }
 
 /**Function*************************************************************
@@ -622,6 +635,7 @@ void Glucose_ReadDimacs( char * pFileName, SimpSolver& s )
 void Glucose_SolveCnf( char * pFileName, Glucose_Pars * pPars )
 {
     abctime clk = Abc_Clock();
+    int RetValue;
 
     SimpSolver  S;
     S.verbosity = pPars->verb;
@@ -630,7 +644,18 @@ void Glucose_SolveCnf( char * pFileName, Glucose_Pars * pPars )
 //    gzFile in = gzopen(pFilename, "rb");
 //    parse_DIMACS(in, S);
 //    gzclose(in);
-    Glucose_ReadDimacs( pFileName, S );
+    RetValue = Glucose_ReadDimacs( pFileName, S );
+    if ( RetValue == -1 )
+    {
+        printf( "Glucose_SolveCnf(): Cannot read DIMACS file \"%s\".\n", pFileName );
+        return;
+    }
+    if ( RetValue == 0 )
+    {
+        printf( "UNSATISFIABLE" );
+        Abc_PrintTime( 1, "      Time", Abc_Clock() - clk );
+        return;
+    }
 
     if ( pPars->verb )
     {
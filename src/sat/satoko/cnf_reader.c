@@ -7,151 +7,54 @@
 //
 //===------------------------------------------------------------------------===
 #include <assert.h>
-#include <ctype.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "satoko.h"
 #include "solver.h"
-#include "utils/mem.h"
-#include "utils/vec/vec_uint.h"
 
 #include "misc/util/abc_global.h"
+#include "misc/util/utilDimacs.h"
 ABC_NAMESPACE_IMPL_START
 
-/** Read the file into an internal buffer.
- *
- * This function will receive a file name. The return data is a string ended
- * with '\0'.
- *
- */
-static char * file_open(const char *fname)
-{
-	FILE *file = fopen(fname, "rb");
-	char *buffer;
-	int sz_file;
-	int ret;
-
-	if (file == NULL) {
-		printf("Couldn't open file: %s\n", fname);
-		return NULL;
-	}
-	fseek(file, 0, SEEK_END);
-	sz_file = ftell(file);
-	rewind(file);
-	buffer = satoko_alloc(char, sz_file + 3);
-	ret = fread(buffer, sz_file, 1, file);
-	buffer[sz_file + 0] = '\n';
-	buffer[sz_file + 1] = '\0';
-	return buffer;
-}
-
-static void skip_spaces(char **pos)
-{
-	assert(pos != NULL);
-	for (; isspace(**pos); (*pos)++);
-}
-
-static void skip_line(char **pos)
-{
-	assert(pos != NULL);
-	for(; **pos != '\n' && **pos != '\r' && **pos != EOF; (*pos)++);
-	if (**pos != EOF)
-		(*pos)++;
-	return;
-}
-
-static int read_int(char **token)
-{
-	int value = 0;
-	int neg = 0;
-
-	skip_spaces(token);
-	if (**token == '-') {
-		neg = 1;
-		(*token)++;
-	} else if (**token == '+')
-		(*token)++;
-
-	if (!isdigit(**token)) {
-		printf("Parsing error. Unexpected char: %c.\n", **token);
-		exit(EXIT_FAILURE);
-	}
-	while (isdigit(**token)) {
-		value = (value * 10) + (**token - '0');
-		(*token)++;
-	}
-	return neg ? -value : value;
-}
-
-static void read_clause(char **token, vec_uint_t *lits)
-{
-	int var;
-	unsigned sign;
-
-	vec_uint_clear(lits);
-	while (1) {
-		var = read_int(token);
-		if (var == 0)
-			break;
-		sign = (var > 0);
-		var = abs(var) - 1;
-		vec_uint_push_back(lits, var2lit((unsigned) var, (char)!sign));
-	}
-}
-
 /** Start the solver and reads the DIMAC file.
  *
- * Returns false upon immediate conflict.
+ * The file is tokenized by the DIMACS reader shared with the other solvers,
+ * which maps it into memory and hands over one clause at a time.
+ *
+ * Returns false upon immediate conflict and -1 if the file cannot be read.
  */
 int satoko_parse_dimacs(char *fname, satoko_t **solver)
 {
 	satoko_t *p = NULL;
-	vec_uint_t *lits = NULL;
-	int n_var;
-	int n_clause;
-	char *buffer = file_open(fname);
-	char *token;
+	Vec_Int_t *lits;
+	Abc_Dim_t *reader = Abc_DimStart(fname);
+	int ret = SATOKO_OK;
 
-	if (buffer == NULL)
+	if (reader == NULL)
 		return -1;
-
-	token = buffer;
-	while (1) {
-		skip_spaces(&token);
-		if (*token == 0)
+	if (reader->fError) {
+		Abc_DimStop(reader);
+		return -1;
+	}
+	lits = Vec_IntAlloc(100);
+	p = satoko_create();
+	Abc_DimForEachClause(reader, lits) {
+		if (Vec_IntSize(lits) == 0 || !satoko_add_clause(p, Vec_IntArray(lits), Vec_IntSize(lits))) {
+			ret = SATOKO_ERR;
 			break;
-		else if (*token == 'c')
-			skip_line(&token);
-		else if (*token == 'p') {
-			token++;
-			skip_spaces(&token);
-			for(; !isspace(*token); token++); /* skip 'cnf' */
-
-			n_var = read_int(&token);
-			n_clause = read_int(&token);
-			skip_line(&token);
-			lits = vec_uint_alloc((unsigned) n_var);
-			p = satoko_create();
-		} else {
-			if (lits == NULL) {
-				printf("There is no parameter line.\n");
-				satoko_free(buffer);
-				return -1;
-			}
-			read_clause(&token, lits);
-			if (!satoko_add_clause(p, (int*)vec_uint_data(lits), vec_uint_size(lits))) {
-				printf("Unable to add clause: ");
-				vec_uint_print(lits);
-				return SATOKO_ERR;
-			}
-        	}
+		}
+	}
+	if (reader->fError) {
+		satoko_destroy(p);
+		p = NULL;
+		ret = -1;
 	}
-	vec_uint_free(lits);
-	satoko_free(buffer);
+	Abc_DimStop(reader);
+	Vec_IntFree(lits);
 	*solver = p;
-	return SATOKO_OK;
+	return ret;
 }
 
 ABC_NAMESPACE_IMPL_END
@@ -82,6 +82,7 @@ struct satoko_stats {
 
 	long n_original_lits;
 	long n_learnt_lits;
+	long n_tot_lits;
 };
 
 
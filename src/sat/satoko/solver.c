@@ -347,6 +347,7 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
 
 	vec_uint_clear(s->temp_lits);
 	solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
+	s->stats.n_tot_lits += vec_uint_size(s->temp_lits);
 	s->sum_lbd += lbd;
 	b_queue_push(s->bq_lbd, lbd);
 	solver_cancel_until(s, bt_level);
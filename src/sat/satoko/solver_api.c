@@ -16,6 +16,7 @@
 #include "utils/misc.h"
 
 #include "misc/util/abc_global.h"
+#include "misc/util/utilSatStat.h"
 ABC_NAMESPACE_IMPL_START
 
 //===------------------------------------------------------------------------===
@@ -303,7 +304,7 @@ void satoko_assump_pop(solver_t *s)
 	solver_cancel_until(s, vec_uint_size(s->assumptions));
 }
 
-int satoko_solve(solver_t *s)
+static int satoko_solve_int(solver_t *s)
 {
 	int status = SATOKO_UNDEC;
 
@@ -336,6 +337,22 @@ int satoko_solve(solver_t *s)
 	return status;
 }
 
+int satoko_solve(solver_t *s)
+{
+	abctime clk;
+	int status;
+	if (!Abc_SatStatIsOn())
+		return satoko_solve_int(s);
+	/* the statistics are reset at the beginning of each call */
+	clk = Abc_Clock();
+	status = satoko_solve_int(s);
+	Abc_SatStatAdd(ABC_SAT_SATOKO, status == SATOKO_SAT ? 1 : (status == SATOKO_UNSAT ? 0 : -1),
+		satoko_varnum(s), satoko_clausenum(s), vec_uint_size(s->assumptions),
+		s->stats.n_conflicts, s->stats.n_propagations, s->stats.n_decisions,
+		s->stats.n_tot_lits, Abc_Clock() - clk);
+	return status;
+}
+
 int satoko_solve_assumptions(solver_t *s, int * plits, int nlits)
 {
 	int i, status;